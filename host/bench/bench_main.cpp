@@ -0,0 +1,399 @@
+// Host benchmark for the control-loop hot paths.
+// Build & run: pio run -e native && .pio/build/native/program [iterations]
+//
+// Wall-clock cost is measured with std::chrono while the firmware sees the
+// virtual HostHal clock, so results are independent of the simulated time.
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "HostHal.h"
+#include "Oiler.h"
+#include "AuxManager.h"
+#include "Scheduler.h"
+#include "Persistence.h"
+#include "WebConsole.h"
+#include "LogWriter.h"
+#include "TelemetryLog.h"
+#include "HighRateLog.h"
+#include "PageTemplate.h"
+#include "JsonWriter.h"
+#include "html_pages.h"
+
+namespace {
+
+    typedef std::chrono::steady_clock BenchClock;
+
+    void report(const char* name, unsigned long iterations, BenchClock::duration elapsed) {
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        printf("%-28s %10lu calls %10.1f ns/call\n", name, iterations, ns / (double)iterations);
+    }
+
+    void printCounters(const char* name) {
+        const HostHal::Counters& c = HostHal::counters();
+        printf("  %s: gpio=%u pwm=%u fades=%u nvsRead=%u nvsWrite=%u (changed %u) nvsCommit=%u flashWrite=%u flashErase=%u ledFrames=%u\n",
+            name, c.gpioWrites, c.pwmWrites, c.pwmFades, c.storeReads, c.storeWrites, c.storeChanged,
+            c.storeCommits, c.flashWrites, c.flashErases, c.stripShows);
+    }
+
+    // Straight eastward ride at constant speed, one fix every 100 ms
+    void benchUpdate(Oiler& oiler, unsigned long iterations) {
+        const float speedKmh = 80.0;
+        const double metersPerFix = speedKmh / 3.6 * 0.1;
+        const double degPerMeter = 1.0 / 111320.0;
+        double lat = 47.0;
+        double lon = 8.0;
+
+        HostHal::resetCounters();
+        BenchClock::time_point start = BenchClock::now();
+        for (unsigned long i = 0; i < iterations; i++) {
+            HostHal::advanceMillis(100);
+            lon += metersPerFix * degPerMeter / 0.682; // cos(47 deg)
+            oiler.update(speedKmh, lat, lon, true);
+            persistence.service();
+        }
+        report("Oiler::update (80 km/h)", iterations, BenchClock::now() - start);
+        printf("  odometer=%.2f km, pump cycles=%lu\n", oiler.getOdometer(), oiler.getPumpCycles());
+        printCounters("update");
+    }
+
+    // Button, pump state machine and LED frame every 10 ms (like main.cpp)
+    void benchLoop(Oiler& oiler, unsigned long iterations) {
+        HostHal::resetCounters();
+        BenchClock::time_point start = BenchClock::now();
+        for (unsigned long i = 0; i < iterations; i++) {
+            HostHal::advanceMillis(10);
+            oiler.loop();
+        }
+        report("Oiler::loop (10 ms)", iterations, BenchClock::now() - start);
+        printCounters("loop");
+    }
+
+    // Settings clicks (rain mode on/off) 1 s apart, each one calls saveConfig()
+    void benchSettings(Oiler& oiler, unsigned long clicks) {
+        HostHal::resetCounters();
+        BenchClock::time_point start = BenchClock::now();
+        for (unsigned long i = 0; i < clicks; i++) {
+            HostHal::advanceMillis(1000);
+            oiler.setRainMode(i % 2 == 0);
+            persistence.service();
+        }
+        oiler.setRainMode(false);
+        persistence.flush();
+        report("Oiler::setRainMode (1 s)", clicks, BenchClock::now() - start);
+        printCounters("settings");
+    }
+
+    Oiler* schedOiler = NULL;
+    Scheduler scheduler;
+    int schedPumpTask = -1;
+    void schedPumpWake() { scheduler.wake(schedPumpTask); }
+    uint32_t schedControl() { return schedOiler->serviceControl(); }
+    uint32_t schedPump() { return schedOiler->servicePump(); }
+    uint32_t schedLED() { return schedOiler->serviceLED(); }
+    uint32_t schedPersist() { return persistence.service(); }
+
+    // Oiler services on the deadline scheduler of main.cpp, sleeping (= jumping
+    // the virtual clock) until the next deadline. One oiling event in the window.
+    void benchScheduler(Oiler& oiler, unsigned long virtualSeconds) {
+        schedOiler = &oiler;
+        scheduler.add("control", schedControl);
+        schedPumpTask = scheduler.add("pump", schedPump);
+        oiler.setPumpWakeCallback(schedPumpWake);
+        scheduler.add("led", schedLED);
+        scheduler.add("persist", schedPersist);
+        scheduler.resetStats();
+        oiler.pulseStats.reset();
+        oiler.triggerOil(2);
+
+        HostHal::resetCounters();
+        unsigned long passes = 0;
+        uint64_t end = HostHal::nowMicros() + (uint64_t)virtualSeconds * 1000000ULL;
+        BenchClock::time_point start = BenchClock::now();
+        while (HostHal::nowMicros() < end) {
+            uint32_t sleepUs = scheduler.runDue(SCHED_MAX_SLEEP_MS * 1000UL);
+            HostHal::advanceMicros(sleepUs > 0 ? sleepUs : 1);
+            passes++;
+        }
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count();
+        printf("%-28s %10lu s   %10.1f us/s CPU, %.1f passes/s\n", "Scheduler (idle + 1 oiling)",
+            virtualSeconds, ns / 1000.0 / virtualSeconds, (double)passes / virtualSeconds);
+        for (int i = 0; i < scheduler.getTaskCount(); i++) {
+            printf("  %-8s %8.1f runs/s\n", scheduler.getTaskName(i), (double)scheduler.getRunCount(i) / virtualSeconds);
+        }
+        printf("  last pulse: %.3f ms until ramp down, %.3f ms until off\n",
+            oiler.pump.getLastPulseUs() / 1000.0, oiler.pump.getLastTotalUs() / 1000.0);
+        for (int m = 0; m < PulseStats::METRIC_COUNT; m++) {
+            printf("  %-9s n=%lu dev avg %.3f ms (min %.3f, max %.3f)\n", PulseStats::getMetricName(m),
+                (unsigned long)oiler.pulseStats.getCount(m), oiler.pulseStats.getAvgDevUs(m) / 1000.0,
+                oiler.pulseStats.getMinDevUs(m) / 1000.0, oiler.pulseStats.getMaxDevUs(m) / 1000.0);
+        }
+        printCounters("sched");
+    }
+
+    void benchAux(AuxManager& aux, unsigned long iterations) {
+        aux.setMode(AUX_MODE_HEATED_GRIPS);
+        HostHal::resetCounters();
+        BenchClock::time_point start = BenchClock::now();
+        for (unsigned long i = 0; i < iterations; i++) {
+            HostHal::advanceMillis(10);
+            aux.loop(60.0 + (float)(i % 40), 5.0, (i / 1000) % 2 == 0);
+        }
+        report("AuxManager::loop (grips)", iterations, BenchClock::now() - start);
+        printCounters("aux");
+    }
+
+    // Stands in for the SD file: counts bytes and write() calls
+    class NullSink : public Print {
+    public:
+        size_t bytes = 0;
+        uint32_t writes = 0;
+        size_t write(uint8_t c) { (void)c; bytes++; writes++; return 1; }
+        size_t write(const uint8_t* buffer, size_t size) { (void)buffer; bytes += size; writes++; return size; }
+    };
+
+    // One DATA line per call: printf with floats (old writeLogLine) vs. LogWriter
+    void benchLogLine(Oiler& oiler, unsigned long iterations) {
+        char line[160];
+        size_t bytes = 0;
+        BenchClock::time_point start = BenchClock::now();
+        for (unsigned long i = 0; i < iterations; i++) {
+            bytes += snprintf(line, sizeof(line), "%s,%lu,%.2f,%.2f,%.2f,%.2f,%.2f,%d,%d,%.1f,%d,%.2f,%s,%d\n",
+                "DATA", i * 1000UL, 80.0f + (i % 50) * 0.13f, oiler.getSmoothedSpeed(), oiler.getOdometer() + i * 0.02,
+                oiler.getCurrentDistAccumulator(), oiler.getCurrentTargetDistance(), 0, 0, 21.5f, 9, 0.9f, "", 0);
+        }
+        report("Log line (snprintf %f)", iterations, BenchClock::now() - start);
+
+        static LogWriter writer;
+        NullSink sink;
+        writer.begin(&sink);
+        start = BenchClock::now();
+        for (unsigned long i = 0; i < iterations; i++) {
+            writer.add("DATA");
+            writer.add(',');
+            writer.addUInt(i * 1000UL);
+            writer.add(',');
+            writer.addFixed(80.0f + (i % 50) * 0.13f, 2);
+            writer.add(',');
+            writer.addFixed(oiler.getSmoothedSpeed(), 2);
+            writer.add(',');
+            writer.addFixed(oiler.getOdometer() + i * 0.02, 2);
+            writer.add(',');
+            writer.addFixed(oiler.getCurrentDistAccumulator(), 2);
+            writer.add(',');
+            writer.addFixed(oiler.getCurrentTargetDistance(), 2);
+            writer.add(",0,0,");
+            writer.addFixed(21.5f, 1);
+            writer.add(',');
+            writer.addUInt(9);
+            writer.add(',');
+            writer.addFixed(0.9f, 2);
+            writer.add(",,0");
+            writer.endLine();
+        }
+        writer.flush();
+        report("Log line (LogWriter)", iterations, BenchClock::now() - start);
+        printf("  %lu lines: snprintf %zu bytes, LogWriter %zu bytes in %u sink writes (%.0f bytes/write)\n",
+            iterations, bytes, sink.bytes, sink.writes, sink.writes ? (double)sink.bytes / sink.writes : 0.0);
+
+        // Same rows as binary records (LOG_BINARY)
+        static TelemetryLog telemetry;
+        NullSink binSink;
+        writer.begin(&binSink);
+        telemetry.begin(&writer, true);
+        double values[TelemetryLog::FIELD_COUNT] = { 0 };
+        start = BenchClock::now();
+        for (unsigned long i = 0; i < iterations; i++) {
+            values[TelemetryLog::SPEED_GPS] = 80.0f + (i % 50) * 0.13f;
+            values[TelemetryLog::SPEED_SMOOTH] = oiler.getSmoothedSpeed();
+            values[TelemetryLog::ODO_TOTAL] = oiler.getOdometer() + i * 0.02;
+            values[TelemetryLog::DIST_ACCUM] = oiler.getCurrentDistAccumulator();
+            values[TelemetryLog::TARGET_INT] = oiler.getCurrentTargetDistance();
+            values[TelemetryLog::TEMP_C] = 21.5f;
+            values[TelemetryLog::SATS] = 9;
+            values[TelemetryLog::HDOP] = 0.9f;
+            telemetry.write(TelemetryLog::REC_DATA, i * 1000UL, values);
+        }
+        writer.flush();
+        report("Log row (binary)", iterations, BenchClock::now() - start);
+        printf("  %lu rows: %zu bytes (%.1f bytes/row), %u syncs\n",
+            iterations, binSink.bytes, (double)binSink.bytes / iterations, telemetry.getSyncs());
+    }
+
+    // Remembers where each write() started in the file
+    class OffsetSink : public Print {
+    public:
+        size_t bytes = 0;
+        std::vector<size_t> starts;
+        size_t write(uint8_t c) { return write(&c, 1); }
+        size_t write(const uint8_t* buffer, size_t size) { (void)buffer; starts.push_back(bytes); bytes += size; return size; }
+    };
+
+    // Sector alignment of the card writes after a flush() (standstill) in the middle of a sector
+    void benchLogAlignment(unsigned long iterations) {
+        static LogWriter writer;
+        static TelemetryLog telemetry;
+        OffsetSink sink;
+        writer.begin(&sink);
+        telemetry.begin(&writer, false);
+        double values[TelemetryLog::FIELD_COUNT] = { 0 };
+        unsigned long flushes = 0;
+        size_t afterFlush = 0;
+        for (unsigned long i = 0; i < iterations; i++) {
+            values[TelemetryLog::SPEED_GPS] = 80.0f + (i % 50) * 0.13f;
+            values[TelemetryLog::ODO_TOTAL] = i * 0.02;
+            telemetry.write(TelemetryLog::REC_DATA, i * 1000UL, values);
+            if (i % 97 == 20) { // Stop and go
+                writer.flush();
+                flushes++;
+                if (afterFlush == 0) afterFlush = sink.starts.size();
+            }
+        }
+        writer.flush();
+
+        // Only the flush() writes may end inside a sector, the write after one completes it
+        sink.starts.push_back(sink.bytes);
+        size_t endsMid = 0;
+        for (size_t i = 1; i < sink.starts.size(); i++) {
+            if (sink.starts[i] % LOG_SECTOR_SIZE != 0) endsMid++;
+        }
+        sink.starts.pop_back();
+        printf("%-28s %10lu rows, %zu writes, %zu end mid-sector (%lu flushes)\n",
+            "Log write alignment", iterations, sink.starts.size(), endsMid, flushes + 1);
+        printf("  offsets after the first flush:");
+        for (size_t i = afterFlush; i < sink.starts.size() && i < afterFlush + 4; i++) {
+            printf(" %zu (%%512 = %zu)", sink.starts[i], sink.starts[i] % LOG_SECTOR_SIZE);
+        }
+        printf("\n");
+    }
+
+    // High-rate log: loop side (copy into the double buffer) vs. writer side (encode)
+    void benchHighRate(unsigned long iterations) {
+        static HighRateLog hr;
+        static LogWriter writer;
+        static TelemetryLog telemetry(HighRateLog::COLUMNS, HighRateLog::FIELD_COUNT);
+        NullSink sink;
+        writer.begin(&sink);
+        telemetry.begin(&writer, true);
+
+        HighRateLog::Sample s = { 0, 80.0f, 79.5f, 12.5f, -1.5f, 0.25f, -0.5f, 0.1f, false };
+        BenchClock::duration addTime(0), writeTime(0);
+        for (unsigned long i = 0; i < iterations; i++) {
+            s.timeMs = i * (1000 / HIGHRATE_LOG_HZ);
+            s.speedGps = 80.0f + (i % 50) * 0.13f;
+            s.pumpOn = (i % 40) < 3;
+            BenchClock::time_point start = BenchClock::now();
+            hr.add(s);
+            addTime += BenchClock::now() - start;
+            if ((i + 1) % HIGHRATE_BUFFER_SAMPLES == 0) {
+                start = BenchClock::now();
+                hr.writeNext(telemetry);
+                writeTime += BenchClock::now() - start;
+            }
+        }
+        writer.flush();
+        report("HighRateLog::add (loop)", iterations, addTime);
+        report("HighRateLog write (task)", iterations, writeTime);
+        printf("  %u samples, %u dropped, %zu bytes (%.1f bytes/sample)\n",
+            hr.getSamples(), hr.getDropped(), sink.bytes, (double)sink.bytes / iterations);
+    }
+
+    // Aux page: copy + replace() per placeholder (old handlers) vs. PageTemplate
+    const char* const auxKeys[] = {
+        "MODE_OFF", "MODE_AUX", "MODE_GRIPS", "BASE", "SPEED_LOW", "SPEED_MED", "SPEED_HIGH",
+        "REACT_SLOW", "REACT_MED", "REACT_FAST", "TEMP_LOW", "TEMP_MED", "TEMP_HIGH", "TEMPO",
+        "CURRENT_TEMP", "TEMP_CONV", "STARTT", "RAINB", "STARTL", "STARTS", "STARTD"
+    };
+    const int AUX_KEYS = sizeof(auxKeys) / sizeof(auxKeys[0]);
+    Oiler* pageOiler = NULL;
+
+    void fillAux(Print& out, int key) { out.print(pageOiler->getTotalDistance() + key, 1); }
+
+    void benchPage(Oiler& oiler, unsigned long iterations) {
+        pageOiler = &oiler;
+        NullSink sink;
+        size_t peak = 0;
+        BenchClock::time_point start = BenchClock::now();
+        for (unsigned long i = 0; i < iterations; i++) {
+            String html = htmlAuxConfig;
+            for (int k = 0; k < AUX_KEYS; k++) {
+                html.replace(String("%") + auxKeys[k] + "%", String(oiler.getTotalDistance() + k, 1));
+            }
+            sink.write((const uint8_t*)html.c_str(), html.length());
+            if (html.length() > peak) peak = html.length();
+        }
+        report("Aux page (replace)", iterations, BenchClock::now() - start);
+        printf("  %zu bytes/page, page copy of %zu bytes in RAM\n", sink.bytes / iterations, peak);
+
+        PageTemplate page(htmlAuxConfig, auxKeys, AUX_KEYS);
+        page.begin();
+        NullSink streamed;
+        start = BenchClock::now();
+        for (unsigned long i = 0; i < iterations; i++) page.render(streamed, fillAux);
+        report("Aux page (template)", iterations, BenchClock::now() - start);
+        printf("  %zu bytes/page, %d placeholders, %u writes/page\n",
+            streamed.bytes / iterations, page.getPlaceholders(), streamed.writes / (uint32_t)iterations);
+    }
+
+    // /api/status body (main.cpp fillStatus) instead of the rendered landing page
+    void benchJson(Oiler& oiler, unsigned long iterations) {
+        NullSink sink;
+        BenchClock::time_point start = BenchClock::now();
+        for (unsigned long i = 0; i < iterations; i++) {
+            JsonWriter json(sink);
+            json.beginObject();
+            json.add("time", "12:34 (UTC+2)");
+            json.add("sats", 9);
+            json.addFixed("speedKmh", oiler.getSmoothedSpeed(), 1);
+            json.addFixed("tempC", 12.0, 1);
+            json.addFixed("odoKm", oiler.getTotalDistance(), 1);
+            json.add("pumpCycles", oiler.getPumpCycles());
+            json.addFixed("progressPct", oiler.getCurrentProgress() * 100.0, 1);
+            json.addBool("emergency", oiler.isEmergencyModeForced());
+            json.addBool("rain", oiler.isRainMode());
+            json.addBool("flush", oiler.isFlushMode());
+            json.beginObject("tank");
+            json.addBool("enabled", oiler.tankMonitorEnabled);
+            json.addFixed("levelMl", oiler.currentTankLevelMl, 1);
+            json.addFixed("capacityMl", oiler.tankCapacityMl, 0);
+            json.addFixed("pct", 80.0, 0);
+            json.add("warnPct", oiler.tankWarningThresholdPercent);
+            json.endObject();
+            json.endObject();
+        }
+        report("Status JSON", iterations, BenchClock::now() - start);
+        printf("  %zu bytes/refresh (landing page: %zu bytes)\n", sink.bytes / iterations, strlen(htmlLanding));
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned long iterations = 200000;
+    if (argc > 1) iterations = strtoul(argv[1], NULL, 10);
+    if (iterations == 0) iterations = 1;
+
+    HostHal::setSerialMuted(true);
+    HostHal::setTempC(12.0);
+
+    static Oiler oiler;
+    static AuxManager aux;
+    webConsole.begin();
+    oiler.begin();
+    aux.begin(&oiler.imu);
+
+    // Skip the Aux start delay and the startup distance
+    HostHal::advanceMillis(60000);
+
+    benchUpdate(oiler, iterations);
+    benchLoop(oiler, iterations);
+    benchAux(aux, iterations);
+    benchSettings(oiler, iterations / 1000);
+    benchScheduler(oiler, iterations / 100);
+    benchLogLine(oiler, iterations);
+    benchLogAlignment(iterations / 10);
+    benchHighRate(iterations);
+    benchPage(oiler, iterations / 100);
+    benchJson(oiler, iterations / 100);
+    return 0;
+}
@@ -0,0 +1,43 @@
+#ifndef HOST_ADAFRUIT_BNO08X_H
+#define HOST_ADAFRUIT_BNO08X_H
+
+// BNO085 for host builds. Reports come from HostHal (setImuQuaternion / setImuLinearAccel).
+
+#include "Arduino.h"
+
+#define SH2_LINEAR_ACCELERATION 0x04
+#define SH2_ARVR_STABILIZED_RV 0x28
+
+typedef struct {
+    float real;
+    float i;
+    float j;
+    float k;
+    float accuracy;
+} sh2_RotationVectorWAcc_t;
+
+typedef struct {
+    float x;
+    float y;
+    float z;
+} sh2_Accelerometer_t;
+
+typedef struct {
+    uint8_t sensorId;
+    uint8_t status;
+    uint64_t timestamp;
+    union {
+        sh2_RotationVectorWAcc_t arvrStabilizedRV;
+        sh2_Accelerometer_t linearAcceleration;
+    } un;
+} sh2_SensorValue_t;
+
+class Adafruit_BNO08x {
+public:
+    bool begin_I2C(uint8_t i2c_addr = 0x4A);
+    bool enableReport(uint8_t sensorId, uint32_t interval_us = 10000);
+    bool wasReset() { return false; }
+    bool getSensorEvent(sh2_SensorValue_t* value);
+};
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal Arduino core for host builds (see HostHal.h).
+// Only the API surface used by the firmware modules is provided.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <cmath>
+#include <string>
+#include <algorithm>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define radians(deg) ((deg)*DEG_TO_RAD)
+#define degrees(rad) ((rad)*RAD_TO_DEG)
+#define sq(x) ((x)*(x))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+#define PROGMEM
+#define F(str) (str)
+#define IRAM_ATTR
+
+using std::abs;
+using std::min;
+using std::max;
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+// --- Time (virtual clock, see HostHal) ---
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// --- GPIO ---
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+
+// --- LEDC PWM (Arduino-ESP32 2.x API) ---
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t resolution_bits);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+
+// --- String ---
+class String {
+public:
+    String() {}
+    String(const char* cstr) : _s(cstr ? cstr : "") {}
+    String(const std::string& s) : _s(s) {}
+    explicit String(char c) : _s(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(float value, unsigned char decimalPlaces = 2);
+    explicit String(double value, unsigned char decimalPlaces = 2);
+
+    unsigned int length() const { return (unsigned int)_s.length(); }
+    bool isEmpty() const { return _s.empty(); }
+    const char* c_str() const { return _s.c_str(); }
+    bool reserve(unsigned int size) { _s.reserve(size); return true; }
+
+    String& operator+=(const String& rhs) { _s += rhs._s; return *this; }
+    String& operator+=(const char* rhs) { if (rhs) _s += rhs; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+    bool concat(const String& rhs) { _s += rhs._s; return true; }
+
+    bool operator==(const String& rhs) const { return _s == rhs._s; }
+    bool operator==(const char* rhs) const { return _s == (rhs ? rhs : ""); }
+    bool operator!=(const String& rhs) const { return _s != rhs._s; }
+    bool operator!=(const char* rhs) const { return !(*this == rhs); }
+    bool operator<(const String& rhs) const { return _s < rhs._s; }
+    char operator[](unsigned int index) const { return index < _s.length() ? _s[index] : 0; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.length(), prefix._s) == 0; }
+    bool endsWith(const String& suffix) const;
+    int indexOf(char c, unsigned int fromIndex = 0) const;
+    int indexOf(const String& str, unsigned int fromIndex = 0) const;
+    String substring(unsigned int beginIndex) const;
+    String substring(unsigned int beginIndex, unsigned int endIndex) const;
+    void replace(const String& find, const String& replace);
+    void trim();
+    void toUpperCase();
+    void toLowerCase();
+    long toInt() const { return atol(_s.c_str()); }
+    float toFloat() const { return (float)atof(_s.c_str()); }
+    double toDouble() const { return atof(_s.c_str()); }
+
+    const std::string& str() const { return _s; }
+
+private:
+    std::string _s;
+};
+
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char* rhs);
+String operator+(const char* lhs, const String& rhs);
+String operator+(const String& lhs, char rhs);
+String operator+(const String& lhs, int rhs);
+String operator+(const String& lhs, unsigned int rhs);
+String operator+(const String& lhs, long rhs);
+String operator+(const String& lhs, unsigned long rhs);
+String operator+(const String& lhs, float rhs);
+String operator+(const String& lhs, double rhs);
+
+// --- Print (byte sink, e.g. an SD File on the device) ---
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    virtual void flush() {}
+
+    size_t print(const char* s);
+    size_t print(const String& s) { return print(s.c_str()); }
+    size_t print(int n) { return print(String(n)); }
+    size_t print(unsigned int n) { return print(String(n)); }
+    size_t print(long n) { return print(String(n)); }
+    size_t print(unsigned long n) { return print(String(n)); }
+    size_t print(double n, int digits = 2) { return print(String(n, (unsigned char)digits)); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+// --- Serial ---
+class HostSerial {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    operator bool() const { return true; }
+    int available() { return 0; }
+    int read() { return -1; }
+    size_t write(uint8_t c);
+    size_t print(const String& s);
+    size_t print(const char* s);
+    size_t print(char c);
+    size_t print(int n);
+    size_t print(unsigned int n);
+    size_t print(long n);
+    size_t print(unsigned long n);
+    size_t print(double n, int digits = 2);
+    size_t println();
+    template <typename T> size_t println(const T& value) { size_t n = print(value); return n + println(); }
+    size_t println(double n, int digits) { size_t c = print(n, digits); return c + println(); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern HostSerial Serial;
+
+// --- ESP ---
+class EspClass {
+public:
+    void restart();
+    uint32_t getFreeHeap() { return 0; }
+};
+
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef HOST_DALLAS_TEMPERATURE_H
+#define HOST_DALLAS_TEMPERATURE_H
+
+// DS18B20 for host builds. Temperature and presence come from HostHal.
+// Conversions take the datasheet time for the resolution on the virtual clock.
+
+#include "Arduino.h"
+#include "OneWire.h"
+
+#define DEVICE_DISCONNECTED_C -127
+
+typedef uint8_t DeviceAddress[8];
+
+class DallasTemperature {
+public:
+    DallasTemperature(OneWire* wire) : _wire(wire), _resolution(12), _waitForConversion(true), _requestUs(0) {}
+
+    void begin() {}
+    uint8_t getDeviceCount();
+    bool getAddress(uint8_t* address, uint8_t index);
+
+    void setResolution(uint8_t resolution);
+    uint8_t getResolution() { return _resolution; }
+    void setWaitForConversion(bool wait) { _waitForConversion = wait; }
+    bool getWaitForConversion() { return _waitForConversion; }
+    int16_t millisToWaitForConversion(uint8_t resolution);
+
+    void requestTemperatures();
+    bool isConversionComplete();
+    float getTempC(const uint8_t* address);
+    float getTempCByIndex(uint8_t index);
+
+private:
+    OneWire* _wire;
+    uint8_t _resolution;
+    bool _waitForConversion;
+    uint64_t _requestUs;
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+// Host Hardware Abstraction Layer
+// The fake Arduino / library headers in host/include route every hardware
+// access (clock, esp_timer, GPIO/PWM/LEDC fade, NVS, flash partitions, WS2812 (RMT),
+// DS18B20, BNO085)
+// through this layer.
+// Host programs (benchmarks, replay tools) use it to drive virtual time and
+// to inject sensor values, and read back what the firmware did.
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace HostHal {
+
+    // --- Clock (virtual, starts at 0) ---
+    uint64_t nowMicros();
+    void setMicros(uint64_t us);
+    void advanceMicros(uint64_t us);
+    void advanceMillis(uint32_t ms);
+
+    // --- GPIO / PWM ---
+    void setPinInput(int pin, int level);   // Level returned by digitalRead()
+    void setAnalogInput(int pin, int value); // Value returned by analogRead()
+    int getPinOutput(int pin);              // Last digitalWrite() level
+    uint32_t getPwmDuty(int channel);       // Current duty (ledcWrite() or LEDC fade)
+
+    // --- Key-Value Store (NVS) ---
+    void clearStore();
+    void clearFlash(); // Journal partition back to 0xFF
+
+    // --- Temperature Sensor (DS18B20) ---
+    void setTempSensorPresent(bool present);
+    void setTempC(float tempC);
+
+    // --- IMU Source (BNO085) ---
+    void setImuPresent(bool present);
+    void setImuQuaternion(float real, float i, float j, float k); // Next rotation vector report
+    void setImuLinearAccel(float x, float y, float z);            // Next linear acceleration report
+
+    // --- LED Strip ---
+    uint32_t getPixel(int index); // Colour as sent by the last rmt_write_sample()
+
+    // --- Counters (for benchmarks) ---
+    struct Counters {
+        uint32_t gpioWrites;   // digitalWrite()
+        uint32_t pwmWrites;    // ledcWrite() / ledc_set_duty_and_update() / ledc_stop()
+        uint32_t pwmFades;     // ledc_set_fade_time_and_start() (hardware ramps)
+        uint32_t storeReads;   // nvs_get_*()
+        uint32_t storeWrites;  // nvs_set_*() calls
+        uint32_t storeChanged; // nvs_set_*() calls that actually changed the stored value
+        uint32_t storeCommits; // nvs_commit()
+        uint32_t flashWrites;  // esp_partition_write()
+        uint32_t flashErases;  // Erased 4 KB sectors
+        uint32_t stripShows;   // LED frames sent (rmt_write_sample())
+        uint32_t tempConversions; // DallasTemperature::requestTemperatures()
+        uint32_t restarts;     // ESP.restart()
+    };
+    Counters& counters();
+    void resetCounters();
+
+    // Silence Serial output (default: on, so benchmarks are not I/O bound)
+    void setSerialMuted(bool muted);
+    bool isSerialMuted();
+
+    // esp_reset_reason() of the next "boot" (esp_reset_reason_t, default ESP_RST_POWERON)
+    void setResetReason(int reason);
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef HOST_ONEWIRE_H
+#define HOST_ONEWIRE_H
+
+#include "Arduino.h"
+
+class OneWire {
+public:
+    OneWire(uint8_t pin) : _pin(pin) {}
+
+private:
+    uint8_t _pin;
+};
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef HOST_DRIVER_LEDC_H
+#define HOST_DRIVER_LEDC_H
+
+// ESP-IDF LEDC fade API (host build, see HostHal.h).
+// Channels 0-7 of LEDC_HIGH_SPEED_MODE are Arduino channels 0-7, LEDC_LOW_SPEED_MODE is 8-15.
+// Fades are evaluated on the virtual clock (HostHal::getPwmDuty()), the fade end
+// callback fires when the clock passes the end of the fade.
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum {
+    LEDC_HIGH_SPEED_MODE = 0,
+    LEDC_LOW_SPEED_MODE,
+    LEDC_SPEED_MODE_MAX
+} ledc_mode_t;
+
+typedef enum {
+    LEDC_CHANNEL_0 = 0,
+    LEDC_CHANNEL_1,
+    LEDC_CHANNEL_2,
+    LEDC_CHANNEL_3,
+    LEDC_CHANNEL_4,
+    LEDC_CHANNEL_5,
+    LEDC_CHANNEL_6,
+    LEDC_CHANNEL_7,
+    LEDC_CHANNEL_MAX
+} ledc_channel_t;
+
+typedef enum {
+    LEDC_FADE_NO_WAIT = 0,
+    LEDC_FADE_WAIT_DONE,
+    LEDC_FADE_MAX
+} ledc_fade_mode_t;
+
+typedef enum {
+    LEDC_FADE_END_EVT
+} ledc_cb_event_t;
+
+typedef struct {
+    ledc_cb_event_t event;
+    uint32_t speed_mode;
+    uint32_t channel;
+    uint32_t duty;
+} ledc_cb_param_t;
+
+typedef bool (*ledc_cb_t)(const ledc_cb_param_t* param, void* user_arg);
+
+typedef struct {
+    ledc_cb_t fade_cb;
+} ledc_cbs_t;
+
+esp_err_t ledc_fade_func_install(int intr_alloc_flags);
+esp_err_t ledc_cb_register(ledc_mode_t speed_mode, ledc_channel_t channel, ledc_cbs_t* cbs, void* user_arg);
+esp_err_t ledc_set_duty_and_update(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t duty, uint32_t hpoint);
+esp_err_t ledc_set_fade_time_and_start(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty, uint32_t max_fade_time_ms, ledc_fade_mode_t fade_mode);
+esp_err_t ledc_stop(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t idle_level);
+
+#endif
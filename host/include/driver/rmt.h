@@ -0,0 +1,66 @@
+#ifndef HOST_DRIVER_RMT_H
+#define HOST_DRIVER_RMT_H
+
+// ESP-IDF RMT TX API (host build, see HostHal.h).
+// rmt_write_sample() runs the translator right away and decodes the items back
+// into bytes for the LED strip (HostHal::getPixel()). A transfer takes 1.25 us
+// per item on the virtual clock.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+typedef int gpio_num_t;
+
+typedef enum {
+    RMT_CHANNEL_0 = 0,
+    RMT_CHANNEL_1,
+    RMT_CHANNEL_2,
+    RMT_CHANNEL_3,
+    RMT_CHANNEL_4,
+    RMT_CHANNEL_5,
+    RMT_CHANNEL_6,
+    RMT_CHANNEL_7,
+    RMT_CHANNEL_MAX
+} rmt_channel_t;
+
+typedef enum {
+    RMT_MODE_TX = 0,
+    RMT_MODE_RX,
+    RMT_MODE_MAX
+} rmt_mode_t;
+
+typedef struct {
+    union {
+        struct {
+            uint32_t duration0 : 15;
+            uint32_t level0 : 1;
+            uint32_t duration1 : 15;
+            uint32_t level1 : 1;
+        };
+        uint32_t val;
+    };
+} rmt_item32_t;
+
+typedef struct {
+    rmt_mode_t rmt_mode;
+    rmt_channel_t channel;
+    gpio_num_t gpio_num;
+    uint8_t clk_div;
+    uint8_t mem_block_num;
+    uint32_t flags;
+} rmt_config_t;
+
+#define RMT_DEFAULT_CONFIG_TX(gpio, channel_id) { RMT_MODE_TX, (channel_id), (gpio), 80, 1, 0 }
+
+typedef void (*sample_to_rmt_t)(const void* src, rmt_item32_t* dest, size_t src_size,
+                                size_t wanted_num, size_t* translated_size, size_t* item_num);
+
+esp_err_t rmt_config(const rmt_config_t* rmt_param);
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rx_buf_size, int intr_alloc_flags);
+esp_err_t rmt_get_counter_clock(rmt_channel_t channel, uint32_t* clock_hz);
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn);
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t* src, size_t src_size, bool wait_tx_done);
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, uint32_t wait_time); // wait_time in ticks (0 = poll)
+
+#endif
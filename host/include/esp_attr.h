@@ -0,0 +1,10 @@
+#ifndef HOST_ESP_ATTR_H
+#define HOST_ESP_ATTR_H
+
+// ESP-IDF section attributes (host build: plain RAM, survives HostHal "restarts")
+
+#define RTC_NOINIT_ATTR
+#define RTC_DATA_ATTR
+#define DRAM_ATTR
+
+#endif
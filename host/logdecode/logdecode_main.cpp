@@ -0,0 +1,208 @@
+// Binary SD log (LOG_BINARY, see TelemetryLog.h) -> CSV with the columns of the text log.
+// Build & run: pio run -e logdecode && .pio/build/logdecode/program log_12.bin [out.csv]
+//
+// The column layout is read from the file header, so logs of older firmware
+// with fewer columns still decode. A record cut off by a power loss ends the
+// output with a warning.
+
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+#include "TelemetryLog.h"
+
+namespace {
+
+    struct Column {
+        std::string name;
+        uint8_t encoding;
+        uint8_t decimals;
+    };
+
+    struct Reader {
+        const std::vector<uint8_t>& data;
+        size_t pos;
+        bool ok;
+
+        explicit Reader(const std::vector<uint8_t>& d) : data(d), pos(0), ok(true) {}
+
+        bool has(size_t n) const { return ok && pos + n <= data.size(); }
+        uint32_t u(int bytes) {
+            if (!has(bytes)) { ok = false; return 0; }
+            uint32_t v = 0;
+            for (int i = 0; i < bytes; i++) v |= (uint32_t)data[pos + i] << (8 * i);
+            pos += bytes;
+            return v;
+        }
+        std::string text() {
+            size_t len = u(1);
+            if (!has(len)) { ok = false; return ""; }
+            std::string s((const char*)&data[pos], len);
+            pos += len;
+            return s;
+        }
+        std::string cstr() {
+            std::string s;
+            while (has(1) && data[pos] != 0) s += (char)data[pos++];
+            if (!has(1)) { ok = false; return s; }
+            pos++;
+            return s;
+        }
+    };
+
+    // Integer -> "%.<decimals>f" of value / 10^decimals, like LogWriter::addFixed()
+    void printFixed(FILE* out, int32_t value, uint8_t decimals) {
+        uint32_t mag = value < 0 ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+        uint32_t scale = 1;
+        for (int i = 0; i < decimals; i++) scale *= 10;
+        fprintf(out, "%s%u", value < 0 ? "-" : "", mag / scale);
+        if (decimals > 0) fprintf(out, ".%0*u", decimals, mag % scale);
+    }
+
+    bool readFile(const char* path, std::vector<uint8_t>& data) {
+        FILE* f = fopen(path, "rb");
+        if (f == NULL) return false;
+        uint8_t buf[4096];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+        fclose(f);
+        return true;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: program <log_N.bin> [out.csv]   (CSV goes to stdout without out.csv)\n");
+        return 1;
+    }
+    std::vector<uint8_t> data;
+    if (!readFile(argv[1], data)) {
+        fprintf(stderr, "Cannot read %s\n", argv[1]);
+        return 1;
+    }
+
+    Reader r(data);
+    if (!r.has(6) || memcmp(&data[0], TELEMETRY_MAGIC, 4) != 0) {
+        fprintf(stderr, "%s is not a binary log\n", argv[1]);
+        return 1;
+    }
+    r.pos = 4;
+    unsigned version = r.u(1);
+    if (version > TELEMETRY_FORMAT_VERSION) {
+        fprintf(stderr, "Format version %u is newer than this tool (%u)\n", version, TELEMETRY_FORMAT_VERSION);
+        return 1;
+    }
+    std::vector<Column> columns(r.u(1));
+    int deltaColumns = 0;
+    bool hasBits = false;
+    for (size_t i = 0; i < columns.size(); i++) {
+        columns[i].encoding = r.u(1);
+        columns[i].decimals = r.u(1);
+        columns[i].name = r.cstr();
+        if (columns[i].encoding > TelemetryLog::ENC_TEXT) {
+            fprintf(stderr, "Unknown encoding %u of column %s\n", columns[i].encoding, columns[i].name.c_str());
+            return 1;
+        }
+        if (columns[i].encoding == TelemetryLog::ENC_DELTA16) deltaColumns++;
+        if (columns[i].encoding == TelemetryLog::ENC_BIT) hasBits = true;
+    }
+    if (!r.ok) {
+        fprintf(stderr, "Header truncated\n");
+        return 1;
+    }
+
+    FILE* out = stdout;
+    if (argc == 3 && (out = fopen(argv[2], "w")) == NULL) {
+        fprintf(stderr, "Cannot write %s\n", argv[2]);
+        return 1;
+    }
+    fprintf(out, "Type,Time_ms");
+    for (size_t i = 0; i < columns.size(); i++) fprintf(out, ",%s", columns[i].name.c_str());
+    fprintf(out, "\n");
+
+    uint32_t timeMs = 0;
+    std::vector<int32_t> base(columns.size(), 0);
+    std::vector<int32_t> values(columns.size(), 0);
+    unsigned long counts[TelemetryLog::REC_TYPE_COUNT] = { 0 };
+    size_t dataBytes = 0;
+    int status = 0;
+
+    while (r.pos < data.size()) {
+        size_t start = r.pos;
+        uint8_t type = r.u(1);
+        if (type >= TelemetryLog::REC_TYPE_COUNT) {
+            fprintf(stderr, "Unknown record type %u at offset %lu, stopping\n", type, (unsigned long)start);
+            status = 2;
+            break;
+        }
+
+        if (type == TelemetryLog::REC_SYNC) {
+            uint32_t t = r.u(4);
+            std::vector<int32_t> b = base;
+            for (size_t i = 0; i < columns.size(); i++) {
+                if (columns[i].encoding == TelemetryLog::ENC_DELTA16) b[i] = (int32_t)r.u(4);
+            }
+            if (!r.ok) break;
+            timeMs = t;
+            base = b;
+            counts[type]++;
+            continue;
+        }
+
+        uint32_t t = timeMs + r.u(2);
+        std::string message;
+        if (type != TelemetryLog::REC_NOTE) {
+            for (size_t i = 0; i < columns.size(); i++) {
+                switch (columns[i].encoding) {
+                    case TelemetryLog::ENC_U8: values[i] = r.u(1); break;
+                    case TelemetryLog::ENC_U16: values[i] = r.u(2); break;
+                    case TelemetryLog::ENC_I16: values[i] = (int16_t)r.u(2); break;
+                    case TelemetryLog::ENC_U32: values[i] = (int32_t)r.u(4); break;
+                    case TelemetryLog::ENC_DELTA16: values[i] = base[i] + (int32_t)r.u(2); break;
+                    default: break;
+                }
+            }
+            if (hasBits) {
+                uint8_t flags = r.u(1);
+                int bit = 0;
+                for (size_t i = 0; i < columns.size(); i++) {
+                    if (columns[i].encoding == TelemetryLog::ENC_BIT) values[i] = (flags >> bit++) & 1;
+                }
+            }
+        }
+        if (type != TelemetryLog::REC_DATA) message = r.text();
+        if (!r.ok) {
+            r.pos = start;
+            break;
+        }
+
+        timeMs = t;
+        counts[type]++;
+        if (type == TelemetryLog::REC_DATA) dataBytes += r.pos - start;
+
+        fprintf(out, "%s,%u", TelemetryLog::typeName((TelemetryLog::RecordType)type), timeMs);
+        for (size_t i = 0; i < columns.size(); i++) {
+            fprintf(out, ",");
+            uint8_t enc = columns[i].encoding;
+            if (enc == TelemetryLog::ENC_TEXT) {
+                fprintf(out, "%s", message.c_str());
+            } else if (type != TelemetryLog::REC_NOTE) {
+                printFixed(out, values[i], columns[i].decimals);
+                if (enc == TelemetryLog::ENC_DELTA16) base[i] = values[i];
+            }
+        }
+        fprintf(out, "\n");
+    }
+    if (!r.ok) fprintf(stderr, "Record at offset %lu is cut off (power loss?), ignored\n", (unsigned long)r.pos);
+
+    fprintf(stderr, "%lu DATA, %lu EVENT, %lu PULSE, %lu SYNC records in %lu bytes",
+            counts[TelemetryLog::REC_DATA], counts[TelemetryLog::REC_EVENT] + counts[TelemetryLog::REC_NOTE],
+            counts[TelemetryLog::REC_PULSE], counts[TelemetryLog::REC_SYNC], (unsigned long)data.size());
+    if (counts[TelemetryLog::REC_DATA] > 0) {
+        fprintf(stderr, ", %.1f bytes per DATA row", (double)dataBytes / counts[TelemetryLog::REC_DATA]);
+    }
+    fprintf(stderr, "\n");
+    if (out != stdout) fclose(out);
+    return status;
+}
@@ -0,0 +1,282 @@
+// Joins the segments of an SD log store (see LogStore.h) back into one file per log.
+// Build & run: pio run -e logextract && .pio/build/logextract/program /media/sd/log [out dir]
+//
+// Every valid segment header names its log number, part and the bytes in
+// use; the parts of a log are concatenated in order, stale data behind the
+// used length is skipped, and so are the copies of the file header that
+// the firmware repeats at the start of every later part. If the first part
+// was recycled, the log starts at the header copy of the oldest part left.
+// Output: <dir name>_<log><ext>, e.g. log_12.csv or hr_12.bin (the latter
+// goes through logdecode next).
+//
+// Options (read the time index of the segments instead of the whole log):
+//   --log N            only log N
+//   --from MS --to MS  only the rows between these uptimes (ms), from the last
+//                      seek point before MS; the file header is kept, so the
+//                      cut still opens in a spreadsheet / logdecode
+//   --events           list the EVENT/PULSE rows of each log, nothing is written
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "LogSegment.h"
+
+namespace {
+
+    struct Segment {
+        std::string path;
+        std::string ext;
+        LogSegmentHeader header;
+        std::vector<LogIndexEntry> index;
+    };
+
+    bool bySeq(const Segment& a, const Segment& b) { return a.header.seq < b.header.seq; }
+
+    bool readHeader(const std::string& path, LogSegmentHeader& h) {
+        FILE* f = fopen(path.c_str(), "rb");
+        if (f == NULL) return false;
+        bool ok = fread(&h, sizeof(h), 1, f) == 1 && h.isValid();
+        fclose(f);
+        return ok;
+    }
+
+    bool readIndex(Segment& s) {
+        FILE* f = fopen(s.path.c_str(), "rb");
+        if (f == NULL) return false;
+        s.index.resize(s.header.indexCount);
+        bool ok = s.index.empty() || (fseek(f, s.header.indexStart(), SEEK_SET) == 0 &&
+                                      fread(&s.index[0], sizeof(LogIndexEntry), s.index.size(), f) == s.index.size());
+        fclose(f);
+        if (!ok) s.index.clear();
+        return ok;
+    }
+
+    // Bytes [from, to) of the whole log that lie in part s. false if the file is short.
+    bool copyPart(const Segment& s, uint32_t from, uint32_t to, FILE* out, uint32_t& copied) {
+        if (from >= to) return true;
+        FILE* f = fopen(s.path.c_str(), "rb");
+        if (f == NULL) return false;
+        uint32_t left = to - from;
+        if (fseek(f, LOG_SEGMENT_HEADER_SIZE + (from - s.header.offset), SEEK_SET) == 0) {
+            char buf[4096];
+            while (left > 0) {
+                size_t n = fread(buf, 1, left < sizeof(buf) ? left : sizeof(buf), f);
+                if (n == 0) break;
+                fwrite(buf, 1, n, out);
+                left -= n;
+                copied += n;
+            }
+        }
+        fclose(f);
+        return left == 0;
+    }
+
+    // Bytes [start, end) of the whole log from the parts that still exist,
+    // without the header copies. complete = false if a file is shorter than its header says.
+    uint32_t copyRange(const std::vector<Segment>& parts, uint32_t start, uint32_t end, FILE* out, bool* complete = NULL) {
+        uint32_t copied = 0;
+        for (size_t i = 0; i < parts.size(); i++) {
+            const LogSegmentHeader& h = parts[i].header;
+            uint32_t from = std::max(start, h.offset);
+            uint32_t to = std::min(end, h.offset + h.length);
+            if (from >= to) continue;
+            bool ok;
+            if (h.headerLength > 0) {
+                uint32_t copyEnd = h.headerOffset + h.headerLength;
+                ok = copyPart(parts[i], from, std::min(to, h.headerOffset), out, copied);
+                ok = copyPart(parts[i], std::max(from, copyEnd), to, out, copied) && ok;
+            } else {
+                ok = copyPart(parts[i], from, to, out, copied);
+            }
+            if (!ok && complete != NULL) {
+                fprintf(stderr, "%s is shorter than its header says\n", parts[i].path.c_str());
+                *complete = false;
+            }
+        }
+        return copied;
+    }
+
+    // The file header of a log whose first part is gone: the copy in the oldest part left
+    uint32_t copyHeader(const Segment& s, FILE* out) {
+        uint32_t copied = 0;
+        const LogSegmentHeader& h = s.header;
+        uint32_t end = std::min(h.headerOffset + h.headerLength, h.offset + h.length);
+        copyPart(s, h.headerOffset, end, out, copied);
+        return copied;
+    }
+
+    // One text line (CSV log) at offset, for --events
+    std::string lineAt(const std::vector<Segment>& parts, uint32_t offset) {
+        for (size_t i = 0; i < parts.size(); i++) {
+            const LogSegmentHeader& h = parts[i].header;
+            if (offset < h.offset || offset >= h.offset + h.length) continue;
+            std::string line;
+            FILE* f = fopen(parts[i].path.c_str(), "rb");
+            if (f == NULL) return line;
+            fseek(f, LOG_SEGMENT_HEADER_SIZE + (offset - h.offset), SEEK_SET);
+            int c;
+            while (line.size() < 300 && (c = fgetc(f)) != EOF && c != '\n') line += (char)c;
+            fclose(f);
+            return line;
+        }
+        return "";
+    }
+
+    // Cuts [fromMs, toMs] out of a log using the index. Returns bytes written, -1 without seek points.
+    long extractWindow(const std::vector<Segment>& parts, uint32_t fromMs, uint32_t toMs, FILE* out) {
+        std::vector<LogIndexEntry> entries;
+        for (size_t i = 0; i < parts.size(); i++) entries.insert(entries.end(), parts[i].index.begin(), parts[i].index.end());
+        if (entries.empty()) return -1;
+
+        const LogSegmentHeader& last = parts.back().header;
+        uint32_t logEnd = last.offset + last.length;
+        uint32_t start = entries[0].offset & ~LOG_INDEX_EVENT;
+        uint32_t end = logEnd;
+        for (size_t i = 0; i < entries.size(); i++) {
+            uint32_t offset = entries[i].offset & ~LOG_INDEX_EVENT;
+            if (entries[i].timeMs <= fromMs) start = offset;
+            if (entries[i].timeMs > toMs) {
+                end = offset;
+                break;
+            }
+        }
+        if (end > logEnd) end = logEnd; // Seek point of a row that was still buffered
+
+        // The file header (CSV column line / binary schema and config notes)
+        // comes before the first seek point, or from the oldest part's copy
+        long bytes = 0;
+        const LogSegmentHeader& first = parts[0].header;
+        if (first.part == 0) {
+            uint32_t headerEnd = parts[0].index.empty() ? 0 : parts[0].index[0].offset & ~LOG_INDEX_EVENT;
+            if (start > headerEnd) bytes += copyRange(parts, 0, headerEnd, out);
+        } else if (first.headerLength > 0) {
+            bytes += copyHeader(parts[0], out);
+            start = std::max(start, first.headerOffset + first.headerLength); // Rows before it lack their start
+        }
+        if (start < end) bytes += copyRange(parts, start, end, out);
+        return bytes;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> args;
+    long onlyLog = -1;
+    long fromMs = -1, toMs = -1;
+    bool events = false;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "--log" && i + 1 < argc) onlyLog = strtol(argv[++i], NULL, 10);
+        else if (a == "--from" && i + 1 < argc) fromMs = strtol(argv[++i], NULL, 10);
+        else if (a == "--to" && i + 1 < argc) toMs = strtol(argv[++i], NULL, 10);
+        else if (a == "--events") events = true;
+        else args.push_back(a);
+    }
+    bool window = fromMs >= 0 || toMs >= 0;
+    if (args.empty() || args.size() > 2) {
+        fprintf(stderr, "Usage: program [--log N] [--from MS] [--to MS] [--events] <segment dir, e.g. /media/sd/log> [out dir]\n");
+        return 1;
+    }
+    if (fromMs < 0) fromMs = 0;
+    if (toMs < 0) toMs = 0xFFFFFFFFL;
+    std::string dir = args[0];
+    while (dir.size() > 1 && dir[dir.size() - 1] == '/') dir.erase(dir.size() - 1);
+    std::string outDir = args.size() == 2 ? args[1] : ".";
+    size_t slash = dir.find_last_of('/');
+    std::string prefix = (slash == std::string::npos ? dir : dir.substr(slash + 1)) + "_";
+
+    DIR* d = opendir(dir.c_str());
+    if (d == NULL) {
+        fprintf(stderr, "Cannot open %s\n", dir.c_str());
+        return 1;
+    }
+    std::map<uint32_t, std::vector<Segment> > logs;
+    unsigned unused = 0;
+    for (struct dirent* e = readdir(d); e != NULL; e = readdir(d)) {
+        std::string name = e->d_name;
+        size_t dot = name.find('.');
+        if (dot != 3 || name.compare(0, 3, "000") < 0 || name.compare(0, 3, "999") > 0) continue; // NNN.ext only
+        Segment s;
+        s.path = dir + "/" + name;
+        s.ext = name.substr(dot);
+        if (!readHeader(s.path, s.header)) {
+            unused++; // Pre-allocated, not written yet (or an older format)
+            continue;
+        }
+        if (onlyLog >= 0 && s.header.log != (uint32_t)onlyLog) continue;
+        if ((window || events) && !readIndex(s)) fprintf(stderr, "%s: index unreadable\n", s.path.c_str());
+        logs[s.header.log].push_back(s);
+    }
+    closedir(d);
+
+    int status = 0;
+    for (std::map<uint32_t, std::vector<Segment> >::iterator it = logs.begin(); it != logs.end(); ++it) {
+        std::vector<Segment>& parts = it->second;
+        std::sort(parts.begin(), parts.end(), bySeq);
+
+        if (events) {
+            printf("Log %u:\n", it->first);
+            bool text = parts[0].ext == ".csv";
+            for (size_t i = 0; i < parts.size(); i++) {
+                for (size_t j = 0; j < parts[i].index.size(); j++) {
+                    const LogIndexEntry& e = parts[i].index[j];
+                    if (!(e.offset & LOG_INDEX_EVENT)) continue;
+                    if (text) printf("  %s\n", lineAt(parts, e.offset & ~LOG_INDEX_EVENT).c_str());
+                    else printf("  %u ms at byte %u\n", e.timeMs, e.offset & ~LOG_INDEX_EVENT);
+                }
+            }
+            continue;
+        }
+
+        char name[48];
+        if (window) snprintf(name, sizeof(name), "%s%u_%ld-%ld", prefix.c_str(), it->first, fromMs, toMs);
+        else snprintf(name, sizeof(name), "%s%u", prefix.c_str(), it->first);
+        std::string path = outDir + "/" + name + parts[0].ext;
+
+        FILE* out = fopen(path.c_str(), "wb");
+        if (out == NULL) {
+            fprintf(stderr, "Cannot write %s\n", path.c_str());
+            return 1;
+        }
+        if (window) {
+            long bytes = extractWindow(parts, fromMs, toMs, out);
+            fclose(out);
+            if (bytes < 0) {
+                fprintf(stderr, "%s: no time index (older firmware), extract the whole log instead\n", path.c_str());
+                remove(path.c_str());
+                status = 2;
+            } else {
+                printf("%s: %ld bytes\n", path.c_str(), bytes);
+            }
+            continue;
+        }
+        // Parts recycled by newer logs are gone: read from the header copy of the oldest one left
+        const LogSegmentHeader& first = parts[0].header;
+        const LogSegmentHeader& last = parts.back().header;
+        unsigned long bytes = 0;
+        uint32_t start = first.offset;
+        const char* note = "";
+        if (first.part != 0 && first.headerLength > 0) {
+            bytes += copyHeader(parts[0], out);
+            start = first.headerOffset + first.headerLength;
+            note = " (beginning recycled, read from the header copy)";
+        } else if (first.part != 0) {
+            note = " (beginning recycled)";
+        } else if (last.part != parts.size() - 1) {
+            note = " (parts missing)";
+        }
+        bool complete = true;
+        bytes += copyRange(parts, start, last.offset + last.length, out, &complete);
+        if (!complete) status = 2;
+        fclose(out);
+
+        printf("%s: %u part(s), %lu bytes%s\n", path.c_str(), (unsigned)parts.size(), bytes, note);
+    }
+    printf("%u log(s), %u unused segment(s)\n", (unsigned)logs.size(), unused);
+    return status;
+}
@@ -0,0 +1,278 @@
+// NMEA trace replay through the firmware ingest path in accelerated virtual time.
+// Build & run: pio run -e replay && .pio/build/replay/program ride.nmea [options]
+//
+// The GPS task and the loop of main.cpp are reproduced on the virtual clock:
+//   GPS task:  GpsIngest::encode(burst) -> publish() at the arrival time
+//   loop pass: GpsIngest::process() -> Oiler::loop(), every --loop-ms
+// Sentences are timed by the UTC time of the RMC/GGA epoch they belong to,
+// so gaps in the recording (tunnels, cold starts) play out like on the bike.
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HostHal.h"
+#include "Oiler.h"
+#include "GpsIngest.h"
+#include "BootTimeline.h"
+#include "WebConsole.h"
+
+namespace {
+
+    typedef std::chrono::steady_clock WallClock;
+
+    const unsigned long BOOT_OFFSET_MS = 5000;  // Virtual uptime when the trace starts
+    const long DAY_MS = 24L * 3600L * 1000L;
+
+    struct Sentence {
+        std::string text;        // Including "\r\n"
+        unsigned long arrivalMs; // Relative to the first epoch
+    };
+
+    struct Options {
+        const char* path;
+        unsigned long loopMs;
+        unsigned long stallMs;
+        unsigned long stallEveryMs;
+        bool expectKm;
+        double expectedKm;
+        double toleranceKm;
+        bool expectOilings;
+        unsigned long expectedOilings;
+    };
+
+    void usage() {
+        fprintf(stderr,
+            "Usage: program <trace.nmea|-> [options]\n"
+            "  --loop-ms N          Virtual loop period (default 10, like main.cpp)\n"
+            "  --stall-ms N         Block one loop pass for N ms ...\n"
+            "  --stall-every N      ... every N ms (default 10000), e.g. SD card or web page\n"
+            "  --expect-km X        Exit 2 if the odometer differs from X ...\n"
+            "  --tolerance-km X     ... by more than X (default 0.01)\n"
+            "  --expect-oilings N   Exit 2 if the number of oil events differs from N\n");
+    }
+
+    bool parseOptions(int argc, char** argv, Options& opt) {
+        opt.path = NULL;
+        opt.loopMs = 10;
+        opt.stallMs = 0;
+        opt.stallEveryMs = 10000;
+        opt.expectKm = false;
+        opt.expectedKm = 0.0;
+        opt.toleranceKm = 0.01;
+        opt.expectOilings = false;
+        opt.expectedOilings = 0;
+
+        for (int i = 1; i < argc; i++) {
+            const char* arg = argv[i];
+            bool hasValue = (i + 1 < argc);
+            if (strcmp(arg, "--loop-ms") == 0 && hasValue) opt.loopMs = strtoul(argv[++i], NULL, 10);
+            else if (strcmp(arg, "--stall-ms") == 0 && hasValue) opt.stallMs = strtoul(argv[++i], NULL, 10);
+            else if (strcmp(arg, "--stall-every") == 0 && hasValue) opt.stallEveryMs = strtoul(argv[++i], NULL, 10);
+            else if (strcmp(arg, "--expect-km") == 0 && hasValue) { opt.expectKm = true; opt.expectedKm = atof(argv[++i]); }
+            else if (strcmp(arg, "--tolerance-km") == 0 && hasValue) opt.toleranceKm = atof(argv[++i]);
+            else if (strcmp(arg, "--expect-oilings") == 0 && hasValue) { opt.expectOilings = true; opt.expectedOilings = strtoul(argv[++i], NULL, 10); }
+            else if (arg[0] == '-' && arg[1] == '-') return false;
+            else opt.path = arg;
+        }
+        if (opt.loopMs == 0) opt.loopMs = 1;
+        if (opt.stallEveryMs == 0) opt.stallEveryMs = 1;
+        return opt.path != NULL;
+    }
+
+    // UTC time of day in ms from the time field of RMC/GGA, -1 for other sentences
+    long epochTimeMs(const std::string& line) {
+        if (line.size() < 7 || line[0] != '$') return -1;
+        bool rmc = line.compare(3, 3, "RMC") == 0;
+        bool gga = line.compare(3, 3, "GGA") == 0;
+        if (!rmc && !gga) return -1;
+
+        size_t field = line.find(',');
+        if (field == std::string::npos || line.size() < field + 7) return -1;
+        const char* t = line.c_str() + field + 1;
+        for (int i = 0; i < 6; i++) {
+            if (t[i] < '0' || t[i] > '9') return -1;
+        }
+        long hh = (t[0] - '0') * 10 + (t[1] - '0');
+        long mm = (t[2] - '0') * 10 + (t[3] - '0');
+        long ss = (t[4] - '0') * 10 + (t[5] - '0');
+        long frac = 0;
+        if (t[6] == '.') frac = (long)(atof(t + 6) * 1000.0 + 0.5);
+        return ((hh * 60 + mm) * 60 + ss) * 1000 + frac;
+    }
+
+    bool loadTrace(const char* path, std::vector<Sentence>& trace, size_t& bytes) {
+        FILE* f = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+        if (!f) return false;
+
+        long firstEpoch = -1;
+        long lastEpoch = -1;
+        long dayOffset = 0;
+        unsigned long arrival = 0;
+        char buf[256];
+        bytes = 0;
+
+        while (fgets(buf, sizeof(buf), f)) {
+            std::string line(buf);
+            while (!line.empty() && (line[line.size() - 1] == '\n' || line[line.size() - 1] == '\r')) {
+                line.erase(line.size() - 1);
+            }
+            if (line.empty() || line[0] != '$') continue;
+
+            long epoch = epochTimeMs(line);
+            if (epoch >= 0) {
+                if (lastEpoch >= 0 && epoch + dayOffset < lastEpoch - DAY_MS / 2) dayOffset += DAY_MS; // Midnight
+                epoch += dayOffset;
+                if (firstEpoch < 0) firstEpoch = epoch;
+                // Never go back in time (duplicated or out of order epochs)
+                if (epoch - firstEpoch > (long)arrival) arrival = (unsigned long)(epoch - firstEpoch);
+                lastEpoch = epoch;
+            }
+
+            Sentence s;
+            s.text = line + "\r\n";
+            s.arrivalMs = arrival;
+            bytes += s.text.size();
+            trace.push_back(s);
+        }
+        if (f != stdin) fclose(f);
+        return true;
+    }
+
+    void formatDuration(unsigned long ms, char* out, size_t len) {
+        unsigned long s = ms / 1000;
+        snprintf(out, len, "%02lu:%02lu:%02lu", s / 3600, (s / 60) % 60, s % 60);
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        usage();
+        return 1;
+    }
+
+    std::vector<Sentence> trace;
+    size_t traceBytes = 0;
+    if (!loadTrace(opt.path, trace, traceBytes)) {
+        fprintf(stderr, "Cannot read trace: %s\n", opt.path);
+        return 1;
+    }
+    if (trace.empty()) {
+        fprintf(stderr, "No NMEA sentences in %s\n", opt.path);
+        return 1;
+    }
+
+    HostHal::setSerialMuted(true);
+    HostHal::clearStore();
+    HostHal::setMicros(0);
+
+    static GpsIngest ingest;
+    static Oiler oiler;
+    webConsole.begin();
+    oiler.begin();
+
+    unsigned long fixCount = 0;
+    unsigned long poorCount = 0;
+    unsigned long loopPasses = 0;
+    unsigned long stalls = 0;
+    double producerNs = 0.0; // GpsIngest::encode + publish per burst
+    unsigned long bursts = 0;
+    double consumerNs = 0.0; // GpsIngest::process (incl. Oiler::update) on passes with a fresh fix
+    double maxFixNs = 0.0;
+    double loopNs = 0.0;     // Oiler::loop
+    unsigned long startPumpCycles = oiler.getPumpCycles();
+
+    WallClock::time_point wallStart = WallClock::now();
+    unsigned long now = BOOT_OFFSET_MS;
+    unsigned long nextStall = BOOT_OFFSET_MS + opt.stallEveryMs;
+    HostHal::setMicros((uint64_t)now * 1000);
+
+    size_t next = 0;
+    while (next < trace.size()) {
+        // GPS task: runs on every burst that arrived until now (also during a stalled loop pass)
+        while (next < trace.size() && BOOT_OFFSET_MS + trace[next].arrivalMs <= now) {
+            unsigned long arrival = trace[next].arrivalMs;
+            WallClock::time_point p0 = WallClock::now();
+            while (next < trace.size() && trace[next].arrivalMs == arrival) {
+                const std::string& text = trace[next].text;
+                for (size_t i = 0; i < text.size(); i++) ingest.encode(text[i]);
+                next++;
+            }
+            ingest.publish((uint32_t)((BOOT_OFFSET_MS + arrival) * 1000UL));
+            producerNs += (double)std::chrono::duration_cast<std::chrono::nanoseconds>(WallClock::now() - p0).count();
+            bursts++;
+        }
+
+        // Loop pass
+        WallClock::time_point t0 = WallClock::now();
+        unsigned long freshBefore = ingest.getFreshCount();
+        ingest.process(oiler);
+        bool fresh = ingest.getFreshCount() != freshBefore;
+        if (ingest.isSignalPoor()) poorCount++;
+
+        WallClock::time_point t1 = WallClock::now();
+        oiler.loop();
+        WallClock::time_point t2 = WallClock::now();
+
+        if (fresh) {
+            double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+            consumerNs += ns;
+            if (ns > maxFixNs) maxFixNs = ns;
+            fixCount++;
+        }
+        loopNs += (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+        loopPasses++;
+
+        now += opt.loopMs;
+        if (opt.stallMs > 0 && now >= nextStall) {
+            now += opt.stallMs;
+            nextStall += opt.stallEveryMs;
+            stalls++;
+        }
+        HostHal::setMicros((uint64_t)now * 1000);
+    }
+
+    double wallSec = std::chrono::duration_cast<std::chrono::duration<double> >(WallClock::now() - wallStart).count();
+    unsigned long simulatedMs = now - BOOT_OFFSET_MS;
+    unsigned long oilEvents = oiler.getPumpCycles() - startPumpCycles;
+    char simText[24];
+    formatDuration(simulatedMs, simText, sizeof(simText));
+
+    printf("Trace:        %s (%lu sentences, %lu bytes)\n", opt.path, (unsigned long)trace.size(), (unsigned long)traceBytes);
+    const GpsFix& last = ingest.getLastFix();
+    printf("NMEA:         %lu checksum ok, %lu failed\n", (unsigned long)last.sentencesOk, (unsigned long)last.sentencesFailed);
+    printf("Simulated:    %s in %.3f s wall (%.0fx real time)\n", simText, wallSec, wallSec > 0 ? (simulatedMs / 1000.0) / wallSec : 0.0);
+    printf("Fixes:        %lu fresh of %lu Oiler::update() calls, %lu loop passes with poor signal\n", ingest.getFreshCount(), ingest.getUpdateCount(), poorCount);
+    printf("Queue:        %lu fixes published, %lu dropped, %lu loop stalls of %lu ms\n",
+        (unsigned long)ingest.getPublishedCount(), (unsigned long)ingest.getDroppedCount(), stalls, opt.stallMs);
+    printf("Latency:      avg %.1f ms, max %.1f ms (fix received -> Oiler::update, virtual time)\n",
+        ingest.getLatencyAvgUs() / 1000.0, ingest.getLatencyMaxUs() / 1000.0);
+    printf("First fix:    %.1f s, Oiler::update %.1f s after start (boot timeline, virtual time)\n",
+        bootTimeline.getFirstFixMs() / 1000.0, bootTimeline.getFirstUpdateMs() / 1000.0);
+    printf("CPU per fix:  GPS task avg %.2f us (encode + publish), loop avg %.2f us, max %.2f us (process + Oiler::update)\n",
+        bursts ? producerNs / bursts / 1000.0 : 0.0, fixCount ? consumerNs / fixCount / 1000.0 : 0.0, maxFixNs / 1000.0);
+    printf("CPU per loop: avg %.3f us over %lu passes (Oiler::loop)\n", loopPasses ? loopNs / loopPasses / 1000.0 : 0.0, loopPasses);
+    printf("Distance:     %.3f km\n", oiler.getOdometer());
+    printf("Oil events:   %lu\n", oilEvents);
+    printf("Final state:  progress %.1f %%, target %.2f km, speed %.1f km/h, emergency %s, rain %s, tank %.1f ml\n",
+        oiler.getCurrentProgress() * 100.0, oiler.getCurrentTargetDistance(), oiler.getSmoothedSpeed(),
+        oiler.isEmergencyMode() ? "ON" : "OFF", oiler.isRainMode() ? "ON" : "OFF", oiler.currentTankLevelMl);
+
+    int result = 0;
+    if (opt.expectKm) {
+        double diff = oiler.getOdometer() - opt.expectedKm;
+        if (diff < 0) diff = -diff;
+        if (diff > opt.toleranceKm) {
+            printf("FAIL: distance %.3f km, expected %.3f +/- %.3f km\n", oiler.getOdometer(), opt.expectedKm, opt.toleranceKm);
+            result = 2;
+        }
+    }
+    if (opt.expectOilings && oilEvents != opt.expectedOilings) {
+        printf("FAIL: %lu oil events, expected %lu\n", oilEvents, opt.expectedOilings);
+        result = 2;
+    }
+    return result;
+}
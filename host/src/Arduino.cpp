@@ -0,0 +1,168 @@
+#include "Arduino.h"
+#include "HostHal.h"
+
+HostSerial Serial;
+EspClass ESP;
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+void yield() {
+}
+
+// --- String ---
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base) {
+    if (base < 2 || base > 36) base = 10;
+    char buf[72];
+    int pos = sizeof(buf) - 1;
+    buf[pos] = '\0';
+    do {
+        int digit = (int)(value % base);
+        buf[--pos] = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        value /= base;
+    } while (value > 0 && pos > 1);
+    if (negative) buf[--pos] = '-';
+    return std::string(&buf[pos]);
+}
+
+static std::string formatSigned(long long value, unsigned char base) {
+    // Like Arduino: negative sign only in base 10, two's complement otherwise
+    if (base == 10 && value < 0) return formatInteger((unsigned long long)(-value), true, base);
+    return formatInteger((unsigned long long)value, false, base);
+}
+
+static std::string formatFloat(double value, unsigned char decimalPlaces) {
+    if (std::isnan(value)) return "nan";
+    if (std::isinf(value)) return "inf";
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimalPlaces, value);
+    return std::string(buf);
+}
+
+String::String(unsigned char value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+String::String(int value, unsigned char base) : _s(formatSigned(value, base)) {}
+String::String(unsigned int value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+String::String(long value, unsigned char base) : _s(formatSigned(value, base)) {}
+String::String(unsigned long value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+String::String(float value, unsigned char decimalPlaces) : _s(formatFloat(value, decimalPlaces)) {}
+String::String(double value, unsigned char decimalPlaces) : _s(formatFloat(value, decimalPlaces)) {}
+
+bool String::endsWith(const String& suffix) const {
+    if (suffix._s.length() > _s.length()) return false;
+    return _s.compare(_s.length() - suffix._s.length(), suffix._s.length(), suffix._s) == 0;
+}
+
+int String::indexOf(char c, unsigned int fromIndex) const {
+    size_t pos = _s.find(c, fromIndex);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& str, unsigned int fromIndex) const {
+    size_t pos = _s.find(str._s, fromIndex);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int beginIndex) const {
+    if (beginIndex >= _s.length()) return String();
+    return String(_s.substr(beginIndex));
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+    if (beginIndex > endIndex) std::swap(beginIndex, endIndex);
+    if (beginIndex >= _s.length()) return String();
+    if (endIndex > _s.length()) endIndex = _s.length();
+    return String(_s.substr(beginIndex, endIndex - beginIndex));
+}
+
+void String::replace(const String& find, const String& replace) {
+    if (find._s.empty()) return;
+    size_t pos = 0;
+    while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+        _s.replace(pos, find._s.length(), replace._s);
+        pos += replace._s.length();
+    }
+}
+
+void String::trim() {
+    size_t begin = _s.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) { _s.clear(); return; }
+    size_t end = _s.find_last_not_of(" \t\r\n");
+    _s = _s.substr(begin, end - begin + 1);
+}
+
+void String::toUpperCase() {
+    for (size_t i = 0; i < _s.length(); i++) _s[i] = (char)toupper((unsigned char)_s[i]);
+}
+
+void String::toLowerCase() {
+    for (size_t i = 0; i < _s.length(); i++) _s[i] = (char)tolower((unsigned char)_s[i]);
+}
+
+String operator+(const String& lhs, const String& rhs) { String s(lhs); s += rhs; return s; }
+String operator+(const String& lhs, const char* rhs) { String s(lhs); s += rhs; return s; }
+String operator+(const char* lhs, const String& rhs) { String s(lhs); s += rhs; return s; }
+String operator+(const String& lhs, char rhs) { String s(lhs); s += rhs; return s; }
+String operator+(const String& lhs, int rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, unsigned int rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, long rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, unsigned long rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, float rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, double rhs) { return lhs + String(rhs); }
+
+// --- Serial ---
+
+size_t Print::print(const char* s) {
+    if (!s) return 0;
+    return write((const uint8_t*)s, strlen(s));
+}
+
+size_t Print::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    if (len >= (int)sizeof(buffer)) len = sizeof(buffer) - 1;
+    return write((const uint8_t*)buffer, len);
+}
+
+size_t HostSerial::write(uint8_t c) {
+    if (HostHal::isSerialMuted()) return 1;
+    return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HostSerial::print(const char* s) {
+    if (!s) return 0;
+    size_t len = strlen(s);
+    if (HostHal::isSerialMuted()) return len;
+    return fwrite(s, 1, len, stdout);
+}
+
+size_t HostSerial::print(const String& s) { return print(s.c_str()); }
+size_t HostSerial::print(char c) { return write((uint8_t)c); }
+size_t HostSerial::print(int n) { return print(String(n)); }
+size_t HostSerial::print(unsigned int n) { return print(String(n)); }
+size_t HostSerial::print(long n) { return print(String(n)); }
+size_t HostSerial::print(unsigned long n) { return print(String(n)); }
+size_t HostSerial::print(double n, int digits) { return print(String(n, (unsigned char)digits)); }
+size_t HostSerial::println() { return print("\r\n"); }
+
+size_t HostSerial::printf(const char* format, ...) {
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    return print(buffer);
+}
+
+// --- ESP ---
+
+void EspClass::restart() {
+    // No reset on the host: the caller keeps running, the counter tells the harness
+    HostHal::counters().restarts++;
+}
@@ -0,0 +1,331 @@
+// Host implementations of the peripheral libraries (NVS, flash partition, WS2812 via RMT,
+// DS18B20, BNO085)
+
+#include "HostHal.h"
+#include <nvs.h>
+#include <esp_partition.h>
+#include <driver/rmt.h>
+#include "DallasTemperature.h"
+#include "Adafruit_BNO08x.h"
+#include <map>
+#include <vector>
+#include <string.h>
+
+namespace {
+    typedef std::vector<uint8_t> Blob;
+    std::map<std::string, std::map<std::string, Blob> > store;
+
+    const uint32_t JOURNAL_SIZE = 0x10000; // As in partitions.csv
+    Blob journalFlash(JOURNAL_SIZE, 0xFF);
+
+    std::vector<uint32_t> shownPixels;
+    sample_to_rmt_t rmtTranslator = NULL;
+    uint64_t rmtBusyUntilUs = 0;
+
+    bool tempPresent = true;
+    float tempC = 25.0;
+
+    bool imuPresent = false;
+    bool quatPending = false;
+    bool accelPending = false;
+    sh2_RotationVectorWAcc_t pendingQuat = {1.0, 0.0, 0.0, 0.0, 0.0};
+    sh2_Accelerometer_t pendingAccel = {0.0, 0.0, 0.0};
+}
+
+namespace HostHal {
+
+    void clearStore() { store.clear(); }
+    void clearFlash() { journalFlash.assign(JOURNAL_SIZE, 0xFF); }
+
+    void setTempSensorPresent(bool present) { tempPresent = present; }
+    void setTempC(float value) { tempC = value; }
+
+    void setImuPresent(bool present) { imuPresent = present; }
+
+    void setImuQuaternion(float real, float i, float j, float k) {
+        pendingQuat.real = real;
+        pendingQuat.i = i;
+        pendingQuat.j = j;
+        pendingQuat.k = k;
+        quatPending = true;
+    }
+
+    void setImuLinearAccel(float x, float y, float z) {
+        pendingAccel.x = x;
+        pendingAccel.y = y;
+        pendingAccel.z = z;
+        accelPending = true;
+    }
+
+    uint32_t getPixel(int index) {
+        if (index < 0 || index >= (int)shownPixels.size()) return 0;
+        return shownPixels[index];
+    }
+}
+
+// --- NVS ---
+
+namespace {
+    struct NvsHandle {
+        std::string name;
+        bool writable;
+    };
+    std::vector<NvsHandle> nvsHandles; // Handle = index + 1
+
+    NvsHandle* nvsHandle(nvs_handle_t handle) {
+        if (handle == 0 || handle > nvsHandles.size() || nvsHandles[handle - 1].name.empty()) return NULL;
+        return &nvsHandles[handle - 1];
+    }
+
+    esp_err_t nvsSet(nvs_handle_t handle, const char* key, const void* value, size_t len) {
+        HostHal::counters().storeWrites++;
+        NvsHandle* h = nvsHandle(handle);
+        if (h == NULL) return ESP_ERR_NVS_INVALID_HANDLE;
+        if (!h->writable) return ESP_ERR_NVS_READ_ONLY;
+        Blob data((const uint8_t*)value, (const uint8_t*)value + len);
+        Blob& slot = store[h->name][key];
+        if (slot != data) {
+            slot = data;
+            HostHal::counters().storeChanged++;
+        }
+        return ESP_OK;
+    }
+
+    esp_err_t nvsGet(nvs_handle_t handle, const char* key, void* value, size_t len) {
+        HostHal::counters().storeReads++;
+        NvsHandle* h = nvsHandle(handle);
+        if (h == NULL) return ESP_ERR_NVS_INVALID_HANDLE;
+        std::map<std::string, Blob>& ns = store[h->name];
+        std::map<std::string, Blob>::iterator it = ns.find(key);
+        if (it == ns.end()) return ESP_ERR_NVS_NOT_FOUND;
+        if (it->second.size() != len) return ESP_ERR_NVS_INVALID_LENGTH;
+        memcpy(value, &it->second[0], len);
+        return ESP_OK;
+    }
+}
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t open_mode, nvs_handle_t* out_handle) {
+    if (open_mode == NVS_READONLY && store.count(name) == 0) return ESP_ERR_NVS_NOT_FOUND;
+    NvsHandle h;
+    h.name = name;
+    h.writable = open_mode == NVS_READWRITE;
+    store[name]; // Create the namespace
+    nvsHandles.push_back(h);
+    *out_handle = nvsHandles.size();
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+    NvsHandle* h = nvsHandle(handle);
+    if (h != NULL) h->name.clear();
+    while (!nvsHandles.empty() && nvsHandles.back().name.empty()) nvsHandles.pop_back();
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    if (nvsHandle(handle) == NULL) return ESP_ERR_NVS_INVALID_HANDLE;
+    HostHal::counters().storeCommits++;
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle) {
+    NvsHandle* h = nvsHandle(handle);
+    if (h == NULL) return ESP_ERR_NVS_INVALID_HANDLE;
+    if (!h->writable) return ESP_ERR_NVS_READ_ONLY;
+    store[h->name].clear();
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_u8(nvs_handle_t handle, const char* key, uint8_t value) { return nvsSet(handle, key, &value, sizeof(value)); }
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char* key, int32_t value) { return nvsSet(handle, key, &value, sizeof(value)); }
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char* key, uint32_t value) { return nvsSet(handle, key, &value, sizeof(value)); }
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length) { return nvsSet(handle, key, value, length); }
+
+esp_err_t nvs_get_u8(nvs_handle_t handle, const char* key, uint8_t* out_value) { return nvsGet(handle, key, out_value, sizeof(*out_value)); }
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char* key, int32_t* out_value) { return nvsGet(handle, key, out_value, sizeof(*out_value)); }
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char* key, uint32_t* out_value) { return nvsGet(handle, key, out_value, sizeof(*out_value)); }
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out_value, size_t* length) {
+    if (out_value != NULL) return nvsGet(handle, key, out_value, *length);
+    HostHal::counters().storeReads++;
+    NvsHandle* h = nvsHandle(handle);
+    if (h == NULL) return ESP_ERR_NVS_INVALID_HANDLE;
+    std::map<std::string, Blob>& ns = store[h->name];
+    std::map<std::string, Blob>::iterator it = ns.find(key);
+    if (it == ns.end()) return ESP_ERR_NVS_NOT_FOUND;
+    *length = it->second.size();
+    return ESP_OK;
+}
+
+// --- Flash partition ---
+
+namespace {
+    const esp_partition_t journalPartition = {
+        NULL, ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)0x40, 0x3D0000, JOURNAL_SIZE, "journal", false
+    };
+
+    bool inJournal(const esp_partition_t* partition, size_t offset, size_t size) {
+        return partition == &journalPartition && offset + size <= JOURNAL_SIZE;
+    }
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label) {
+    if (type != ESP_PARTITION_TYPE_DATA) return NULL;
+    if (subtype != ESP_PARTITION_SUBTYPE_ANY && subtype != journalPartition.subtype) return NULL;
+    if (label != NULL && strcmp(label, journalPartition.label) != 0) return NULL;
+    return &journalPartition;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t src_offset, void* dst, size_t size) {
+    if (!inJournal(partition, src_offset, size)) return ESP_ERR_INVALID_ARG;
+    memcpy(dst, &journalFlash[src_offset], size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src, size_t size) {
+    if (!inJournal(partition, dst_offset, size)) return ESP_ERR_INVALID_ARG;
+    HostHal::counters().flashWrites++;
+    const uint8_t* in = (const uint8_t*)src;
+    for (size_t i = 0; i < size; i++) journalFlash[dst_offset + i] &= in[i]; // NOR: 1 -> 0 only
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size) {
+    if (!inJournal(partition, offset, size) || offset % 4096 != 0 || size % 4096 != 0) return ESP_ERR_INVALID_ARG;
+    HostHal::counters().flashErases += size / 4096;
+    memset(&journalFlash[offset], 0xFF, size);
+    return ESP_OK;
+}
+
+// --- RMT (WS2812 LED strip) ---
+
+esp_err_t rmt_config(const rmt_config_t* rmt_param) {
+    return rmt_param ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rx_buf_size, int intr_alloc_flags) {
+    (void)channel;
+    (void)rx_buf_size;
+    (void)intr_alloc_flags;
+    return ESP_OK;
+}
+
+esp_err_t rmt_get_counter_clock(rmt_channel_t channel, uint32_t* clock_hz) {
+    (void)channel;
+    *clock_hz = 40000000; // APB 80 MHz / clk_div 2
+    return ESP_OK;
+}
+
+esp_err_t rmt_translator_init(rmt_channel_t channel, sample_to_rmt_t fn) {
+    (void)channel;
+    rmtTranslator = fn;
+    return ESP_OK;
+}
+
+esp_err_t rmt_write_sample(rmt_channel_t channel, const uint8_t* src, size_t src_size, bool wait_tx_done) {
+    (void)channel;
+    if (!rmtTranslator) return ESP_ERR_INVALID_STATE;
+    HostHal::counters().stripShows++;
+
+    // Translate like the driver does, then decode the bits (long high = 1), GRB order
+    std::vector<rmt_item32_t> items(src_size * 8);
+    size_t translated = 0;
+    size_t num = 0;
+    rmtTranslator(src, &items[0], src_size, items.size(), &translated, &num);
+    std::vector<uint8_t> bytes(num / 8, 0);
+    for (size_t i = 0; i < num; i++) {
+        if (items[i].duration0 > items[i].duration1) bytes[i / 8] |= (uint8_t)(0x80 >> (i % 8));
+    }
+    shownPixels.assign(bytes.size() / 3, 0);
+    for (size_t p = 0; p < shownPixels.size(); p++) {
+        shownPixels[p] = ((uint32_t)bytes[p * 3 + 1] << 16) | ((uint32_t)bytes[p * 3] << 8) | bytes[p * 3 + 2];
+    }
+
+    rmtBusyUntilUs = HostHal::nowMicros() + (num * 5) / 4; // 1.25 us per bit
+    if (wait_tx_done) HostHal::advanceMicros(rmtBusyUntilUs - HostHal::nowMicros());
+    return ESP_OK;
+}
+
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, uint32_t wait_time) {
+    (void)channel;
+    (void)wait_time;
+    return HostHal::nowMicros() >= rmtBusyUntilUs ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+// --- DallasTemperature ---
+
+uint8_t DallasTemperature::getDeviceCount() {
+    return tempPresent ? 1 : 0;
+}
+
+bool DallasTemperature::getAddress(uint8_t* address, uint8_t index) {
+    if (!tempPresent || index != 0) return false;
+    static const uint8_t rom[8] = {0x28, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    memcpy(address, rom, sizeof(rom));
+    return true;
+}
+
+void DallasTemperature::setResolution(uint8_t resolution) {
+    if (resolution < 9) resolution = 9;
+    if (resolution > 12) resolution = 12;
+    _resolution = resolution;
+}
+
+int16_t DallasTemperature::millisToWaitForConversion(uint8_t resolution) {
+    switch (resolution) {
+        case 9: return 94;
+        case 10: return 188;
+        case 11: return 375;
+        default: return 750;
+    }
+}
+
+void DallasTemperature::requestTemperatures() {
+    HostHal::counters().tempConversions++;
+    _requestUs = HostHal::nowMicros();
+    if (_waitForConversion) HostHal::advanceMillis(millisToWaitForConversion(_resolution)); // Blocking mode stalls the caller
+}
+
+bool DallasTemperature::isConversionComplete() {
+    return HostHal::nowMicros() - _requestUs >= (uint64_t)millisToWaitForConversion(_resolution) * 1000;
+}
+
+float DallasTemperature::getTempC(const uint8_t* address) {
+    (void)address;
+    if (!tempPresent) return DEVICE_DISCONNECTED_C;
+    return tempC;
+}
+
+float DallasTemperature::getTempCByIndex(uint8_t index) {
+    if (!tempPresent || index != 0) return DEVICE_DISCONNECTED_C;
+    return tempC;
+}
+
+// --- Adafruit_BNO08x ---
+
+bool Adafruit_BNO08x::begin_I2C(uint8_t i2c_addr) {
+    (void)i2c_addr;
+    return imuPresent;
+}
+
+bool Adafruit_BNO08x::enableReport(uint8_t sensorId, uint32_t interval_us) {
+    (void)sensorId;
+    (void)interval_us;
+    return imuPresent;
+}
+
+bool Adafruit_BNO08x::getSensorEvent(sh2_SensorValue_t* value) {
+    if (!imuPresent) return false;
+    if (quatPending) {
+        value->sensorId = SH2_ARVR_STABILIZED_RV;
+        value->un.arvrStabilizedRV = pendingQuat;
+        quatPending = false;
+        return true;
+    }
+    if (accelPending) {
+        value->sensorId = SH2_LINEAR_ACCELERATION;
+        value->un.linearAcceleration = pendingAccel;
+        accelPending = false;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,282 @@
+#include "HostHal.h"
+#include "Arduino.h"
+#include "esp_timer.h"
+#include "driver/ledc.h"
+#include "esp_system.h"
+#include <vector>
+
+namespace {
+    const int MAX_PINS = 40;
+    const int MAX_PWM_CHANNELS = 16;
+
+    uint64_t clockMicros = 0;
+
+    int pinInputs[MAX_PINS];
+    int analogInputs[MAX_PINS];
+    int pinOutputs[MAX_PINS];
+    struct PwmChannel {
+        uint32_t duty;       // Duty at fadeStart (or fixed duty)
+        uint32_t target;     // Fade target
+        uint64_t fadeStart;  // us
+        uint64_t fadeUs;     // 0 = no fade
+        ledc_cb_t fadeCb;    // ledc_cb_register()
+        void* fadeCbArg;
+        esp_timer_handle_t fadeTimer;
+    };
+    PwmChannel pwm[MAX_PWM_CHANNELS];
+    bool pinsInitialized = false;
+
+    HostHal::Counters halCounters;
+    bool serialMuted = false;
+    esp_reset_reason_t resetReason = ESP_RST_POWERON;
+
+    void initPins() {
+        if (pinsInitialized) return;
+        for (int i = 0; i < MAX_PINS; i++) {
+            pinInputs[i] = HIGH; // Buttons are active LOW with pull-ups
+            analogInputs[i] = 0;
+            pinOutputs[i] = LOW;
+        }
+        memset(pwm, 0, sizeof(pwm));
+        pinsInitialized = true;
+    }
+
+    uint32_t currentDuty(const PwmChannel& ch) {
+        if (ch.fadeUs == 0 || clockMicros >= ch.fadeStart + ch.fadeUs) return ch.fadeUs ? ch.target : ch.duty;
+        double f = (double)(clockMicros - ch.fadeStart) / (double)ch.fadeUs;
+        return (uint32_t)((double)ch.duty + ((double)ch.target - (double)ch.duty) * f + 0.5);
+    }
+
+    void setDuty(int channel, uint32_t duty) {
+        initPins();
+        if (channel < 0 || channel >= MAX_PWM_CHANNELS) return;
+        pwm[channel].duty = duty;
+        pwm[channel].target = duty;
+        pwm[channel].fadeUs = 0;
+        if (pwm[channel].fadeTimer) esp_timer_stop(pwm[channel].fadeTimer);
+    }
+
+    void onFadeEnd(void* arg) {
+        int index = (int)(intptr_t)arg;
+        PwmChannel& ch = pwm[index];
+        if (ch.fadeCb == NULL) return;
+        ledc_cb_param_t param;
+        param.event = LEDC_FADE_END_EVT;
+        param.speed_mode = index < 8 ? LEDC_HIGH_SPEED_MODE : LEDC_LOW_SPEED_MODE;
+        param.channel = index % 8;
+        param.duty = ch.target;
+        ch.fadeCb(&param, ch.fadeCbArg);
+    }
+
+    int ledcIndex(ledc_mode_t mode, ledc_channel_t channel) {
+        return (mode == LEDC_LOW_SPEED_MODE ? 8 : 0) + (int)channel;
+    }
+
+    // --- esp_timer ---
+    std::vector<esp_timer*> timers;
+}
+
+struct esp_timer {
+    esp_timer_cb_t callback;
+    void* arg;
+    bool armed;
+    uint64_t due;
+};
+
+namespace {
+    // Moves the clock forward and fires the timers due on the way (in time order)
+    void runClockTo(uint64_t target) {
+        for (;;) {
+            esp_timer* next = NULL;
+            for (size_t i = 0; i < timers.size(); i++) {
+                esp_timer* t = timers[i];
+                if (t->armed && t->due <= target && (next == NULL || t->due < next->due)) next = t;
+            }
+            if (next == NULL) break;
+            if (next->due > clockMicros) clockMicros = next->due;
+            next->armed = false;
+            next->callback(next->arg);
+        }
+        if (target > clockMicros) clockMicros = target;
+    }
+}
+
+namespace HostHal {
+
+    uint64_t nowMicros() { return clockMicros; }
+    void setMicros(uint64_t us) {
+        if (us >= clockMicros) runClockTo(us);
+        else clockMicros = us; // Going back (new run): timers keep their absolute due time
+    }
+    void advanceMicros(uint64_t us) { runClockTo(clockMicros + us); }
+    void advanceMillis(uint32_t ms) { runClockTo(clockMicros + (uint64_t)ms * 1000); }
+
+    void setPinInput(int pin, int level) {
+        initPins();
+        if (pin >= 0 && pin < MAX_PINS) pinInputs[pin] = level;
+    }
+
+    void setAnalogInput(int pin, int value) {
+        initPins();
+        if (pin >= 0 && pin < MAX_PINS) analogInputs[pin] = value;
+    }
+
+    int getPinOutput(int pin) {
+        initPins();
+        return (pin >= 0 && pin < MAX_PINS) ? pinOutputs[pin] : LOW;
+    }
+
+    uint32_t getPwmDuty(int channel) {
+        initPins();
+        return (channel >= 0 && channel < MAX_PWM_CHANNELS) ? currentDuty(pwm[channel]) : 0;
+    }
+
+    Counters& counters() { return halCounters; }
+    void resetCounters() { memset(&halCounters, 0, sizeof(halCounters)); }
+
+    void setSerialMuted(bool muted) { serialMuted = muted; }
+    bool isSerialMuted() { return serialMuted; }
+
+    void setResetReason(int reason) { resetReason = (esp_reset_reason_t)reason; }
+}
+
+esp_reset_reason_t esp_reset_reason(void) { return resetReason; }
+
+// --- Arduino Core ---
+
+unsigned long millis() { return (unsigned long)(clockMicros / 1000); }
+unsigned long micros() { return (unsigned long)clockMicros; }
+void delay(uint32_t ms) { HostHal::advanceMillis(ms); }
+void delayMicroseconds(uint32_t us) { HostHal::advanceMicros(us); }
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+    initPins();
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+    initPins();
+    if (pin < MAX_PINS) pinOutputs[pin] = val;
+    halCounters.gpioWrites++;
+}
+
+int digitalRead(uint8_t pin) {
+    initPins();
+    return pin < MAX_PINS ? pinInputs[pin] : LOW;
+}
+
+uint16_t analogRead(uint8_t pin) {
+    initPins();
+    return pin < MAX_PINS ? (uint16_t)analogInputs[pin] : 0;
+}
+
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t resolution_bits) {
+    (void)channel;
+    (void)resolution_bits;
+    initPins();
+    return freq;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel) {
+    (void)pin;
+    (void)channel;
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty) {
+    setDuty(channel, duty);
+    halCounters.pwmWrites++;
+}
+
+// --- ESP-IDF: LEDC fade ---
+
+esp_err_t ledc_fade_func_install(int intr_alloc_flags) {
+    (void)intr_alloc_flags;
+    return ESP_OK;
+}
+
+esp_err_t ledc_cb_register(ledc_mode_t speed_mode, ledc_channel_t channel, ledc_cbs_t* cbs, void* user_arg) {
+    initPins();
+    PwmChannel& ch = pwm[ledcIndex(speed_mode, channel)];
+    ch.fadeCb = cbs ? cbs->fade_cb : NULL;
+    ch.fadeCbArg = user_arg;
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_duty_and_update(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t duty, uint32_t hpoint) {
+    (void)hpoint;
+    setDuty(ledcIndex(speed_mode, channel), duty);
+    halCounters.pwmWrites++;
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_fade_time_and_start(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty, uint32_t max_fade_time_ms, ledc_fade_mode_t fade_mode) {
+    initPins();
+    int index = ledcIndex(speed_mode, channel);
+    PwmChannel& ch = pwm[index];
+    ch.duty = currentDuty(ch);
+    ch.target = target_duty;
+    ch.fadeStart = clockMicros;
+    ch.fadeUs = (uint64_t)max_fade_time_ms * 1000;
+    halCounters.pwmFades++;
+
+    if (ch.fadeCb != NULL) {
+        if (ch.fadeTimer == NULL) {
+            esp_timer_create_args_t args;
+            args.callback = onFadeEnd;
+            args.arg = (void*)(intptr_t)index;
+            args.dispatch_method = ESP_TIMER_ISR;
+            args.name = "ledc_fade";
+            args.skip_unhandled_events = false;
+            esp_timer_create(&args, &ch.fadeTimer);
+        }
+        esp_timer_stop(ch.fadeTimer);
+        esp_timer_start_once(ch.fadeTimer, ch.fadeUs);
+    }
+    if (fade_mode == LEDC_FADE_WAIT_DONE) HostHal::advanceMicros(ch.fadeUs);
+    return ESP_OK;
+}
+
+esp_err_t ledc_stop(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t idle_level) {
+    (void)idle_level;
+    setDuty(ledcIndex(speed_mode, channel), 0);
+    halCounters.pwmWrites++;
+    return ESP_OK;
+}
+
+// --- ESP-IDF: esp_timer ---
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle) {
+    if (create_args == NULL || out_handle == NULL || create_args->callback == NULL) return ESP_ERR_INVALID_ARG;
+    esp_timer* t = new esp_timer();
+    t->callback = create_args->callback;
+    t->arg = create_args->arg;
+    t->armed = false;
+    t->due = 0;
+    timers.push_back(t);
+    *out_handle = t;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    if (timer == NULL) return ESP_ERR_INVALID_ARG;
+    if (timer->armed) return ESP_ERR_INVALID_STATE;
+    timer->armed = true;
+    timer->due = clockMicros + timeout_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (timer == NULL || !timer->armed) return ESP_ERR_INVALID_STATE;
+    timer->armed = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    if (timer == NULL) return ESP_ERR_INVALID_ARG;
+    timers.erase(std::remove(timers.begin(), timers.end(), timer), timers.end());
+    delete timer;
+    return ESP_OK;
+}
+
+int64_t esp_timer_get_time() { return (int64_t)clockMicros; }
@@ -2,7 +2,8 @@
 #define AUX_MANAGER_H
 
 #include <Arduino.h>
-#include <Preferences.h>
+#include "Persistence.h"
+#include "ConfigRecord.h"
 #include "config.h"
 #include "ImuHandler.h"
 
@@ -43,7 +44,7 @@ public:
 
 private:
     ImuHandler* _imu;
-    Preferences _prefs;
+    PersistStore _prefs;
     AuxMode _mode = AUX_MODE_OFF;
     
     // Pin State
@@ -59,15 +60,15 @@ private:
     
     // Heated Grips Logic
     unsigned long _boostEndTime = 0; // Timestamp when boost ends
-    int _baseLevel = 30;        // 0-100%
+    int _baseLevel = 25;        // 0-100%
     float _speedFactor = 0.5;   // % per km/h
     float _tempFactor = 2.0;    // % per degree below startTemp
     float _tempOffset = 0.0;    // Correction for sensor placement
-    float _startTemp = 15.0;    // Temperature below which compensation starts
+    float _startTemp = 20.0;    // Temperature below which compensation starts
     int _rainBoost = 10;        // % boost in rain mode
-    int _startupBoostLevel = 85;// % for startup
+    int _startupBoostLevel = 100;// % for startup
     int _startupBoostSec = 75;  // Seconds for startup boost
-    int _startDelaySec = 20;    // Seconds delay after start
+    int _startDelaySec = 15;    // Seconds delay after start
     ReactionSpeed _reactionSpeed = REACTION_SLOW;
     
     unsigned long _startTime = 0;
@@ -76,6 +77,27 @@ private:
     void handleHeatedGrips(float speed, float temp, bool rain);
     void setPwm(int percent);
     void calcBoostEndTime();
+
+    // Settings as one NVS record (ConfigRecord.h), only append members
+    struct ConfigData {
+        int32_t mode;
+        int32_t baseLevel;
+        float speedFactor;
+        float tempFactor;
+        float tempOffset;
+        float startTemp;
+        int32_t rainBoost;
+        int32_t startupBoostLevel;
+        int32_t startupBoostSec;
+        int32_t startDelaySec;
+        int32_t reactionSpeed;
+        uint8_t manualOverride;
+    };
+    static const ConfigField CONFIG_FIELDS[];
+    static const int CONFIG_FIELD_COUNT;
+    ConfigRecord<ConfigData> _config;
+    void fillConfig();  // Settings -> record
+    void saveConfig();
 };
 
 #endif
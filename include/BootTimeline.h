@@ -0,0 +1,58 @@
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <Arduino.h>
+
+#define BOOT_TIMELINE_MAX_PHASES 16
+
+// Where boot time goes: setup() (and Oiler::begin) call mark() at the end of
+// each phase, the duration is the time since the previous mark. The first
+// phase ("startup") is everything before setup(): IDF/Arduino init and the
+// global constructors. Probes running in init tasks are added with
+// addBackground(). After setup, the first good GPS fix and the first
+// Oiler::update() with it are recorded once.
+// Loop task only.
+class BootTimeline {
+public:
+    BootTimeline();
+
+    void mark(const char* phase); // phase: string literal
+    void addBackground(const char* phase, uint32_t startUs, uint32_t endUs); // Parallel to setup/loop
+    void setupDone();
+    // A good fix (received at rxMs) was just passed to Oiler::update().
+    // Called for every one, only the first counts.
+    void fixApplied(unsigned long rxMs);
+
+    int getPhaseCount() const { return _count; }
+    const char* getPhaseName(int i) const { return _phases[i].name; }
+    uint32_t getPhaseUs(int i) const { return _phases[i].endUs - _phases[i].startUs; }
+    bool isBackground(int i) const { return _phases[i].background; }
+    uint32_t getSetupUs() const { return _setupDoneUs; } // Power on -> end of setup()
+    unsigned long getFirstFixMs() const { return _firstFixMs; }    // 0 = no fix yet
+    unsigned long getFirstUpdateMs() const { return _firstUpdateMs; }
+
+    // "startup=312.4ms gps=0.8ms ... setup=550.8ms imu=bg:1020.5ms fix=32.1s update=32.1s"
+    // (no commas, fits a CSV field)
+    String format() const;
+
+private:
+    void addPhase(const char* phase, uint32_t startUs, uint32_t endUs, bool background);
+
+    struct Phase {
+        const char* name;
+        uint32_t startUs; // micros()
+        uint32_t endUs;
+        bool background;
+    };
+
+    Phase _phases[BOOT_TIMELINE_MAX_PHASES];
+    int _count;
+    uint32_t _lastMarkUs;
+    uint32_t _setupDoneUs;
+    unsigned long _firstFixMs;
+    unsigned long _firstUpdateMs;
+};
+
+extern BootTimeline bootTimeline;
+
+#endif
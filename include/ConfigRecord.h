@@ -0,0 +1,85 @@
+#ifndef CONFIG_RECORD_H
+#define CONFIG_RECORD_H
+
+#include <Arduino.h>
+#include <stddef.h>
+#include "Persistence.h"
+
+#define CONFIG_RECORD_KEY "cfg"
+
+// Describes one member of a config struct: where it is, since which record
+// version it exists and which single NVS key held it before the record
+// (older firmware). The table is the migration plan for both cases.
+struct ConfigField {
+    const char* legacyKey;  // NULL = field never had its own key
+    Persistence::Type type; // Encoding of the legacy key
+    uint16_t offset;
+    uint16_t size;
+    uint8_t since;          // First record version containing the field
+};
+
+#define CONFIG_FIELD(S, member, legacyKey, type, since) \
+    { legacyKey, Persistence::type, (uint16_t)offsetof(S, member), (uint16_t)sizeof(((S*)0)->member), since }
+
+enum ConfigLoadResult {
+    CONFIG_LOADED,   // Current record
+    CONFIG_UPGRADED, // Older record, new fields have their defaults
+    CONFIG_MIGRATED, // No record: read from the legacy keys
+    CONFIG_DEFAULTS  // Nothing stored at all
+};
+
+struct ConfigHeader {
+    uint16_t version;
+    uint16_t size; // Payload bytes
+    uint32_t crc;  // CRC32 of the payload
+};
+
+class ConfigRecordBase {
+protected:
+    // blob and scratch hold a header plus size payload bytes
+    static ConfigLoadResult load(PersistStore& store, uint16_t version, const ConfigField* fields, int fieldCount,
+                                 uint8_t* blob, uint8_t* scratch, size_t size);
+    static void seal(uint8_t* blob, uint16_t version, size_t size);
+};
+
+// A module's settings as one versioned NVS blob ("cfg") with a CRC:
+// one read and one check at boot instead of a lookup per setting.
+// T must be plain data; new members are only ever appended (with a
+// higher version in the table), so older records stay readable.
+template <typename T>
+class ConfigRecord : private ConfigRecordBase {
+public:
+    ConfigRecord(uint16_t version, const ConfigField* fields, int fieldCount)
+        : _version(version), _fields(fields), _fieldCount(fieldCount) {
+        memset(&_blob, 0, sizeof(_blob));
+    }
+
+    T& data() { return _blob.data; }
+
+    // data() must hold the defaults, fields found in flash overwrite them.
+    // Anything but CONFIG_LOADED should be followed by save().
+    ConfigLoadResult load(PersistStore& store) {
+        Blob stored;
+        return ConfigRecordBase::load(store, _version, _fields, _fieldCount,
+                                      (uint8_t*)&_blob, (uint8_t*)&stored, sizeof(T));
+    }
+    // Staged in the persistence cache, skipped if nothing changed
+    void save(PersistStore& store) {
+        seal((uint8_t*)&_blob, _version, sizeof(T));
+        store.putBytes(CONFIG_RECORD_KEY, &_blob, sizeof(_blob));
+    }
+
+private:
+    struct Blob {
+        ConfigHeader header;
+        T data;
+    };
+    static_assert(offsetof(Blob, data) == sizeof(ConfigHeader), "Payload must follow the header");
+
+    Blob _blob; // Also the buffer the persistence service writes from
+    uint16_t _version;
+    const ConfigField* _fields;
+    int _fieldCount;
+};
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef GPS_INGEST_H
+#define GPS_INGEST_H
+
+#include "config.h"
+#include <TinyGPS++.h>
+#include "Oiler.h"
+#include "SpscQueue.h"
+
+// Snapshot of the decoder state after a batch of NMEA sentences
+struct GpsFix {
+    uint32_t rxMicros;      // micros() when the bytes were taken from the UART
+    bool fresh;             // Location or speed was updated by this batch
+    bool locationValid;
+    double lat;
+    double lng;
+    bool speedValid;
+    float speedKmh;         // Raw GPS speed (not gated)
+    uint32_t sats;
+    float hdop;
+    bool timeValid;
+    bool dateValid;
+    uint8_t hour;           // UTC
+    uint8_t minute;
+    uint8_t day;
+    uint8_t month;
+    uint16_t year;
+    uint32_t sentencesOk;
+    uint32_t sentencesFailed;
+};
+
+// GPS -> Oiler ingest path (shared by main.cpp and the host replay tool)
+//
+// Producer (GPS task): encode() every received byte, then publish() once per
+// batch. Each batch that completed a sentence is queued as a GpsFix.
+// Consumer (loop): process() drains the queue, applies the signal quality
+// gate (Sats/HDOP) and feeds Oiler::update() on fresh fixes, or at least
+// every GPS_UPDATE_TIMEOUT_MS for Emergency Mode.
+class GpsIngest {
+public:
+    GpsIngest();
+
+    // --- Producer side (only one task) ---
+    void encode(char c);
+    // Returns true if a fix was queued
+    bool publish(uint32_t rxMicros);
+    void countRxError() { _rxErrors++; } // UART FIFO/buffer overflow reported by the driver
+
+    // --- Consumer side (only one task) ---
+    // Returns true if Oiler::update() was called.
+    bool process(Oiler& oiler);
+
+    const GpsFix& getLastFix() const { return _lastFix; } // Last consumed snapshot (for UI/logging)
+    float getSpeedKmh() const { return _speedKmh; } // Filtered speed (0 if signal is poor)
+    bool isSignalPoor() const { return _signalPoor; }
+    unsigned long getUpdateCount() const { return _updateCount; } // Oiler::update() calls
+    unsigned long getFreshCount() const { return _freshCount; }   // ... of which carried a fresh, good fix
+
+    // Fix -> decision latency (UART read to Oiler::update() done)
+    uint32_t getLatencyAvgUs() const { return _latencyCount ? (uint32_t)(_latencySumUs / _latencyCount) : 0; }
+    uint32_t getLatencyMaxUs() const { return _latencyMaxUs; }
+    uint32_t getPublishedCount() const { return _published; }
+    uint32_t getDroppedCount() const { return _dropped; }  // Queue full (consumer stalled)
+    uint32_t getRxErrorCount() const { return _rxErrors; }
+    void resetLatencyStats();
+
+private:
+    void applyFix(const GpsFix& fix);
+
+    // Producer state
+    TinyGPSPlus _gps;
+    bool _sentenceDone;
+    volatile uint32_t _published;
+    volatile uint32_t _dropped;
+    volatile uint32_t _rxErrors;
+
+    SpscQueue<GpsFix, GPS_FIX_QUEUE_LEN> _queue;
+
+    // Consumer state
+    GpsFix _lastFix;
+    float _speedKmh;
+    bool _signalPoor;
+    unsigned long _lastOilerUpdate;
+    unsigned long _updateCount;
+    unsigned long _freshCount;
+    uint64_t _latencySumUs;
+    uint32_t _latencyCount;
+    uint32_t _latencyMaxUs;
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef HIGH_RATE_LOG_H
+#define HIGH_RATE_LOG_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.h"
+#include "TelemetryLog.h"
+
+// Samples at HIGHRATE_LOG_HZ (pump pulses, lean angles, speed transients),
+// handed from the loop to a low-priority SD writer task.
+// Double buffer: the loop fills one buffer while the writer task encodes and
+// writes the other. If the writer still holds the next buffer when the
+// current one is full (card too slow), new samples are dropped and counted;
+// the loop never waits for the card.
+// Exactly one producer (loop) and one consumer (writer task), like SpscQueue.
+class HighRateLog {
+public:
+    struct Sample {
+        uint32_t timeMs;
+        float speedGps;
+        float speedSmooth;
+        float roll;
+        float pitch;
+        float accelX; // Linear acceleration, m/s^2
+        float accelY;
+        float accelZ;
+        bool pumpOn;
+    };
+
+    // Columns of hr_X.bin (TelemetryLog binary format)
+    enum Field { SPEED_GPS, SPEED_SMOOTH, PUMP_STATE, ROLL, PITCH, ACCEL_X, ACCEL_Y, ACCEL_Z, FIELD_COUNT };
+    static const TelemetryLog::Column COLUMNS[FIELD_COUNT];
+
+    HighRateLog();
+
+    // --- Producer (loop) ---
+    bool add(const Sample& s); // false = dropped
+    void handOver();           // Partly filled buffer to the writer (stopped, crash)
+
+    // --- Consumer (writer task) ---
+    // Encodes the next full buffer into out. Returns its sample count, 0 if none is ready.
+    uint32_t writeNext(TelemetryLog& out);
+    // Time of the first sample of the next full buffer, false if none is ready
+    bool peekTime(uint32_t& timeMs) const;
+
+    // Statistics
+    uint32_t getSamples() const { return _samples; }
+    uint32_t getDropped() const { return _dropped; }
+    uint32_t getBuffersWritten() const { return _written; }
+
+private:
+    Sample _buf[2][HIGHRATE_BUFFER_SAMPLES];
+    uint32_t _count[2];         // Samples in a handed over buffer
+    std::atomic<bool> _full[2]; // Owned by the writer while set
+
+    // Producer state
+    int _fill;
+    uint32_t _fillCount;
+    volatile uint32_t _samples;
+    volatile uint32_t _dropped;
+
+    // Consumer state
+    int _take;
+    volatile uint32_t _written;
+};
+
+#endif
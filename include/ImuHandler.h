@@ -3,12 +3,17 @@
 
 #include <Arduino.h>
 #include <Adafruit_BNO08x.h>
-#include <Preferences.h>
+#include "Persistence.h"
+#include "ConfigRecord.h"
 
 class ImuHandler {
 public:
     ImuHandler();
-    bool begin(int sda, int scl);
+    bool begin(int sda, int scl); // probe() + activate()
+    // Bus part of begin(): detects the sensor and enables the reports. Only
+    // touches I2C, so it can run in an init task while the loop is running.
+    bool probe();
+    bool activate(); // Loop task, after a successful probe(): calibration, features online
     void update();
     void loop(); // Call frequently
 
@@ -27,6 +32,9 @@ public:
     float getRoll() const { return _roll; }
     float getPitch() const { return _pitch; }
     float getYaw() const { return _yaw; }
+    float getLinAccelX() const { return _linAccelX; } // m/s^2 without gravity
+    float getLinAccelY() const { return _linAccelY; }
+    float getLinAccelZ() const { return _linAccelZ; }
     
     // Features
     bool isParked(); // Garage Guard (Side stand or Center stand)
@@ -41,7 +49,8 @@ public:
 private:
     Adafruit_BNO08x _bno;
     sh2_SensorValue_t _sensorValue;
-    bool _available = false;
+    bool _found = false;     // probe() succeeded
+    bool _available = false; // activate()d
     
     // Orientation
     float _roll = 0.0;
@@ -65,7 +74,18 @@ private:
     float _linAccelZ = 0.0;
     unsigned long _lastMotionTime = 0;
 
-    Preferences _prefs;
+    PersistStore _prefs;
+    // Calibration as one NVS record (ConfigRecord.h), only append members
+    struct CalibrationData {
+        float offsetRoll;
+        float offsetPitch;
+        float sideStandRoll;
+        uint8_t sideStandCalibrated;
+        uint8_t chainOnRight;
+    };
+    static const ConfigField CALIBRATION_FIELDS[];
+    static const int CALIBRATION_FIELD_COUNT;
+    ConfigRecord<CalibrationData> _calibration;
     
     void processOrientation();
     unsigned long _lastUpdate = 0;
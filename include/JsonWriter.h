@@ -0,0 +1,42 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Arduino.h>
+
+// Streaming JSON for the /api routes: writes straight into a Print (a
+// PageStream), numbers are formatted with integer math like LogWriter, no
+// String and no document in RAM. Commas are tracked per nesting level.
+// key = NULL for array elements.
+class JsonWriter {
+public:
+    explicit JsonWriter(Print& out);
+
+    void beginObject(const char* key = NULL);
+    void endObject();
+    void beginArray(const char* key = NULL);
+    void endArray();
+
+    void add(const char* key, const char* value); // Escaped, NULL = null
+    void add(const char* key, int value) { add(key, (long)value); }
+    void add(const char* key, unsigned int value) { add(key, (unsigned long)value); }
+    void add(const char* key, long value);
+    void add(const char* key, unsigned long value);
+    void addFixed(const char* key, double value, uint8_t decimals); // NaN/inf = null
+    void addBool(const char* key, bool value);
+    void addNull(const char* key);
+
+    static const int MAX_DEPTH = 16;
+
+private:
+    void next(const char* key); // Comma and "key":
+    void open(const char* key, char c);
+    void close(char c);
+    void digits(unsigned long long value);
+    void string(const char* s);
+
+    Print& _out;
+    uint16_t _started; // Bit per level: something written already
+    uint8_t _depth;
+};
+
+#endif
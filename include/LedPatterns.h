@@ -0,0 +1,35 @@
+#ifndef LED_PATTERNS_H
+#define LED_PATTERNS_H
+
+#include <Arduino.h>
+
+// Status LED patterns, one per status bit. The bit number is the priority
+// (bit 0 wins), so a frame is: lowest set bit -> table entry -> waveform.
+enum LedStatusBit {
+    LED_ST_UPDATE = 0,   // Firmware update running
+    LED_ST_CRASH,        // IMU crash latch
+    LED_ST_BLEEDING,
+    LED_ST_FLUSH,
+    LED_ST_OFFROAD,
+    LED_ST_WIFI_NEW,     // WiFi just switched on (LED_WIFI_SHOW_DURATION)
+    LED_ST_OILING,       // Oiling + LED follow-up time
+    LED_ST_WIFI,
+    LED_ST_TANK_LOW,
+    LED_ST_NOFIX_EMERG,  // No GPS, Emergency Mode (forced or auto) active
+    LED_ST_NOFIX,        // No GPS
+    LED_ST_EMERGENCY,
+    LED_ST_RAIN,
+    LED_ST_IDLE,         // Always set
+    LED_ST_COUNT
+};
+
+#define LED_STATUS(bit) (1UL << (bit))
+
+class LedPatterns {
+public:
+    // Colour and brightness of the status LED for the highest priority bit in status.
+    // dim/high are the current (night mode adjusted) brightness levels.
+    static void render(uint32_t status, unsigned long now, uint8_t dim, uint8_t high, uint32_t& color, uint8_t& bri);
+};
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef LED_RENDERER_H
+#define LED_RENDERER_H
+
+#include <Arduino.h>
+#include <driver/rmt.h>
+#include "config.h"
+
+// Output for the WS2812 status LEDs.
+// A frame is built with setPixel() (colour + brightness per pixel) and pushed
+// with show(). Unchanged frames are skipped, changed ones are sent by the RMT
+// peripheral in the background: no busy wait and no interrupt masking, unlike
+// Adafruit_NeoPixel::show().
+class LedRenderer {
+public:
+    LedRenderer(int pin, rmt_channel_t channel);
+    void begin();
+
+    void setPixel(int index, uint32_t color, uint8_t brightness);
+    // Returns true if the frame was sent. Unchanged frames are not sent; if the
+    // last transfer is still running the frame stays pending for the next call.
+    bool show();
+
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+        return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+    // (sin + 1) / 2 as 0..255 over periodMs, from a lookup table
+    static uint8_t sine8(unsigned long now, unsigned long periodMs);
+
+    // Statistics
+    uint32_t getFrameCount() const { return _frames; }   // show() calls
+    uint32_t getPushCount() const { return _pushes; }    // Frames actually sent
+    uint32_t getBusyCount() const { return _busy; }      // Deferred, transfer still running
+
+private:
+    int _pin;
+    rmt_channel_t _channel;
+    bool _ready;
+    bool _pending;
+    uint8_t _frame[NUM_LEDS * 3]; // GRB, being built
+    uint8_t _tx[NUM_LEDS * 3];    // GRB, owned by the RMT driver while sending
+    uint32_t _frames;
+    uint32_t _pushes;
+    uint32_t _busy;
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef LOG_SEGMENT_H
+#define LOG_SEGMENT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Crc32.h"
+
+#define LOG_SEGMENT_MAGIC 0x33474553   // "SEG3" (SEG1 had no index, SEG2 no header copy)
+#define LOG_SEGMENT_HEADER_SIZE 512    // One sector, the data starts at the next one
+#define LOG_INDEX_EVENT 0x80000000     // Flag in LogIndexEntry::offset
+
+// Segment layout: header sector | data | index area (indexSectors at the end)
+//
+// First sector of every log store segment (see LogStore). Shared with the
+// host tool that joins the segments back into log files (host/logextract).
+struct LogSegmentHeader {
+    uint32_t magic;
+    uint32_t seq;          // Grows with every segment started, the oldest is recycled first
+    uint32_t log;          // Log number (one per boot)
+    uint32_t part;         // Segment of this log: 0, 1, ...
+    uint32_t offset;       // Position of the first data byte in the whole log
+    uint32_t length;       // Data bytes after the header, anything behind is stale
+    uint32_t segmentSize;  // File size incl. header and index
+    uint32_t indexSectors;
+    uint32_t indexCount;   // Valid LogIndexEntry in the index area
+    uint32_t headerOffset; // Copy of the file header (CSV column line / binary schema) that
+    uint32_t headerLength; // the writer repeats in parts > 0: log position and bytes, 0 = none
+    uint32_t crc;          // CRC32 of the fields above
+
+    uint32_t dataCapacity() const { return segmentSize - LOG_SEGMENT_HEADER_SIZE - indexSectors * LOG_SEGMENT_HEADER_SIZE; }
+    uint32_t indexStart() const { return segmentSize - indexSectors * LOG_SEGMENT_HEADER_SIZE; }
+
+    void seal() { crc = crc32(this, offsetof(LogSegmentHeader, crc)); }
+    bool isValid() const {
+        return magic == LOG_SEGMENT_MAGIC && crc == crc32(this, offsetof(LogSegmentHeader, crc)) &&
+               segmentSize > (indexSectors + 1) * LOG_SEGMENT_HEADER_SIZE && length <= dataCapacity() &&
+               indexCount <= indexSectors * (LOG_SEGMENT_HEADER_SIZE / 8) &&
+               (headerLength == 0 || (headerOffset >= offset && headerOffset + headerLength <= offset + dataCapacity()));
+    }
+};
+
+// Seek point: the row/record at offset (position in the whole log) was
+// written at timeMs. Every LOG_INDEX_INTERVAL_MS plus every EVENT/PULSE row.
+struct LogIndexEntry {
+    uint32_t timeMs;
+    uint32_t offset; // | LOG_INDEX_EVENT
+};
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef LOG_STORE_H
+#define LOG_STORE_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <mutex>
+#include "config.h"
+#include "LogSegment.h"
+
+// Size-capped log storage: a ring of segmentCount files of segmentSize bytes
+// in one directory (000.csv, 001.csv, ...). A segment is zero filled once
+// before it is needed (at boot, then by the spare task after each rotation)
+// and afterwards only overwritten in place, so
+// logging never allocates clusters (flat write latency) and never fills the
+// card: every boot starts a new segment, a full one continues in the next,
+// and the oldest segment is recycled.
+// The first sector of a segment is a LogSegmentHeader (log number, part,
+// bytes used), rewritten on every flush(). The last LOG_INDEX_SECTORS hold
+// the time index (LogIndexEntry), so a time window can be read without
+// scanning the log. A part starts in the middle of a row, so the writer
+// repeats the file header in every later part (takeSegmentStarted()); once
+// the first part is recycled the log is read from that copy.
+// host/logextract joins the parts back into log_N files and cuts windows.
+// A LogStore is the Print behind a LogWriter (one task per store).
+class LogStore : public Print {
+public:
+    LogStore(const char* dir, const char* ext, uint32_t segmentSize, uint16_t segmentCount);
+
+    // Init task: finds the newest segment (store.idx, headers as fallback), starts
+    // the next one for log number log (0 = one above the newest) and prepares
+    // LOG_STORE_PREALLOC_AHEAD spare segments, since creating one while riding
+    // would stall the writer for seconds.
+    bool begin(fs::FS& fs, uint32_t log = 0);
+    // Spare task: tops the spares up again after a rotation, LOG_STORE_PREALLOC_CHUNK_KB
+    // per call so a rotating writer waits for one chunk at most. True while there is more.
+    bool prepareSpares();
+    bool isOpen() { return (bool)_file; }
+
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+    void flush(); // Header (bytes used), index + file sync
+
+    // Position in the whole log of the next byte written (parts add up)
+    uint32_t getOffset() const { return _partOffset + _length; }
+    // Seek point for the row starting at offset. Full index sectors are
+    // written in place, the last one on flush().
+    void addIndex(uint32_t timeMs, uint32_t offset, bool event);
+    // True once after a segment filled up: the writer repeats the file header
+    // (TelemetryLog::begin) and reports its log position and size here
+    bool takeSegmentStarted();
+    void setHeaderCopy(uint32_t offset, uint32_t length);
+
+    uint32_t getLog() const { return _log; }
+    String getSegmentPath() const { return segmentPath(_slot); }
+    uint16_t getSegmentCount() const { return _count; }
+    uint32_t getRotations() const { return _rotations; } // Segments filled up this boot
+    uint32_t getCreated() const { return _created; }     // Segments zero filled this boot
+    uint32_t getIndexDropped() const { return _indexDropped; } // Index area of a segment full
+
+private:
+    String segmentPath(uint16_t slot) const;
+    String indexPath() const;
+    bool readHeader(uint16_t slot, LogSegmentHeader& h);
+    bool readIndex(uint16_t& slot, uint32_t& seq, uint32_t& log);
+    void writeIndex();
+    bool preallocate(uint16_t slot);
+    bool startSegment(uint16_t slot);
+    bool writeHeader();
+    bool writeIndexSector();
+    uint32_t dataCapacity() const { return _segmentSize - (LOG_INDEX_SECTORS + 1) * LOG_SEGMENT_HEADER_SIZE; }
+    bool rotate();
+
+    fs::FS* _fs;
+    const char* _dir;
+    const char* _ext;
+    uint32_t _segmentSize;
+    uint16_t _count;
+
+    File _file;
+    uint16_t _slot;
+    uint32_t _seq;
+    uint32_t _log;
+    uint32_t _part;
+    uint32_t _partOffset; // Log position of the segment's first data byte
+    uint32_t _length;     // Data bytes in the current segment
+
+    static const int INDEX_PER_SECTOR = LOG_SEGMENT_HEADER_SIZE / sizeof(LogIndexEntry);
+    LogIndexEntry _index[INDEX_PER_SECTOR]; // Sector being filled
+    uint32_t _indexCount;                    // Entries in the current segment
+    bool _indexDirty;
+    uint32_t _indexDropped;
+
+    bool _segmentStarted;
+    uint32_t _headerOffset; // Header copy in the current segment (0 bytes = none)
+    uint32_t _headerLength;
+
+    std::mutex _spareLock; // prepareSpares() (spare task) vs rotation (writer)
+    File _spare;           // Spare being zero filled
+    uint16_t _spareSlot;
+    uint32_t _spareSize;
+    uint16_t _sparesReady; // Full size segments after _slot
+    bool _spareError;      // Card full or failing: wait for the next rotation
+
+    uint32_t _rotations;
+    uint32_t _created;
+};
+
+#endif
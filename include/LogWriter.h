@@ -0,0 +1,65 @@
+#ifndef LOG_WRITER_H
+#define LOG_WRITER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#define LOG_SECTOR_SIZE 512
+
+// Buffered writer for the SD log.
+// The file stays open; lines are built in a RAM buffer with integer
+// formatting (no printf("%f")) and go to the card in whole sectors of the
+// file: when the buffer is nearly full and every LOG_FLUSH_INTERVAL_MS
+// (service()). flush() writes the rest and syncs the file (standstill,
+// restart, crash); the next write then starts by completing that sector.
+// Loop task only.
+class LogWriter {
+public:
+    LogWriter();
+
+    void begin(Print* out); // out must stay open and start on a sector boundary, NULL = stop logging
+    bool isOpen() const { return _out != NULL; }
+
+    // Line building
+    void add(const char* s);
+    void add(char c);
+    void addInt(int32_t value);
+    void addUInt(uint32_t value);
+    void addFixed(double value, uint8_t decimals); // Like %.<decimals>f (rounded half up)
+    void endLine();
+
+    // Binary records (see TelemetryLog)
+    void addBytes(const void* data, size_t len);
+    void endRecord();
+
+    void service(); // Timer flush of whole sectors, call every few seconds
+    void flush();   // Everything buffered + file sync
+
+    // Statistics
+    uint32_t getLines() const { return _lines; }       // Lines / records
+    uint32_t getBytes() const { return _bytes; }       // Written to the card
+    uint32_t getWrites() const { return _writes; }     // Sink write() calls
+    uint32_t getErrors() const { return _errors; }     // Short writes
+    uint32_t getMaxWriteUs() const { return _maxWriteUs; }
+    size_t getBuffered() const { return _len; }
+
+private:
+    void reserve(size_t n);
+    void addDigits(uint64_t value);
+    void writeSectors();
+    void writeOut(size_t n); // The first n buffered bytes
+
+    Print* _out;
+    char _buf[LOG_BUFFER_SIZE];
+    size_t _len;
+    unsigned long _lastFlush; // millis()
+    uint32_t _position;       // Bytes written to out since begin() (sector alignment)
+
+    uint32_t _lines;
+    uint32_t _bytes;
+    uint32_t _writes;
+    uint32_t _errors;
+    uint32_t _maxWriteUs;
+};
+
+#endif
@@ -3,28 +3,36 @@
 
 #include "config.h"
 #include <TinyGPS++.h>
-#include <Adafruit_NeoPixel.h>
+#include "LedRenderer.h"
 #include "ImuHandler.h"
+#include "PumpDriver.h"
+#include "PulseStats.h"
+#include "ProgressJournal.h"
+#include "ConfigRecord.h"
+#include <DallasTemperature.h>
 
 #define SPEED_BUFFER_SIZE 5
 #define LUT_STEP 5
 #define LUT_MAX_SPEED ((int)MAX_SPEED_KMH)
 #define LUT_SIZE ((LUT_MAX_SPEED / LUT_STEP) + 1)
 
-enum PumpState {
-    PUMP_IDLE,
-    PUMP_RAMP_UP,
-    PUMP_HOLD,
-    PUMP_RAMP_DOWN
-};
-
 class Oiler {
 public:
     Oiler();
     ImuHandler imu;
+    PumpDriver pump; // Pulse waveform (hardware fade + timer)
+    PulseStats pulseStats; // Requested vs. achieved pulse timing
+    ProgressJournal journal; // Odometer / progress checkpoints (own flash partition)
     void begin();
     void update(float speedKmh, double lat, double lon, bool gpsValid);
-    void loop(); // Main loop for button and LED
+    void loop(); // Main loop for button and LED (all services in one pass)
+
+    // Scheduler entry points (main.cpp). Each returns the time in us until it wants to run again.
+    uint32_t serviceControl(); // IMU, button, timed modes, temperature
+    uint32_t servicePump();    // Pump state machine (sub-ms steps during ramps)
+    uint32_t serviceLED();     // One LED frame
+    // Called when oiling/bleeding starts, so an idle pump task can sleep long
+    void setPumpWakeCallback(void (*callback)()) { pumpWakeCallback = callback; }
     void saveConfig();
     void saveProgress(); // Public for manual saving
     
@@ -57,6 +65,8 @@ public:
     bool isPumpRunning() { return isOiling; }
     float getCurrentProgress() { return currentProgress; }
     float getCurrentTempC() { return currentTempC; }
+    unsigned long getTempConversionMs() { return tempConversionMs; } // Request -> result of the last reading
+    unsigned long getTempConversionMaxMs() { return tempConversionMaxMs; }
     
     // Mode Getters & Setters
     bool isRainMode() { return rainMode; }
@@ -69,7 +79,7 @@ public:
     void setOffroadMode(bool mode);
 
     bool isEmergencyMode() { return emergencyMode; }
-    void setEmergencyMode(bool mode) { emergencyMode = mode; }
+    void setEmergencyMode(bool mode) { emergencyMode = mode; updateFixLed(); }
 
     bool isEmergencyModeForced() { return emergencyModeForced; }
     void setEmergencyModeForced(bool forced);
@@ -175,6 +185,7 @@ private:
     int auxMode = 0; // 0=OFF, 1=SMART, 2=GRIPS
     bool auxBoost = false;
 
+    void processUpdate(float rawSpeedKmh, double lat, double lon, bool gpsValid); // update() minus the RTC copy
     void processDistance(double distKm, float speedKmh);
     
     int pumpPin;
@@ -225,14 +236,61 @@ private:
     float smoothedInterval; // Low-Pass Filter for Interval
     
     // LED
-    Adafruit_NeoPixel strip;
-    unsigned long lastLedUpdate;
+    LedRenderer leds;
+    unsigned long lastLedUpdate; // Last frame (millis)
+    uint32_t ledStatus = 0; // LED_STATUS() bits, see LedPatterns.h
+    unsigned long ledWifiNewEndTime = 0; // LED_ST_WIFI_NEW runs out (millis)
+    void refreshLedStatus();
+    void setLedBit(uint8_t bit, bool on);
+    void updateOilingLed();
+    void updateTankLed();
+    void updateFixLed();
     void updateLED();
     void handleButton();
     void processPump(); // Unified pump logic
+    uint32_t getPumpDueUs(); // Time until processPump() has work again
+    void (*pumpWakeCallback)() = NULL;
+
+    // Settings as one NVS record (ConfigRecord.h). Only append members,
+    // with a new version in CONFIG_FIELDS!
+    struct ConfigData {
+        float rangeKm[NUM_RANGES];
+        int32_t rangePulses[NUM_RANGES];
+        float tcPulse;
+        float tcPause;
+        int32_t tcOil;
+        uint8_t ledDim;
+        uint8_t ledHigh;
+        uint8_t nightEnabled;
+        uint8_t nightBri;
+        uint8_t nightBriHigh;
+        uint8_t rainMode;
+        uint8_t emergencyMode;
+        uint8_t emergencyForced;
+        int32_t nightStart;
+        int32_t nightEnd;
+        int32_t offroadIntervalMin;
+        float startupDelayMeters;
+        int32_t flushEvents;
+        int32_t flushPulses;
+        int32_t flushIntervalSec;
+        uint8_t tankEnabled;
+        float tankCapacityMl;
+        int32_t dropsPerMl;
+        int32_t dropsPerPulse;
+        int32_t tankWarnPercent;
+    };
+    static const ConfigField CONFIG_FIELDS[];
+    static const int CONFIG_FIELD_COUNT;
+    ConfigRecord<ConfigData> configRecord;
+    void fillConfigRecord();  // Settings -> record
+    void applyConfigRecord(); // Record -> settings
 
     void loadConfig();
     void validateConfig();
+    void getLiveState(ProgressJournal::Record& r);
+    void loadLiveState(); // RTC copy after a warm restart, else the journal
+    void saveLiveState(); // Odometer, progress, interval times, tank level
     // saveProgress is public
     // triggerOil is public
 
@@ -249,23 +307,34 @@ private:
     unsigned long lastPulseTime;
     bool pulseState; // true = HIGH, false = LOW
 
-    // Pump State Machine
-    PumpState pumpState = PUMP_IDLE;
+    // Pump pulse (waveform runs in PumpDriver)
     unsigned long pumpStateStartTime = 0;
     unsigned long pumpTargetDuration = 0;
-    int pumpCurrentDuty = 0;
-    unsigned long pumpLastStepTime = 0;
+    // Pause before the running pulse (valid only if the previous pulse was part of the same run)
+    bool pulsePauseValid = false;
+    unsigned long pulsePauseRequestedMs = 0;
+    uint32_t pulsePauseActualUs = 0;
 
     void startPulse(unsigned long durationMs);
-    void updatePumpPulse();
     void handlePulseFinished();
+    void countOilingPulse();
+    void recordPulseStats();
 
     // Temperature Compensation
     float currentTempC;
     unsigned long dynamicPulseMs;
     unsigned long dynamicPauseMs;
     unsigned long lastTempUpdate;
-    void updateTemperature();
+    // DS18B20 conversion runs in the background: request -> wait -> read
+    DeviceAddress tempAddress;
+    bool tempAddressValid = false;
+    bool tempConverting = false;
+    unsigned long tempRequestTime = 0;
+    unsigned long tempConversionTimeoutMs = 0;
+    unsigned long tempConversionMs = 0;
+    unsigned long tempConversionMaxMs = 0;
+    void serviceTemperature();
+    void updateTemperature(float tempC);
 
     // Safety & UX
     unsigned long ledOilingEndTimestamp;
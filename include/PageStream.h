@@ -0,0 +1,32 @@
+#ifndef PAGE_STREAM_H
+#define PAGE_STREAM_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include "config.h"
+
+// Response body sent with chunked transfer encoding (length unknown).
+// Small writes (values) are collected in PAGE_CHUNK_SIZE bytes, large ones
+// (literal page parts from flash) go out directly without a copy.
+// Lives on the handler's stack: begin(), print/render, end().
+class PageStream : public Print {
+public:
+    explicit PageStream(WebServer& server);
+
+    void begin(int code, const char* contentType);
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+    void end(); // Rest + final chunk
+
+    uint32_t getBytes() const { return _bytes; }
+
+private:
+    void sendBuffer();
+
+    WebServer& _server;
+    char _buf[PAGE_CHUNK_SIZE];
+    size_t _len;
+    uint32_t _bytes;
+};
+
+#endif
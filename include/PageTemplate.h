@@ -0,0 +1,41 @@
+#ifndef PAGE_TEMPLATE_H
+#define PAGE_TEMPLATE_H
+
+#include <Arduino.h>
+
+// HTML page with %KEY% placeholders (html_pages.h).
+// begin() finds the placeholders once (boot), render() then writes the
+// literal parts straight from flash and lets the page's fill function print
+// the values in between - no page copy in RAM and no replace() passes.
+// Only the names in keys are placeholders, so "%" in CSS or URLs stays as is.
+class PageTemplate {
+public:
+    // Prints the value of keys[key]
+    typedef void (*Filler)(Print& out, int key);
+
+    PageTemplate(const char* html, const char* const* keys, int keyCount);
+
+    bool begin(); // Allocates the part list (once)
+    void render(Print& out, Filler fill) const;
+
+    int getPlaceholders() const { return _partCount > 0 ? _partCount - 1 : 0; }
+
+private:
+    // Literal [offset, offset + length), then keys[key] (-1 = end of page)
+    struct Part {
+        uint32_t offset;
+        uint16_t length;
+        int16_t key;
+    };
+
+    int scan(Part* parts) const; // Returns the number of parts
+    int findKey(const char* name, size_t len) const;
+
+    const char* _html;
+    const char* const* _keys;
+    int _keyCount;
+    Part* _parts;
+    int _partCount;
+};
+
+#endif
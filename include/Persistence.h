@@ -0,0 +1,119 @@
+#ifndef PERSISTENCE_H
+#define PERSISTENCE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#define PERSIST_MAX_ENTRIES 96
+#define PERSIST_KEY_LEN 16 // NVS limit: 15 characters
+
+// Write-back cache in front of NVS, shared by all modules.
+// put*() only marks a key dirty when its value differs from the cached
+// (= stored) one. service() writes all dirty keys PERSIST_COMMIT_DELAY_MS
+// after the first change, with one nvs_commit() per namespace.
+// The value encodings are the same as the Arduino Preferences library
+// (float/double as blob, bool/uchar as u8), so existing settings stay valid.
+// Single-threaded: used from the loop task only.
+class Persistence {
+public:
+    enum Type : uint8_t {
+        T_U8,
+        T_I32,
+        T_U32,
+        T_BLOB
+    };
+
+    Persistence();
+
+    // Returns true and fills value if the key exists (len must match for blobs)
+    bool get(const char* ns, const char* key, Type type, void* value, size_t len);
+    size_t getLength(const char* ns, const char* key); // Blob length, 0 = missing
+    // Stages a value. Blobs > 8 bytes are not copied: the buffer must stay valid
+    // until the next commit (only its CRC is cached).
+    void put(const char* ns, const char* key, Type type, const void* value, size_t len);
+    void clear(const char* ns); // Erases the namespace immediately
+
+    uint32_t service(); // Scheduler task, returns us until the next run
+    void flush();       // Writes everything now (before restart / power down)
+    bool isDirty() const { return _dirty; }
+
+    // Statistics
+    uint32_t getWrites() const { return _writes; }   // Keys written to NVS
+    uint32_t getSkipped() const { return _skipped; } // put() calls without a change
+    uint32_t getCommits() const { return _commits; }
+    int getEntryCount() const { return _count; }
+
+private:
+    struct Entry {
+        const char* ns; // Namespace name (string literal)
+        char key[PERSIST_KEY_LEN];
+        Type type;
+        bool present;   // Key exists in NVS (or is staged)
+        bool dirty;
+        uint16_t len;
+        uint8_t value[8];  // Values up to 8 bytes
+        const void* blob;  // Larger blobs: caller buffer (set by put)
+        uint32_t crc;      // Larger blobs: CRC of the stored data
+    };
+
+    Entry* find(const char* ns, const char* key);
+    Entry* add(const char* ns, const char* key, Type type);
+    bool load(Entry& e, void* buf, size_t len);
+    bool matches(const Entry& e, const void* value, size_t len) const;
+    void store(Entry& e, const void* value, size_t len);
+    bool writeDirect(const char* ns, const char* key, Type type, const void* value, size_t len);
+    void commit();
+
+    Entry _entries[PERSIST_MAX_ENTRIES];
+    int _count;
+    bool _dirty;
+    unsigned long _dirtySince; // millis() of the first uncommitted change
+
+    uint32_t _writes;
+    uint32_t _skipped;
+    uint32_t _commits;
+};
+
+extern Persistence persistence;
+
+// One NVS namespace with the Preferences get/put API on top of the cache.
+// begin() only binds the name, there is nothing to open or close.
+class PersistStore {
+public:
+    PersistStore() : _ns(NULL) {}
+    void begin(const char* name) { _ns = name; }
+
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0) { get(key, Persistence::T_U8, &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    bool getBool(const char* key, bool defaultValue = false) { uint8_t v = defaultValue ? 1 : 0; get(key, Persistence::T_U8, &v, sizeof(v)); return v != 0; }
+    int32_t getInt(const char* key, int32_t defaultValue = 0) { get(key, Persistence::T_I32, &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0) { get(key, Persistence::T_U32, &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    float getFloat(const char* key, float defaultValue = NAN) { get(key, Persistence::T_BLOB, &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    double getDouble(const char* key, double defaultValue = NAN) { get(key, Persistence::T_BLOB, &defaultValue, sizeof(defaultValue)); return defaultValue; }
+    size_t getBytesLength(const char* key) { return _ns ? persistence.getLength(_ns, key) : 0; }
+    size_t getBytes(const char* key, void* buf, size_t len) { return get(key, Persistence::T_BLOB, buf, len) ? len : 0; }
+
+    void putUChar(const char* key, uint8_t value) { put(key, Persistence::T_U8, &value, sizeof(value)); }
+    void putBool(const char* key, bool value) { uint8_t v = value ? 1 : 0; put(key, Persistence::T_U8, &v, sizeof(v)); }
+    void putInt(const char* key, int32_t value) { put(key, Persistence::T_I32, &value, sizeof(value)); }
+    void putUInt(const char* key, uint32_t value) { put(key, Persistence::T_U32, &value, sizeof(value)); }
+    void putFloat(const char* key, float value) { put(key, Persistence::T_BLOB, &value, sizeof(value)); }
+    void putDouble(const char* key, double value) { put(key, Persistence::T_BLOB, &value, sizeof(value)); }
+    void putBytes(const char* key, const void* value, size_t len) { put(key, Persistence::T_BLOB, value, len); }
+
+    void clear() { if (_ns) persistence.clear(_ns); }
+
+    // Typed access for key tables (ConfigRecord migration)
+    bool getValue(const char* key, Persistence::Type type, void* value, size_t len) { return get(key, type, value, len); }
+
+private:
+    bool get(const char* key, Persistence::Type type, void* value, size_t len) {
+        return _ns && persistence.get(_ns, key, type, value, len);
+    }
+    void put(const char* key, Persistence::Type type, const void* value, size_t len) {
+        if (_ns) persistence.put(_ns, key, type, value, len);
+    }
+
+    const char* _ns;
+};
+
+#endif
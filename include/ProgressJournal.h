@@ -0,0 +1,68 @@
+#ifndef PROGRESS_JOURNAL_H
+#define PROGRESS_JOURNAL_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "config.h"
+
+#define JOURNAL_PARTITION_LABEL "journal"
+#define JOURNAL_SECTOR_SIZE 4096
+#define JOURNAL_MAGIC 0x314E524A // "JRN1", also tells an erased slot from a record
+
+// Append-only checkpoint log for the odometer / oiling progress in its own
+// flash partition (see partitions.csv).
+// Fixed-size records with a sequence number and CRC are written one after the
+// other; when a sector is full the oldest one is erased and reused (round
+// robin), so every sector sees the same number of erases. Only the newest
+// record is ever read back: begin() finds it with one scan.
+// Without the partition (old partition table after an OTA update) begin()
+// returns false and the caller keeps using NVS.
+class ProgressJournal {
+public:
+    struct Record {
+        uint32_t seq;
+        uint32_t pumpCycles;
+        double totalDistance;
+        double currentIntervalTime[NUM_RANGES];
+        float progress;
+        float tankLevelMl;
+        uint32_t magic;
+        uint32_t crc; // CRC32 of everything above
+    };
+
+    ProgressJournal();
+
+    bool begin(); // Finds the partition and the newest record
+    bool isAvailable() const { return _part != NULL; }
+
+    // Newest valid record, false if the journal is empty
+    bool load(Record& out) const;
+    // Writes a new record (seq and crc are filled in). Identical checkpoints are skipped.
+    bool append(const Record& record);
+    void erase(); // Factory reset
+
+    // Statistics
+    uint32_t getAppends() const { return _appends; }
+    uint32_t getSectorErases() const { return _erases; }
+    uint32_t getRecordCount() const; // Slots in the partition
+
+private:
+    static uint32_t recordCrc(const Record& r);
+    bool readRecord(uint32_t sector, uint32_t slot, Record& out) const;
+    bool isErased(uint32_t sector, uint32_t slot) const;
+    bool startSector(uint32_t sector);
+
+    const esp_partition_t* _part;
+    uint32_t _sectors;
+    uint32_t _slotsPerSector;
+
+    bool _hasLast;
+    Record _last;         // Newest record on flash
+    uint32_t _sector;     // Where the next record goes
+    uint32_t _slot;
+
+    uint32_t _appends;
+    uint32_t _erases;
+};
+
+#endif
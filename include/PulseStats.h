@@ -0,0 +1,65 @@
+#ifndef PULSE_STATS_H
+#define PULSE_STATS_H
+
+#include <Arduino.h>
+
+#define PULSE_STATS_BINS 10
+#define PULSE_STATS_RECENT 8 // Power of two
+
+// Requested vs. achieved pump timing.
+// For every pulse the deviation (achieved - requested, us) of each phase is
+// sorted into a fixed histogram. The last PULSE_STATS_RECENT pulses are kept
+// raw for the SD log.
+class PulseStats {
+public:
+    enum Metric {
+        RAMP_UP,
+        HOLD,
+        RAMP_DOWN,
+        PAUSE, // Previous pulse end -> this pulse start (only inside one oiling/bleeding run)
+        METRIC_COUNT
+    };
+
+    struct Sample {
+        uint32_t seq;
+        bool hasPause;
+        uint32_t requestedUs[METRIC_COUNT];
+        uint32_t actualUs[METRIC_COUNT];
+    };
+
+    PulseStats();
+
+    void record(const Sample& sample); // seq is assigned here
+    void reset();
+
+    uint32_t getPulseCount() const { return _lastSeq; }
+    uint32_t getLastSeq() const { return _lastSeq; }
+    // Copies the sample with this seq, false if it's not in the ring (anymore)
+    bool getRecent(uint32_t seq, Sample& out) const;
+
+    uint32_t getCount(int metric) const { return _metrics[metric].count; }
+    uint32_t getBin(int metric, int bin) const { return _metrics[metric].bins[bin]; }
+    int32_t getMinDevUs(int metric) const { return _metrics[metric].minDevUs; }
+    int32_t getMaxDevUs(int metric) const { return _metrics[metric].maxDevUs; }
+    int32_t getAvgDevUs(int metric) const;
+
+    static const char* getMetricName(int metric);
+    static const char* getBinLabel(int bin);
+
+private:
+    struct Histogram {
+        uint32_t count;
+        uint32_t bins[PULSE_STATS_BINS];
+        int32_t minDevUs;
+        int32_t maxDevUs;
+        int64_t sumDevUs;
+    };
+
+    void add(int metric, uint32_t requestedUs, uint32_t actualUs);
+
+    Histogram _metrics[METRIC_COUNT];
+    Sample _recent[PULSE_STATS_RECENT];
+    volatile uint32_t _lastSeq; // 0 = nothing recorded
+};
+
+#endif
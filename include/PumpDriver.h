@@ -0,0 +1,77 @@
+#ifndef PUMP_DRIVER_H
+#define PUMP_DRIVER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <driver/ledc.h>
+#include <mutex>
+#include "config.h"
+
+enum PumpState {
+    PUMP_IDLE,
+    PUMP_RAMP_UP,
+    PUMP_HOLD,
+    PUMP_RAMP_DOWN
+};
+
+// Pump pulse generator, independent of the loop timing.
+// The ramps are LEDC hardware fades, the phase changes are driven by a one-shot
+// esp_timer (runs in the esp_timer task):
+//   start: duty 130 -> fade to 255 in PUMP_RAMP_UP_MS
+//   +pulseMs: fade to 130 in PUMP_RAMP_DOWN_MS
+//   +PUMP_RAMP_DOWN_MS: output off, pulse finished
+// Without PWM (PUMP_USE_PWM false) the pin is switched on for pulseMs.
+class PumpDriver {
+public:
+    PumpDriver();
+    void begin(int pin); // After ledcSetup()/ledcAttachPin()
+
+    // Starts one pulse (pulseMs includes the ramp up). Returns false if a pulse is running.
+    bool start(unsigned long pulseMs);
+    // Immediate off (Crash, Safety Cutoff). No finish event.
+    void stop();
+
+    PumpState getPhase() const;
+    bool isBusy() const { return _phase != PUMP_IDLE; }
+
+    // True once per completed pulse (call from the loop)
+    bool takeFinished();
+    unsigned long getLastEndMs() const { return _lastEndMs; }  // millis() when the output went off
+    int64_t getLastStartUs() const { return _startUs; }        // esp_timer time of the last start()
+    int64_t getLastEndUs() const { return _lastEndUs; }
+    uint32_t getLastPulseUs() const { return _lastPulseUs; }   // Start -> begin of ramp down (requested: pulseMs)
+    uint32_t getLastTotalUs() const { return _lastTotalUs; }   // Start -> output off
+    // Achieved phases of the last pulse (ramp up end from the LEDC fade interrupt, 0 if not seen)
+    uint32_t getLastRampUpUs() const { return _lastRampUpUs; }
+    uint32_t getLastHoldUs() const { return _lastHoldUs; }
+    uint32_t getLastRampDownUs() const { return _lastRampDownUs; }
+
+    // Called from the timer task when a pulse finished (e.g. to wake the loop)
+    void setFinishCallback(void (*callback)()) { _finishCallback = callback; }
+
+private:
+    static void onTimer(void* arg);
+    static bool onFadeEnd(const ledc_cb_param_t* param, void* arg); // ISR
+    void advance();
+    void outputOff();
+
+    int _pin;
+    esp_timer_handle_t _timer;
+    std::mutex _lock; // start()/stop() (loop) vs advance() (timer task)
+    void (*_finishCallback)();
+
+    volatile PumpState _phase;
+    volatile bool _finished;
+    int64_t _startUs;
+    int64_t _rampDownUs;
+    volatile int64_t _rampUpEndUs; // Set by the fade interrupt, 0 = not yet
+    int64_t _lastEndUs;
+    volatile unsigned long _lastEndMs;
+    volatile uint32_t _lastPulseUs;
+    volatile uint32_t _lastTotalUs;
+    volatile uint32_t _lastRampUpUs;
+    volatile uint32_t _lastHoldUs;
+    volatile uint32_t _lastRampDownUs;
+};
+
+#endif
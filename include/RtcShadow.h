@@ -0,0 +1,19 @@
+#ifndef RTC_SHADOW_H
+#define RTC_SHADOW_H
+
+#include <Arduino.h>
+#include "ProgressJournal.h"
+
+// Copy of the live oiling state in RTC_NOINIT memory. It survives
+// ESP.restart(), panics and watchdog resets (not a power cycle), so a warm
+// restart continues exactly where it stopped without any flash write.
+// Written on every Oiler::update (a CRC over ~70 bytes, no flash access).
+class RtcShadow {
+public:
+    static void save(const ProgressJournal::Record& state);
+    // False after power on / brownout or if the copy is not intact
+    static bool restore(ProgressJournal::Record& state);
+    static void invalidate(); // Factory reset: the old odometer must not come back
+};
+
+#endif
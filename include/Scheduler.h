@@ -0,0 +1,53 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+#define SCHEDULER_MAX_TASKS 12
+
+// Deadline scheduler for the main loop.
+// Every task returns the time (us) until it wants to run again. runDue()
+// runs all tasks whose deadline has passed and returns the time until the
+// earliest deadline, so the caller can sleep exactly that long.
+// Single-threaded: add(), wake() and runDue() are called from the loop task only.
+class Scheduler {
+public:
+    typedef uint32_t (*TaskFn)(); // Returns us until the next run
+
+    Scheduler();
+
+    // Returns the task id, -1 if the table is full
+    int add(const char* name, TaskFn fn, uint32_t firstDelayUs = 0);
+    void wake(int id); // Run at the next runDue()
+
+    // Runs all due tasks. Returns us until the next deadline (0 = already due), at most maxSleepUs.
+    uint32_t runDue(uint32_t maxSleepUs);
+
+    // Statistics
+    int getTaskCount() const { return _count; }
+    const char* getTaskName(int id) const { return _tasks[id].name; }
+    uint32_t getRunCount(int id) const { return _tasks[id].runs; }
+    uint32_t getMaxRunUs(int id) const { return _tasks[id].maxRunUs; }
+    uint64_t getBusyUs(int id) const { return _tasks[id].busyUs; }
+    uint32_t getMaxLateUs() const { return _maxLateUs; } // Worst start delay after a deadline
+    float getLoadPercent() const; // Time spent in tasks since resetStats()
+    void resetStats();
+
+private:
+    struct Task {
+        const char* name;
+        TaskFn fn;
+        uint32_t due; // micros()
+        uint32_t runs;
+        uint32_t maxRunUs;
+        uint64_t busyUs;
+    };
+
+    Task _tasks[SCHEDULER_MAX_TASKS];
+    int _count;
+    unsigned long _statsStart; // millis()
+    uint64_t _busyUs;
+    uint32_t _maxLateUs;
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Lock-free ring for exactly one producer task and one consumer task.
+// N must be a power of two. Holds up to N entries, push() fails when full
+// (the caller counts the drop, the old entries are kept).
+template <typename T, uint32_t N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+    SpscQueue() : _head(0), _tail(0) {}
+
+    // Producer side
+    bool push(const T& item) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) >= N) return false; // Full
+        _items[head & (N - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) return false; // Empty
+        item = _items[tail & (N - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called from the other side
+    uint32_t size() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    uint32_t capacity() const { return N; }
+
+private:
+    T _items[N];
+    std::atomic<uint32_t> _head; // Written by the producer only
+    std::atomic<uint32_t> _tail; // Written by the consumer only
+};
+
+#endif
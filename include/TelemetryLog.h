@@ -0,0 +1,82 @@
+#ifndef TELEMETRY_LOG_H
+#define TELEMETRY_LOG_H
+
+#include <Arduino.h>
+#include "LogWriter.h"
+
+#define TELEMETRY_MAGIC "OLOG"
+#define TELEMETRY_FORMAT_VERSION 1
+#define TELEMETRY_MAX_MESSAGE 255
+#define TELEMETRY_MAX_COLUMNS 16
+
+// The SD log rows (DATA / EVENT / PULSE) in one of two formats:
+// - CSV: the readable format of older firmware
+// - binary: the same columns as fixed-point integers, ~19 bytes per DATA row
+//   instead of ~65. Decoded back to the CSV by host/logdecode.
+//
+// Binary file layout (little endian):
+//   header  "OLOG", u8 format version, u8 column count,
+//           per column: u8 encoding, u8 decimals, name + NUL
+//   SYNC    u8 type, u32 time_ms, i32 per DELTA16 column (absolute)
+//   DATA    u8 type, u16 ms since the previous record, the columns in
+//           header order (BIT columns packed into one trailing byte)
+//   EVENT/PULSE  like DATA + u8 length + message
+//   NOTE    u8 type, u16 ms, u8 length + message (EVENT without values)
+// A SYNC is written first and whenever a delta doesn't fit in 16 bits.
+// Values are value * 10^decimals, rounded like LogWriter::addFixed(), so
+// the decoder prints exactly the CSV the device would have written.
+// Other logs (HighRateLog) pass their own column table.
+class TelemetryLog {
+public:
+    // Columns of the SD log after Type,Time_ms, in CSV order
+    enum Field {
+        SPEED_GPS, SPEED_SMOOTH, ODO_TOTAL, DIST_ACCUM, TARGET_INT, PUMP_STATE,
+        RAIN_MODE, TEMP_C, SATS, HDOP, MESSAGE, FLUSH_MODE, FIELD_COUNT
+    };
+    enum RecordType : uint8_t { REC_SYNC, REC_DATA, REC_EVENT, REC_PULSE, REC_NOTE, REC_TYPE_COUNT };
+    enum Encoding : uint8_t { ENC_U8, ENC_U16, ENC_I16, ENC_U32, ENC_DELTA16, ENC_BIT, ENC_TEXT };
+
+    struct Column {
+        const char* name;
+        Encoding encoding;
+        uint8_t decimals;
+    };
+    static const Column COLUMNS[FIELD_COUNT];
+
+    static const char* typeName(RecordType type); // Type column of the CSV
+    static int encodedSize(Encoding encoding);    // Bytes in a record (BIT/TEXT: 0)
+
+    TelemetryLog(); // SD log columns
+    TelemetryLog(const Column* columns, int count);
+
+    // Writes the CSV header line or the binary schema
+    void begin(LogWriter* out, bool binary);
+    bool isBinary() const { return _binary; }
+
+    // One value per column (the one of a TEXT column is ignored)
+    void write(RecordType type, uint32_t timeMs, const double* values, const char* message = "");
+    void note(uint32_t timeMs, const char* message);
+
+    // The next record starts with a SYNC, so a reader can start decoding there
+    void markSync() { _synced = false; }
+
+    uint32_t getSyncs() const { return _syncs; }
+
+private:
+    static int32_t encode(double value, uint8_t decimals);
+    void addInt(int32_t value, int bytes);
+    void addMessage(const char* message);
+    bool advance(uint32_t timeMs, const int32_t* encoded); // false = needs a SYNC
+    void writeSync(uint32_t timeMs);
+
+    const Column* _columns;
+    int _count;
+    LogWriter* _out;
+    bool _binary;
+    bool _synced;
+    uint32_t _lastMs;
+    int32_t _base[TELEMETRY_MAX_COLUMNS]; // Last value of the DELTA16 columns
+    uint32_t _syncs;
+};
+
+#endif
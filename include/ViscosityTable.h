@@ -0,0 +1,31 @@
+#ifndef VISCOSITY_TABLE_H
+#define VISCOSITY_TABLE_H
+
+#include <stdint.h>
+
+// Temperature compensation factors (pulse/pause multiplier vs. 25 C), built at compile time.
+//
+// Oil model (Arrhenius, ISO VG 85: 84.2 mm2/s @ 40 C, 11.2 mm2/s @ 100 C):
+//   ln(v) = A + B/T  ->  v(T)/v(25 C) = exp(B * (1/T - 1/T25))
+// The pump doesn't need to scale 1:1 with viscosity, so per oil type:
+//   factor = (v(T)/v(25 C)) ^ exponent
+// One entry per 0.5 C from -30 to +80 C, stored as factor * 10000.
+#define VISC_TABLE_MIN_C (-30)
+#define VISC_TABLE_MAX_C 80
+#define VISC_TABLE_STEPS_PER_C 2
+#define VISC_TABLE_SIZE ((VISC_TABLE_MAX_C - VISC_TABLE_MIN_C) * VISC_TABLE_STEPS_PER_C + 1)
+#define VISC_TABLE_OIL_TYPES 3 // Oiler::OilType
+#define VISC_FACTOR_SCALE 10000
+
+class ViscosityTable {
+public:
+    // Factor for the oil type (Oiler::OilType) at tempC, clamped to the table range
+    static float getFactor(int oilType, float tempC);
+
+    struct Table {
+        uint16_t factor[VISC_TABLE_SIZE];
+    };
+    static const Table tables[VISC_TABLE_OIL_TYPES];
+};
+
+#endif
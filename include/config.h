@@ -8,6 +8,7 @@
 // Hardware Pins
 #define PUMP_PIN 16        // Pin for MOSFET (Pump) - RIGHT SIDE
 #define LED_PIN 32         // WS2812B Data Pin - LEFT SIDE (Bottom)
+#define LED_RMT_CHANNEL 0  // RMT channel driving the WS2812B
 #define GPS_RX_PIN 27      // GPS RX to ESP TX - LEFT SIDE (Middle)
 #define GPS_TX_PIN 26      // GPS TX to ESP RX - LEFT SIDE (Middle)
 #define BUTTON_PIN 4      // Handlebar button - LEFT SIDE (Top of block)
@@ -23,6 +24,7 @@
 // PWM Soft-Start / Soft-Stop (Silent Mode)
 // Instead of hard 12V pulses, we ramp the voltage up and down.
 // This reduces mechanical noise ("clack") and wear.
+// The ramps are LEDC hardware fades, hold and pulse end are timed by esp_timer (PumpDriver).
 #define PUMP_USE_PWM true
 #define PUMP_PWM_FREQ 5000      // 5 kHz is safe for most solenoids
 #define PUMP_PWM_CHANNEL 0      // ESP32 LEDC Channel
@@ -35,6 +37,7 @@
 // Temperature Sensor (DS18B20)
 #define TEMP_SENSOR_PIN 15 // GPIO 15 for DS18B20 Data
 #define TEMP_UPDATE_INTERVAL_MS 900000 // Measure every 15 minutes
+#define TEMP_RESOLUTION_BITS 12 // 9..12 bit = 0.5..0.0625 C, conversion 94..750 ms (runs in the background)
 
 // IMU Configuration (BNO085)
 #define IMU_SDA 21
@@ -45,6 +48,38 @@
 // The configured Pulse values above include the Ramp-Up time.
 
 #define GPS_BAUD 9600  // GPS Baud Rate
+#define GPS_MIN_SATS 5           // Fewer satellites -> signal treated as poor (speed forced to 0)
+#define GPS_MAX_HDOP 5.0         // Higher HDOP -> signal treated as poor
+#define GPS_UPDATE_TIMEOUT_MS 1000 // Oiler::update() is called at least this often (Emergency Mode)
+
+// GPS Ingest Task
+// NMEA is decoded in its own task (woken by UART RX events), completed fixes
+// are passed to the loop through a lock-free queue.
+#define GPS_RX_BUFFER_SIZE 1024  // UART RX buffer (~1s of NMEA at 9600 Baud)
+#define GPS_FIX_QUEUE_LEN 8      // Fixes buffered for the loop (power of two)
+#define GPS_TASK_STACK 4096
+#define GPS_TASK_PRIORITY 3      // Above loop() (1), so a busy loop cannot starve the UART
+#define GPS_TASK_CORE 1          // Same core as loop(), WiFi stays alone on core 0
+#define GPS_TASK_POLL_MS 50      // Safety net if an RX event is missed
+
+// Parallel Init
+// Slow probes (IMU on I2C, SD mount + log file scan) run in short-lived tasks,
+// setup() does not wait for them.
+#define INIT_TASK_STACK 4096
+#define INIT_TASK_PRIORITY 1     // Same as loop()
+#define INIT_TASK_CORE 0         // Other core than loop(), WiFi is not up yet
+#define INIT_POLL_MS 20          // Loop checks for finished probes
+
+// Main Loop Scheduler
+// Each subsystem runs when it is due, the loop sleeps until the earliest deadline.
+#define SCHED_CONTROL_INTERVAL_MS 10 // Button debounce, IMU, timed modes
+#define SCHED_PUMP_IDLE_MS 100       // Pump poll while idle (triggerOil() wakes it directly)
+#define SCHED_AUX_INTERVAL_MS 10     // Aux filter constants assume 10ms steps
+#define SCHED_GPS_INTERVAL_MS 50     // Fix queue poll (the GPS task also wakes the loop)
+#define SCHED_NET_INTERVAL_MS 10     // Web server / DNS while WiFi is on
+#define SCHED_NET_IDLE_MS 50         // WiFi off: only check for toggle requests
+#define SCHED_MAX_SLEEP_MS 100       // Upper bound (watchdog, restart countdown)
+#define LED_FRAME_MS 20              // LED refresh (50 Hz)
 
 // Debug Configuration
 #define GPS_DEBUG          // Uncomment to enable GPS debug output on Serial
@@ -63,10 +98,63 @@
     #define SD_MOSI_PIN 23
     #define SD_MISO_PIN 19
     #define SD_CLK_PIN 18
-    #define LOG_FILE_PREFIX "/log_"
     #define LOG_INTERVAL_MS 1000 // Log every 1 second
+    // Uncomment for compact binary records (~19 instead of ~65 bytes per line),
+    // convert to CSV with the host tool in host/logdecode
+    // #define LOG_BINARY
+    #ifdef LOG_BINARY
+        #define LOG_FILE_EXT ".bin"
+    #else
+        #define LOG_FILE_EXT ".csv"
+    #endif
 #endif
 
+// SD Log Writer: the file stays open, lines are collected in RAM and written in whole sectors
+#define LOG_BUFFER_SIZE 4096        // 8 sectors
+#define LOG_FLUSH_INTERVAL_MS 10000 // Full sectors go to the card (and the file is synced) at least this often
+
+// SD Log Store: a ring of pre-allocated segment files, the oldest is recycled
+// (join them to log_N files with host/logextract). Every boot starts a new
+// segment, so a segment is sized for about one ride: the budget keeps the
+// last BUDGET / SEGMENT boots (64 MB / 128 KB = 512), fewer if rides are
+// longer than one segment, and at most one segment per boot is padding.
+#define LOG_STORE_DIR "/log"            // 000.csv, 001.csv, ... + store.idx
+#define LOG_STORE_SEGMENT_KB 128        // ~30 min of CSV at 1 Hz (binary: ~1.7 h)
+#define LOG_STORE_BUDGET_MB 64          // All segments together: >= 512 boots
+#define LOG_STORE_PREALLOC_AHEAD 2      // Spare segments kept zero filled (boot: init task, then the spare task)
+#define LOG_STORE_PREALLOC_CHUNK_KB 32  // Spare task fills this much per step (longest wait of a rotating writer)
+#define LOG_SPARE_TASK_STACK 3072
+#define LOG_SPARE_TASK_PRIORITY 1       // Below WiFi, other core than loop()
+#define LOG_SPARE_TASK_CORE 0
+#define LOG_SPARE_POLL_MS 1000          // Checks for used up spares
+#define LOG_INDEX_INTERVAL_MS 10000     // Time index entry at least this often (+ every EVENT/PULSE row)
+#define LOG_INDEX_SECTORS 16            // Index area at the end of a segment: 1024 entries
+#if LOG_STORE_BUDGET_MB * 1024 / LOG_STORE_SEGMENT_KB > 1000
+    #error "LOG_STORE_*: at most 1000 segments (000 ... 999)"
+#endif
+
+// High-Rate Log (needs SD_LOGGING_ACTIVE)
+// Uncomment to record GPS/smoothed speed, pump state, lean angles and linear
+// acceleration at HIGHRATE_LOG_HZ into its own segment store (/hr) while
+// riding or pumping (host/logextract + host/logdecode). A low-priority task
+// writes the samples, the loop only copies them into RAM.
+// #define HIGHRATE_LOG_ACTIVE
+#if defined(HIGHRATE_LOG_ACTIVE) && !defined(SD_LOGGING_ACTIVE)
+    #error "HIGHRATE_LOG_ACTIVE needs SD_LOGGING_ACTIVE"
+#endif
+#define HIGHRATE_LOG_HZ 20
+#define HIGHRATE_BUFFER_SAMPLES 100  // Per buffer (there are two): 5 s at 20 Hz
+#define HIGHRATE_STORE_DIR "/hr"
+#define HIGHRATE_STORE_SEGMENT_KB 512   // ~24 min at 20 Hz
+#define HIGHRATE_STORE_BUDGET_MB 128    // >= 256 boots, ~100 h of riding
+#if HIGHRATE_STORE_BUDGET_MB * 1024 / HIGHRATE_STORE_SEGMENT_KB > 1000
+    #error "HIGHRATE_STORE_*: at most 1000 segments (000 ... 999)"
+#endif
+#define HIGHRATE_TASK_STACK 4096
+#define HIGHRATE_TASK_PRIORITY 1     // Below WiFi, other core than loop()
+#define HIGHRATE_TASK_CORE 0
+#define HIGHRATE_WRITER_POLL_MS 200  // Writer checks for full buffers
+
 // LED Timings
 #define LED_PERIOD_OILING 1000      // Breathing duration for Oiling
 #define LED_PERIOD_EMERGENCY 1500   // Pulse cycle for Emergency Mode
@@ -109,12 +197,17 @@
 #define RAIN_MODE_AUTO_OFF_MS 1800000 // 30 Minutes (30 * 60 * 1000)
 #define SAVE_INTERVAL_MS 300000   // 5 Minutes (Regular Save)
 #define STANDSTILL_SAVE_MS 120000 // 2 Minutes (Min interval for standstill save)
+#define JOURNAL_SAVE_INTERVAL_MS 30000 // 30 Seconds (Regular Save with the journal partition)
+#define PERSIST_COMMIT_DELAY_MS 2000 // Settings changes are collected this long before one NVS commit
 #define EMERGENCY_TIMEOUT_MS 180000 // 3 Minutes (Timeout for Auto-Emergency)
 
 // AP Configuration
 #define AP_SSID "ChainJuicer"
 // No password required
 
+// Web pages are streamed (chunked transfer) through a buffer of this size
+#define PAGE_CHUNK_SIZE 1024
+
 
 struct SpeedRange {
     float minSpeed;
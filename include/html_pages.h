@@ -48,27 +48,50 @@ const char* htmlLanding = R"rawliteral(
 </head>
 <body>
     <h2>🍋 Chain Juicer</h2>
-    <div class='status-bar'>Time: %TIME% | Sats: %SATS% | Temp: %TEMP%&deg;C</div>
+    <div class='status-bar'>Time: <span id='time'>--</span> | Sats: <span id='sats'>-</span> | Temp: <span id='temp'>--</span>&deg;C</div>
 
     <div class='stat-box'>
         <h3>Statistics</h3>
-        <div class='stat-row'><span>Odometer:</span> <span class='val'>%TOTAL_DIST% km</span></div>
-        <div class='stat-row'><span>Juice Events:</span> <span class='val'>%PUMP_COUNT%</span></div>
-        <div class='stat-row'><span>Progress:</span> <span class='val'>%PROGRESS%%</span></div>
+        <div class='stat-row'><span>Odometer:</span> <span class='val'><span id='odo'>-</span> km</span></div>
+        <div class='stat-row'><span>Juice Events:</span> <span class='val' id='pumps'>-</span></div>
+        <div class='stat-row'><span>Progress:</span> <span class='val'><span id='progress'>-</span>%</span></div>
     </div>
 
     <div class='stat-box'>
         <h3>Tank Monitor</h3>
-        <div class='stat-row'><span>Level:</span> <span class='val'>%TANK_LEVEL% / %TANK_CAP% ml</span></div>
-        <div class='tank-bar'><div class='tank-fill' style='width:%TANK_PCT%%;background-color:%TANK_COLOR%'></div></div>
+        <div class='stat-row'><span>Level:</span> <span class='val'><span id='tank_level'>-</span> / <span id='tank_cap'>-</span> ml</span></div>
+        <div class='tank-bar'><div class='tank-fill' id='tank_fill' style='width:0%'></div></div>
     </div>
 
-    <a href='/toggle_emerg' class='btn %EMERG_CLASS%'>⚠️ Emergency Mode: %EMERG_STATUS%</a>
+    <a href='/toggle_emerg' id='emerg' class='btn btn-sec'>⚠️ Emergency Mode: <span id='emerg_status'>-</span></a>
     <a href='/settings' class='btn'>Juicer Settings</a>
     <a href='/led_settings' class='btn btn-sec'>LED Settings</a>
     <a href='/aux' class='btn btn-sec'>Aux Port</a>
     <a href='/maintenance' class='btn btn-sec'>Maintenance</a>
     <a href='/help' class='btn btn-sec'>Manual</a>
+    <script>
+        function $(id) { return document.getElementById(id); }
+        function refresh() {
+            fetch('/api/status')
+                .then(response => response.json())
+                .then(s => {
+                    $('time').innerText = s.time;
+                    $('sats').innerText = s.sats;
+                    $('temp').innerText = s.tempC == null ? '--' : s.tempC.toFixed(1);
+                    $('odo').innerText = s.odoKm.toFixed(1);
+                    $('pumps').innerText = s.pumpCycles;
+                    $('progress').innerText = s.progressPct.toFixed(1);
+                    $('tank_level').innerText = s.tank.levelMl.toFixed(0);
+                    $('tank_cap').innerText = s.tank.capacityMl.toFixed(0);
+                    $('tank_fill').style.width = s.tank.pct.toFixed(0) + '%';
+                    $('tank_fill').style.backgroundColor = s.tank.pct <= s.tank.warnPct ? '#d32f2f' : '#ffc107';
+                    $('emerg').className = 'btn ' + (s.emergency ? 'btn-danger' : 'btn-sec');
+                    $('emerg_status').innerText = s.emergency ? 'ON' : 'OFF';
+                });
+        }
+        refresh();
+        setInterval(refresh, 5000);
+    </script>
 </body>
 </html>
 )rawliteral";
@@ -109,6 +132,7 @@ const char* htmlMaintenance = R"rawliteral(
         <a href='/test_pump' class='btn' style='background:#555; margin-bottom:10px'>Test Pump (1 Pulse)</a>
         <a href='/imu' class='btn btn-sec' style='margin-bottom:10px'>IMU Configuration</a>
         <a href='/console' class='btn btn-sec' style='margin-bottom:10px'>Serial Console</a>
+        <a href='/pump_stats' class='btn btn-sec' style='margin-bottom:10px'>Pump Timing</a>
     </div>
 
     <div class='card'>
@@ -123,7 +147,7 @@ const char* htmlMaintenance = R"rawliteral(
 </html>
 )rawliteral";
 
-const char* htmlHeader = R"rawliteral(
+const char* htmlSettings = R"rawliteral(
 <html>
 <head>
     <meta charset="UTF-8">
@@ -134,11 +158,11 @@ const char* htmlHeader = R"rawliteral(
 <body>
     <a href='/' class='back-btn'>&lt; Home</a>
     <h2>Juicer Settings</h2>
-    <div class='time'>Time: %TIME% | Sats: %SATS% | Temp: %TEMP%&deg;C</div>
+    <div class='time'>Time: <span id='time'>--</span> | Sats: <span id='sats'>-</span> | Temp: <span id='temp'>--</span>&deg;C</div>
     <form action='/save' method='POST'>
         <div class='card'>
             <h3>Driving Profile</h3>
-            <table>
+            <table id='ranges'>
                 <tr>
                     <th rowspan='2'>Speed</th>
                     <th rowspan='2'>km</th>
@@ -149,59 +173,103 @@ const char* htmlHeader = R"rawliteral(
                     <th style='text-align:center'>Juices</th>
                     <th style='text-align:center'>Pulses</th>
                 </tr>
-)rawliteral";
-
-const char* htmlFooter = R"rawliteral(
         </table>
+        <div style='text-align:left;margin-top:10px;margin-bottom:10px'><a href='/reset_time_stats' style='color:red;text-decoration:none;font-size:1.1em'>[Reset Stats]</a></div>
         </div>
         <div class='card'>
         <h3>Statistics</h3>
         <table>
-            <tr><td>Total Distance</td><td>%TOTAL_DIST% km</td></tr>
-            <tr><td>Total Juices</td><td>%PUMP_COUNT%</td></tr>
+            <tr><td>Total Distance</td><td><span id='odo'>-</span> km</td></tr>
+            <tr><td>Total Juices</td><td id='pumps'>-</td></tr>
         </table>
         <div style='margin-top:10px'><a href='/reset_stats' style='color:#d32f2f;text-decoration:none;font-size:1.1em'>[Reset Stats]</a></div>
-        <div class='progress'>Current Progress: %PROGRESS%%</div>
+        <div class='progress'>Current Progress: <span id='progress'>-</span>%</div>
         </div>
         <div class='card'>
         <h3>General</h3>
         <table>
-            <tr><td>Force Emergency Mode (simulates 50km/h constant speed)</td><td><input type='checkbox' name='emerg_mode' %EMERG_CHECKED%></td></tr>
-            <tr><td>Start Delay (m)</td><td><input type='number' step='1' name='start_dly' value='%START_DLY%' class='num-input'></td></tr>
-            <tr><td>Offroad Interval (min)</td><td><input type='number' name='offroad_int' value='%OFFROAD_INT%' class='num-input'></td></tr>
+            <tr><td>Force Emergency Mode (simulates 50km/h constant speed)</td><td><input type='checkbox' name='emerg_mode'></td></tr>
+            <tr><td>Start Delay (m)</td><td><input type='number' step='1' name='start_dly' class='num-input'></td></tr>
+            <tr><td>Offroad Interval (min)</td><td><input type='number' name='offroad_int' class='num-input'></td></tr>
             <tr><td colspan='2' style='height:20px;border-bottom:none'></td></tr>
             <tr><td colspan='2'><b>Chain Flush Mode:</b></td></tr>
-            <tr><td>Events (Total)</td><td><input type='number' name='flush_ev' value='%FLUSH_EV%' class='num-input'></td></tr>
-            <tr><td>Pulses per Event</td><td><input type='number' name='flush_pls' value='%FLUSH_PLS%' class='num-input'></td></tr>
-            <tr><td>Interval (Seconds)</td><td><input type='number' name='flush_int' value='%FLUSH_INT%' class='num-input'></td></tr>
+            <tr><td>Events (Total)</td><td><input type='number' name='flush_ev' class='num-input'></td></tr>
+            <tr><td>Pulses per Event</td><td><input type='number' name='flush_pls' class='num-input'></td></tr>
+            <tr><td>Interval (Seconds)</td><td><input type='number' name='flush_int' class='num-input'></td></tr>
         </table>
         </div>
         <div class='card'>
         <h3>Temperature Compensation</h3>
         <table>
-            <tr><td>Pulse Duration (ms) @ 25&deg;C</td><td><input type='number' min='50' name='tc_pulse' value='%TC_PULSE%' class='pulse-input'></td></tr>
-            <tr><td>Pause Duration (ms) @ 25&deg;C</td><td><input type='number' name='tc_pause' value='%TC_PAUSE%' class='num-input'></td></tr>
+            <tr><td>Pulse Duration (ms) @ 25&deg;C</td><td><input type='number' min='50' name='tc_pulse' class='pulse-input'></td></tr>
+            <tr><td>Pause Duration (ms) @ 25&deg;C</td><td><input type='number' name='tc_pause' class='num-input'></td></tr>
             <tr><td colspan='2'><b>Oil Viscosity Profile:</b></td></tr>
-            <tr><td><input type='radio' name='oil_type' value='0' %OIL_THIN%> Thin Oil</td><td>(e.g. ATF / Bio)</td></tr>
-            <tr><td><input type='radio' name='oil_type' value='1' %OIL_NORMAL%> Normal Oil</td><td>(e.g. Mineral Oil 80w90)</td></tr>
-            <tr><td><input type='radio' name='oil_type' value='2' %OIL_THICK%> Thick Oil</td><td>(e.g. Gear Oil SAE 90)</td></tr>
-            <tr><td colspan='2' style='font-size:1.1em;color:#888'>Current Temp: %TEMP_C% &deg;C</td></tr>
+            <tr><td><input type='radio' name='oil_type' value='0'> Thin Oil</td><td>(e.g. ATF / Bio)</td></tr>
+            <tr><td><input type='radio' name='oil_type' value='1'> Normal Oil</td><td>(e.g. Mineral Oil 80w90)</td></tr>
+            <tr><td><input type='radio' name='oil_type' value='2'> Thick Oil</td><td>(e.g. Gear Oil SAE 90)</td></tr>
+            <tr><td colspan='2' style='font-size:1.1em;color:#888'>Current Temp: <span id='temp_c'>--</span> &deg;C</td></tr>
         </table>
         </div>
         <div class='card'>
         <h3>Tank Monitor</h3>
         <table>
-            <tr><td>Enable</td><td><input type='checkbox' name='tank_en' %TANK_CHECKED%></td></tr>
-            <tr><td>Capacity (ml)</td><td><input type='number' step='1' name='tank_cap' value='%TANK_CAP%' class='num-input'></td></tr>
-            <tr><td>Drops/ml</td><td><input type='number' name='drop_ml' value='%DROP_ML%' class='num-input'></td></tr>
-            <tr><td>Drops/Pulse</td><td><input type='number' name='drop_pls' value='%DROP_PLS%' class='num-input'></td></tr>
-            <tr><td>Warning at (%)</td><td><input type='number' name='tank_warn' value='%TANK_WARN%' class='num-input'></td></tr>
-            <tr><td>Current Level</td><td>%TANK_LEVEL% ml (%TANK_PCT%%)</td></tr>
+            <tr><td>Enable</td><td><input type='checkbox' name='tank_en'></td></tr>
+            <tr><td>Capacity (ml)</td><td><input type='number' step='1' name='tank_cap' class='num-input'></td></tr>
+            <tr><td>Drops/ml</td><td><input type='number' name='drop_ml' min='1' class='num-input'></td></tr>
+            <tr><td>Drops/Pulse</td><td><input type='number' name='drop_pls' class='num-input'></td></tr>
+            <tr><td>Warning at (%)</td><td><input type='number' name='tank_warn' class='num-input'></td></tr>
+            <tr><td>Current Level</td><td><span id='tank_level'>-</span> ml (<span id='tank_pct'>-</span>%)</td></tr>
         </table>
         <div style='margin-top:10px'><a href='/refill' style='color:#28a745;text-decoration:none;font-size:1.1em'>[Refill Tank]</a></div>
         </div>
-        <input type='submit' value='Save' class='btn'>
+        <div id='load_err' style='color:red'></div>
+        <input type='submit' value='Save' class='btn' id='save' disabled>
     </form>
+    <script>
+        function $(id) { return document.getElementById(id); }
+        function field(name) { return document.getElementsByName(name)[0]; }
+        function json(url) { return fetch(url).then(response => response.json()); }
+        Promise.all([json('/api/config'), json('/api/stats'), json('/api/status')]).then(([c, st, s]) => {
+            $('time').innerText = s.time;
+            $('sats').innerText = s.sats;
+            $('temp').innerText = s.tempC == null ? '--' : s.tempC.toFixed(1);
+            $('temp_c').innerText = s.tempC == null ? '--' : s.tempC.toFixed(1);
+
+            var rows = '';
+            c.ranges.forEach((r, i) => {
+                rows += "<tr><td>" + r.minKmh + "-" + r.maxKmh + " km/h</td>" +
+                    "<td><input type='number' step='0.1' name='km" + i + "' value='" + r.km.toFixed(2) + "' class='km-input'></td>" +
+                    "<td style='text-align:center;color:#fff'>" + st.ranges[i].usagePct.toFixed(1) + "%</td>" +
+                    "<td style='text-align:center;color:#fff'>" + st.ranges[i].oilings + "</td>" +
+                    "<td><input type='number' name='p" + i + "' value='" + r.pulses + "' class='pulse-input'></td></tr>";
+            });
+            $('ranges').insertAdjacentHTML('beforeend', rows);
+
+            $('odo').innerText = st.odoKm.toFixed(1);
+            $('pumps').innerText = st.pumpCycles;
+            $('progress').innerText = st.progressPct.toFixed(1);
+
+            field('emerg_mode').checked = c.emergencyForced;
+            field('start_dly').value = c.startDelayM.toFixed(0);
+            field('offroad_int').value = c.offroadMin;
+            field('flush_ev').value = c.flush.events;
+            field('flush_pls').value = c.flush.pulses;
+            field('flush_int').value = c.flush.intervalS;
+            field('tc_pulse').value = c.tempComp.pulseMs;
+            field('tc_pause').value = c.tempComp.pauseMs;
+            document.querySelector("input[name='oil_type'][value='" + c.tempComp.oilType + "']").checked = true;
+            field('tank_en').checked = c.tank.enabled;
+            field('tank_cap').value = c.tank.capacityMl.toFixed(0);
+            field('drop_ml').value = c.tank.dropsPerMl;
+            field('drop_pls').value = c.tank.dropsPerPulse;
+            field('tank_warn').value = c.tank.warnPct;
+            $('tank_level').innerText = s.tank.levelMl.toFixed(1);
+            $('tank_pct').innerText = s.tank.pct.toFixed(0);
+            $('save').disabled = false; // Only a complete form may be saved
+        }).catch(() => {
+            $('load_err').innerText = 'Settings could not be loaded, reload the page.';
+        });
+    </script>
 </body>
 </html>
 )rawliteral";
@@ -471,6 +539,42 @@ const char* htmlIMU = R"rawliteral(
 </html>
 )rawliteral";
 
+const char* htmlPumpStats = R"rawliteral(
+<!DOCTYPE html>
+<html>
+<head>
+    <meta charset="UTF-8">
+    <meta name='viewport' content='width=device-width, initial-scale=1'>
+    <title>Pump Timing</title>
+    <link rel="stylesheet" href="/style.css">
+</head>
+<body>
+    <a href='/maintenance' class='back-btn'>&lt; Back</a>
+    <h2>Pump Timing</h2>
+
+    <div class='card'>
+        <h3>Deviation (achieved - requested)</h3>
+        <table>
+            <tr><td></td><td class='val'>Ramp Up</td><td class='val'>Hold</td><td class='val'>Ramp Down</td><td class='val'>Pause</td></tr>
+%SUMMARY_ROWS%
+        </table>
+        <div class='note'>Pulses: %PULSES%. Values in ms. Pause only between pulses of one oiling/bleeding run.</div>
+    </div>
+
+    <div class='card'>
+        <h3>Histogram (pulses)</h3>
+        <table>
+            <tr><td>Deviation</td><td class='val'>Ramp Up</td><td class='val'>Hold</td><td class='val'>Ramp Down</td><td class='val'>Pause</td></tr>
+%HIST_ROWS%
+        </table>
+        <div class='note'>Values update on refresh.</div>
+    </div>
+
+    <a href='/pump_stats_reset' class='btn btn-sec'>Reset Timing Stats</a>
+</body>
+</html>
+)rawliteral";
+
 const char* htmlAuxConfig = R"rawliteral(
 <html>
 <head>
@@ -592,6 +696,10 @@ const char* htmlAuxConfig = R"rawliteral(
                         <td style="font-size:1.1em; color:#ccc">Current Reading:</td>
                         <td style="font-size:1.1em; color:#ffc107; font-weight:bold">%CURRENT_TEMP% &deg;C</td>
                     </tr>
+                    <tr>
+                        <td style="color:#ccc">Sensor Conversion:</td>
+                        <td style="color:#ccc">%TEMP_CONV%</td>
+                    </tr>
                     <tr>
                         <td colspan="2" class="note" style="padding-bottom: 10px;">
                             Correction for sensor placement. Use <b>negative values</b> (e.g. -5.0) if sensor is near a hot engine to lower the reading.
@@ -648,11 +756,17 @@ const char* htmlConsole = R"rawliteral(
                 });
         }
         setInterval(fetchLogs, 200);
+        window.onload = function() {
+            fetch('/console/boot')
+                .then(response => response.text())
+                .then(data => { document.getElementById('boot').innerText = data; });
+        };
     </script>
 </head>
 <body>
     <a href='/' class='back-btn'>&lt; Home</a>
     <h2>Serial Console</h2>
+    <div style='font-size:0.8em;color:#aaa;margin-bottom:8px'>Boot: <span id='boot'>-</span></div>
     <div id='console'>Loading...</div>
     <form action='/console/clear' method='POST'>
         <input type='submit' value='Clear Log' class='btn'>
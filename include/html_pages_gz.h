@@ -0,0 +1,557 @@
+// Generated by tools/compress_pages.py from html_pages.h - do not edit.
+#ifndef HTML_PAGES_GZ_H
+#define HTML_PAGES_GZ_H
+
+#include <stdint.h>
+
+#define PAGES_ETAG "\"867c1ebb1f\""
+
+// htmlCss: 3146 -> 1089 bytes
+const uint8_t htmlCssGz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x56, 0x5b, 0x8f, 0xa3, 0x36,
+    0x14, 0x7e, 0xcf, 0xaf, 0x88, 0x34, 0x8a, 0xb6, 0x55, 0x4b, 0xea, 0x40, 0xe8, 0x8c, 0x40, 0xfb,
+    0xd0, 0xcb, 0xce, 0x5b, 0x7f, 0x41, 0xd5, 0x07, 0x63, 0x0e, 0xc1, 0x8d, 0x63, 0x23, 0xdb, 0x84,
+    0x64, 0xa3, 0xfc, 0xf7, 0x1e, 0x1b, 0x48, 0x80, 0x90, 0xd9, 0x4a, 0x55, 0x43, 0x46, 0x43, 0xec,
+    0x73, 0x3f, 0xdf, 0xb9, 0x2c, 0x32, 0x95, 0x9f, 0x2f, 0x85, 0x92, 0x36, 0x28, 0xe8, 0x81, 0x8b,
+    0x73, 0x62, 0xa8, 0x34, 0x81, 0x01, 0xcd, 0x8b, 0xf4, 0x40, 0xf5, 0x8e, 0xcb, 0x84, 0xa4, 0x15,
+    0xcd, 0x73, 0x2e, 0x77, 0xc9, 0x86, 0x54, 0xa7, 0x34, 0xa3, 0x6c, 0xbf, 0xd3, 0xaa, 0x96, 0x79,
+    0xf2, 0xb2, 0x09, 0xdd, 0x93, 0x32, 0x25, 0x94, 0x4e, 0x5e, 0x80, 0xb8, 0xe7, 0xba, 0x28, 0xc3,
+    0x8b, 0x85, 0x93, 0x0d, 0xa8, 0xe0, 0x3b, 0x99, 0x30, 0x90, 0x16, 0x74, 0x4f, 0x53, 0xf8, 0x4f,
+    0xea, 0x35, 0x36, 0xc0, 0x77, 0xa5, 0x4d, 0xa4, 0xd2, 0x07, 0x2a, 0x52, 0xcf, 0x62, 0x35, 0xaa,
+    0x2f, 0xf0, 0x20, 0xa9, 0xab, 0x0a, 0x34, 0xa3, 0x06, 0x52, 0x01, 0x16, 0x05, 0x04, 0xa6, 0xa2,
+    0xcc, 0x1b, 0x51, 0x9d, 0x50, 0x45, 0x74, 0xb9, 0x09, 0x64, 0x1b, 0xf2, 0xda, 0xd9, 0x1a, 0x58,
+    0x55, 0xa1, 0xbd, 0x99, 0xd2, 0x39, 0x72, 0x64, 0xca, 0x5a, 0x75, 0x70, 0x0c, 0x4b, 0xa3, 0x04,
+    0xcf, 0x97, 0x2f, 0x51, 0x14, 0xf5, 0xce, 0xf4, 0xb7, 0x31, 0xba, 0x34, 0xb4, 0x26, 0x53, 0x22,
+    0xbf, 0x2e, 0xd6, 0x8c, 0xea, 0xfc, 0x32, 0x72, 0x15, 0xdc, 0x73, 0x0f, 0x85, 0xe3, 0xeb, 0xf4,
+    0x68, 0x9a, 0xf3, 0xda, 0x24, 0xdb, 0xdb, 0xc9, 0x54, 0x65, 0x67, 0x5c, 0x6f, 0x4f, 0xec, 0x3c,
+    0xb0, 0x34, 0x13, 0x70, 0x69, 0x78, 0x6e, 0x4b, 0x8c, 0x2b, 0x59, 0xf5, 0xc2, 0xd0, 0x2d, 0x41,
+    0x2b, 0x03, 0x49, 0xff, 0x82, 0xa4, 0xe5, 0x30, 0x9e, 0x02, 0x0a, 0xdb, 0x47, 0x93, 0x31, 0xd6,
+    0x1a, 0x6f, 0xf8, 0x57, 0x48, 0x36, 0xeb, 0x0d, 0x1c, 0x90, 0x3c, 0xbf, 0x0c, 0x13, 0xb6, 0x1c,
+    0x58, 0x3a, 0x1b, 0x91, 0xeb, 0x82, 0xcb, 0xaa, 0xb6, 0x43, 0x5b, 0x7a, 0xfe, 0xb7, 0x59, 0x97,
+    0xb6, 0xdb, 0xed, 0x08, 0x05, 0xce, 0xc5, 0x7b, 0x7a, 0x27, 0x51, 0x09, 0xfb, 0xf8, 0xb6, 0x26,
+    0xfe, 0xec, 0x25, 0x9e, 0xdc, 0x2f, 0xa7, 0xe0, 0x66, 0xd7, 0xa9, 0xb3, 0xe2, 0x4f, 0x7b, 0xae,
+    0xe0, 0x33, 0x2b, 0x81, 0xed, 0xf1, 0xf0, 0xaf, 0xce, 0xa8, 0xd0, 0x01, 0xaf, 0x6c, 0x13, 0xe4,
+    0xdf, 0x29, 0x73, 0xb0, 0x0a, 0x46, 0x18, 0xb8, 0x2e, 0x0c, 0x08, 0x60, 0x76, 0x94, 0xb6, 0x30,
+    0x77, 0xcf, 0xa3, 0x79, 0x53, 0x7f, 0x7a, 0x8f, 0x5d, 0xb0, 0x28, 0x42, 0x8f, 0x22, 0x10, 0x19,
+    0x20, 0x36, 0x25, 0xa4, 0x08, 0x8d, 0x6c, 0xcf, 0x31, 0xfe, 0x93, 0xf3, 0xbb, 0x9e, 0x80, 0x1f,
+    0xe8, 0x0e, 0x92, 0x5a, 0x8b, 0xef, 0x3e, 0xe5, 0xd4, 0xd2, 0xc4, 0xff, 0xfe, 0xc9, 0x1c, 0x77,
+    0x3f, 0x9c, 0x0e, 0x22, 0x65, 0x25, 0xd5, 0x06, 0xec, 0xe7, 0xda, 0x16, 0xc1, 0xdb, 0x8f, 0xab,
+    0xe8, 0x37, 0xbc, 0x58, 0x85, 0x04, 0xaf, 0xa4, 0x59, 0x45, 0xbf, 0xaf, 0xc2, 0xb0, 0xb4, 0xb6,
+    0x5a, 0x45, 0xbf, 0xac, 0xc2, 0x77, 0xfc, 0x36, 0x4d, 0xb3, 0x6e, 0xa2, 0xb5, 0xd2, 0x48, 0xf4,
+    0x1e, 0x12, 0x4c, 0x48, 0xf8, 0xee, 0x39, 0x42, 0x64, 0xf2, 0x01, 0x69, 0x99, 0xc2, 0x6d, 0x7b,
+    0xd4, 0x06, 0x66, 0x7c, 0x76, 0xe4, 0xd0, 0xfc, 0xaa, 0x4e, 0xed, 0x21, 0x0a, 0x70, 0x42, 0x88,
+    0xbb, 0x24, 0x3d, 0x45, 0xc1, 0x85, 0x68, 0xaf, 0x57, 0x61, 0xd4, 0x46, 0xd0, 0xbd, 0x47, 0x5f,
+    0xd0, 0xbe, 0x8a, 0xa2, 0x8e, 0x90, 0xe4, 0xed, 0xfd, 0x1f, 0x78, 0x41, 0x36, 0x44, 0xc4, 0xf8,
+    0xcf, 0xff, 0x05, 0xf1, 0x57, 0xcf, 0xf6, 0xde, 0x52, 0x77, 0xe6, 0x45, 0x5f, 0x3e, 0x7d, 0x3f,
+    0x8c, 0x89, 0x06, 0x0c, 0x97, 0x2b, 0xef, 0xee, 0x6d, 0x78, 0x57, 0x29, 0xc3, 0x2d, 0x57, 0x32,
+    0xd1, 0xce, 0xf4, 0x25, 0xe2, 0x6c, 0xd9, 0xf5, 0x89, 0x01, 0x91, 0x47, 0x4c, 0xe8, 0xca, 0xaa,
+    0xaf, 0x59, 0x4f, 0x9d, 0x44, 0x0e, 0x01, 0xa3, 0xca, 0x99, 0xc5, 0xd3, 0x5a, 0xd6, 0x87, 0x60,
+    0x08, 0xed, 0x37, 0xc7, 0xf7, 0xd0, 0x99, 0x90, 0x70, 0x3f, 0xa6, 0x7b, 0x7d, 0x46, 0x57, 0xd5,
+    0xc2, 0xc0, 0x88, 0x34, 0x7e, 0x46, 0x9a, 0x59, 0x79, 0xc9, 0xb9, 0xa9, 0x04, 0x3d, 0x27, 0x99,
+    0x50, 0x6c, 0xff, 0x4d, 0x83, 0x3f, 0x2a, 0xa9, 0x5b, 0x3d, 0x87, 0xb3, 0x05, 0x19, 0xc7, 0xf1,
+    0x63, 0x8d, 0x4d, 0x5b, 0xd3, 0xa0, 0x43, 0xfa, 0xe6, 0xc5, 0x6a, 0x6d, 0x50, 0x7e, 0xa5, 0xb8,
+    0x8f, 0xfb, 0x63, 0xc7, 0xf6, 0x27, 0x39, 0x30, 0xa5, 0xa9, 0x4f, 0x95, 0xc3, 0x7c, 0xeb, 0x59,
+    0x42, 0x99, 0xe5, 0x47, 0x18, 0x15, 0x1a, 0xda, 0xd0, 0x5e, 0xe2, 0xf0, 0x60, 0xe3, 0x12, 0x0c,
+    0x6f, 0x13, 0x82, 0x52, 0x3a, 0x5f, 0x7f, 0x1d, 0x6b, 0x4e, 0xe5, 0x0e, 0xf4, 0x58, 0x2e, 0x21,
+    0x1f, 0x57, 0xef, 0x1b, 0x21, 0x1d, 0x37, 0xa3, 0x62, 0xac, 0xf8, 0x8d, 0xbe, 0x6e, 0xe3, 0x19,
+    0xee, 0xde, 0x13, 0xa4, 0x0d, 0xfe, 0x63, 0xa2, 0xba, 0xf1, 0xd3, 0xe9, 0xc0, 0x5a, 0x9d, 0x09,
+    0xe4, 0x28, 0x7b, 0x73, 0x51, 0x7d, 0x9e, 0xad, 0xc1, 0xc8, 0x98, 0x71, 0x1d, 0x08, 0x45, 0xef,
+    0x07, 0xa9, 0xf7, 0xbd, 0x71, 0x66, 0x9a, 0x19, 0x4b, 0xad, 0x33, 0xfd, 0x7f, 0x9c, 0x68, 0xe9,
+    0x64, 0x44, 0xf5, 0x5a, 0xb5, 0x6a, 0x6e, 0xf1, 0x2d, 0x04, 0x9c, 0xd2, 0xbf, 0x6b, 0x63, 0x79,
+    0x71, 0xc6, 0xde, 0x8d, 0xc1, 0x91, 0x36, 0x71, 0x73, 0x1d, 0x82, 0x0c, 0x6c, 0x03, 0x20, 0x27,
+    0x82, 0xbf, 0x35, 0xba, 0x66, 0x86, 0xf9, 0x40, 0x6f, 0x22, 0xa8, 0xc1, 0x19, 0x51, 0x72, 0x81,
+    0xa3, 0x7c, 0x24, 0xa5, 0x03, 0xc0, 0x11, 0x01, 0x33, 0x8d, 0xd6, 0xdc, 0xa2, 0xd2, 0xad, 0x46,
+    0x07, 0x25, 0x95, 0xb7, 0xb6, 0xd3, 0x51, 0x9b, 0x20, 0xa3, 0xfa, 0x32, 0x19, 0xc0, 0xc3, 0xd9,
+    0x3c, 0xf6, 0x26, 0x7c, 0xd6, 0x2c, 0x2c, 0x95, 0x7b, 0x2f, 0x6a, 0x00, 0xbd, 0x6e, 0xda, 0x3d,
+    0xac, 0x5c, 0xce, 0xeb, 0xc7, 0x09, 0xab, 0x8e, 0xa0, 0x0b, 0x81, 0x2e, 0x97, 0x3c, 0xcf, 0xef,
+    0x61, 0x74, 0xc5, 0xfe, 0x74, 0x86, 0xf7, 0x8a, 0xdd, 0x20, 0xb8, 0xdc, 0xd4, 0x39, 0xd4, 0x0f,
+    0xd4, 0x39, 0x2f, 0xfc, 0x52, 0xd6, 0xb6, 0x6b, 0x6f, 0xe0, 0x92, 0xac, 0x23, 0xe3, 0xda, 0xa1,
+    0x56, 0x3b, 0x0d, 0xc6, 0xcc, 0x6c, 0x7b, 0x0f, 0xcd, 0xe6, 0x16, 0x13, 0xa7, 0x95, 0x1f, 0xe0,
+    0xf9, 0x86, 0x38, 0xb3, 0xd3, 0x4c, 0xe1, 0x46, 0x7c, 0x9a, 0x11, 0x55, 0x6e, 0x87, 0xca, 0x2f,
+    0xca, 0x6d, 0x86, 0xf6, 0x9c, 0x90, 0x75, 0x9c, 0x76, 0xed, 0x2c, 0x80, 0x23, 0x0a, 0x35, 0x7d,
+    0xa2, 0xa5, 0xb2, 0xf0, 0x2f, 0xf2, 0xe4, 0xcc, 0x6d, 0x21, 0xe4, 0xef, 0x7c, 0xc5, 0xf4, 0xd8,
+    0xe5, 0x52, 0x70, 0x89, 0x38, 0x1d, 0xb6, 0x88, 0xf0, 0xbe, 0x95, 0xf8, 0xf7, 0x4e, 0x4c, 0x3b,
+    0xa5, 0x1e, 0xcb, 0x29, 0x26, 0xab, 0xeb, 0xa2, 0x16, 0xfd, 0x76, 0x16, 0xb8, 0x32, 0xf1, 0xa0,
+    0xb8, 0x2e, 0x5e, 0xb0, 0x1a, 0x30, 0x33, 0x30, 0x83, 0x80, 0x2d, 0x99, 0x42, 0xc0, 0x75, 0x99,
+    0x8f, 0xb7, 0x18, 0x8f, 0x9a, 0x1e, 0x13, 0x01, 0x2e, 0xf5, 0x4c, 0xe3, 0x36, 0x99, 0x36, 0x25,
+    0xb7, 0xe0, 0x17, 0x69, 0x48, 0x2a, 0x0d, 0x41, 0xa3, 0x69, 0x35, 0x8c, 0xf5, 0xf6, 0xd9, 0x72,
+    0x76, 0xeb, 0x6f, 0x05, 0x79, 0x56, 0x11, 0xff, 0x00, 0x0c, 0x4d, 0x4d, 0x65, 0x4a, 0x0c, 0x00,
+    0x00,
+};
+
+// htmlLanding: 2780 -> 990 bytes
+const uint8_t htmlLandingGz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x56, 0xdd, 0x6e, 0xdb, 0x36,
+    0x14, 0xbe, 0xcf, 0x53, 0x10, 0x6e, 0x33, 0xd9, 0x68, 0x25, 0x3b, 0x09, 0x8a, 0x15, 0x8e, 0xa5,
+    0x62, 0x73, 0x13, 0xa0, 0x5b, 0xd3, 0x04, 0x88, 0x77, 0x1d, 0xd0, 0xd4, 0xb1, 0xc4, 0x85, 0x22,
+    0x05, 0x92, 0x72, 0x6c, 0x64, 0x79, 0x82, 0x61, 0xd8, 0xfd, 0x6e, 0xb6, 0xc7, 0xd8, 0xf3, 0xec,
+    0x05, 0xd6, 0x47, 0xe8, 0x11, 0x25, 0xdb, 0xf2, 0x5f, 0xeb, 0x08, 0x10, 0x20, 0x9e, 0x73, 0xbe,
+    0xef, 0x1c, 0x1e, 0x92, 0x9f, 0x78, 0x34, 0x48, 0x6d, 0x26, 0xa2, 0xa3, 0x41, 0x0a, 0x34, 0x8e,
+    0x8e, 0x08, 0x3e, 0x83, 0x0c, 0x2c, 0x25, 0x2c, 0xa5, 0xda, 0x80, 0x0d, 0x5b, 0xbf, 0x8c, 0x2e,
+    0xfd, 0xb7, 0xad, 0xa6, 0x4b, 0xd2, 0x0c, 0x42, 0x6f, 0xca, 0xe1, 0x21, 0x57, 0xda, 0x7a, 0x84,
+    0x29, 0x69, 0x41, 0xda, 0xd0, 0x7b, 0xe0, 0xb1, 0x4d, 0xc3, 0x18, 0xa6, 0x9c, 0x81, 0xef, 0x06,
+    0xaf, 0x09, 0x97, 0xdc, 0x72, 0x2a, 0x7c, 0xc3, 0xa8, 0x80, 0xf0, 0xc4, 0xab, 0x89, 0x2c, 0xb7,
+    0x02, 0xa2, 0x61, 0x4a, 0xb9, 0x24, 0x3f, 0x15, 0x18, 0xaf, 0x07, 0xdd, 0xca, 0x56, 0xf9, 0x05,
+    0x97, 0xf7, 0x44, 0x83, 0x08, 0x5b, 0xc6, 0xce, 0x05, 0x98, 0x14, 0xc0, 0xb6, 0x48, 0xaa, 0x61,
+    0x12, 0xb6, 0xba, 0xce, 0x14, 0x30, 0x63, 0x16, 0x65, 0x39, 0x43, 0x34, 0x56, 0xf1, 0xfc, 0xd1,
+    0xc2, 0xcc, 0xfa, 0x54, 0xf0, 0x44, 0xf6, 0x19, 0x16, 0x05, 0xfa, 0x89, 0xa4, 0xa7, 0x8f, 0x19,
+    0xd5, 0x09, 0x97, 0xfe, 0x58, 0x59, 0xab, 0xb2, 0xfe, 0x9b, 0x7c, 0xf6, 0x34, 0xa8, 0x58, 0x70,
+    0xe6, 0xdd, 0x6a, 0xea, 0x83, 0x12, 0x5e, 0xf3, 0xa5, 0xa7, 0xd1, 0xe7, 0xbf, 0xff, 0xf8, 0x9d,
+    0xac, 0xd7, 0x87, 0xd6, 0xca, 0x1d, 0xf3, 0x29, 0x61, 0x82, 0x1a, 0x13, 0x7a, 0xc6, 0x52, 0x5b,
+    0x18, 0x7f, 0x4c, 0xb5, 0x17, 0x8d, 0x78, 0x06, 0x7d, 0x2c, 0x26, 0xa7, 0x92, 0xf0, 0x38, 0xf4,
+    0x2c, 0x8e, 0xbd, 0xc8, 0xf7, 0x31, 0x15, 0x9a, 0x22, 0xf2, 0x1b, 0xb9, 0xa5, 0xd6, 0x34, 0x23,
+    0x0c, 0x8e, 0x31, 0x62, 0x15, 0x30, 0x82, 0x2c, 0x5f, 0xa3, 0xc0, 0x71, 0x83, 0xe2, 0xbb, 0x18,
+    0x92, 0xf3, 0xe1, 0xa0, 0x8b, 0x05, 0x44, 0x47, 0x3b, 0x6b, 0xc1, 0x29, 0xce, 0xea, 0x1e, 0x57,
+    0x33, 0x39, 0x8b, 0x6e, 0xd1, 0xcc, 0x8d, 0xe5, 0xcc, 0xe0, 0x14, 0xce, 0x1a, 0xbe, 0x4d, 0xa8,
+    0x56, 0x0f, 0x5e, 0xe4, 0x72, 0x47, 0xd7, 0xb1, 0xc2, 0xa5, 0x06, 0xdd, 0x5f, 0x94, 0x56, 0x95,
+    0x54, 0x47, 0x4f, 0xa9, 0xa8, 0x03, 0x5d, 0x91, 0x2a, 0x56, 0x8d, 0x49, 0xdc, 0x67, 0xf5, 0x57,
+    0x5d, 0xe6, 0x21, 0xe9, 0x5c, 0x87, 0xc9, 0xc5, 0x14, 0x17, 0xcc, 0xec, 0x4f, 0xe9, 0x92, 0xe5,
+    0x45, 0x96, 0x37, 0x7a, 0xf6, 0x8c, 0x24, 0x37, 0x5a, 0x25, 0x1a, 0x8c, 0x39, 0x68, 0x4e, 0x79,
+    0x1d, 0xbc, 0xca, 0x74, 0xbc, 0x9d, 0xf1, 0x99, 0x0b, 0x31, 0xa2, 0xb8, 0xa7, 0xaf, 0x14, 0x1e,
+    0x08, 0xa5, 0x0f, 0x5f, 0x8a, 0x8f, 0x30, 0x05, 0x71, 0x50, 0xcd, 0x16, 0xf9, 0xef, 0x44, 0x19,
+    0xde, 0x58, 0x8e, 0x2e, 0xd9, 0x08, 0x60, 0x34, 0x6f, 0xb8, 0x33, 0xf1, 0xed, 0x46, 0x96, 0xb0,
+    0x6a, 0x87, 0x6f, 0x59, 0x27, 0x5c, 0xd4, 0xeb, 0xe2, 0xb8, 0xab, 0xa1, 0x3b, 0x58, 0xb5, 0x1a,
+    0xf4, 0x7b, 0xc7, 0x5e, 0xcd, 0xbd, 0xaf, 0x71, 0xb4, 0x3a, 0xd6, 0x5e, 0xd7, 0xaa, 0x24, 0x11,
+    0x70, 0x07, 0x19, 0xe8, 0xa4, 0x22, 0xad, 0x3f, 0xeb, 0x8c, 0x63, 0x2b, 0x09, 0xbe, 0xbe, 0x01,
+    0xe6, 0x45, 0xff, 0xfd, 0xf5, 0xcf, 0xff, 0xff, 0xfe, 0x49, 0x2e, 0xca, 0x08, 0x90, 0x6c, 0x8e,
+    0x8d, 0x8d, 0xd7, 0x4e, 0x9f, 0xc3, 0xde, 0x55, 0xe7, 0xb3, 0xb9, 0x5f, 0x68, 0xb4, 0x91, 0x16,
+    0x55, 0xce, 0x72, 0x99, 0x98, 0x66, 0x1e, 0xaf, 0xda, 0x92, 0x9a, 0xdc, 0xd6, 0xce, 0x1d, 0x38,
+    0x01, 0xf1, 0xdd, 0x2e, 0xec, 0xaa, 0xc6, 0x8f, 0x17, 0xef, 0xbf, 0x46, 0x40, 0x8b, 0xd9, 0x6e,
+    0xdc, 0x0f, 0xc5, 0x8c, 0xdc, 0xa0, 0xb4, 0xee, 0xc0, 0x64, 0x28, 0x48, 0x28, 0xb6, 0x54, 0x32,
+    0xd8, 0x8d, 0xbd, 0x5a, 0x05, 0xec, 0x80, 0xa7, 0x20, 0xf2, 0x7d, 0x38, 0x59, 0x50, 0xb1, 0x82,
+    0x18, 0xa6, 0x79, 0x6e, 0x57, 0x1b, 0x62, 0x52, 0x48, 0x66, 0xb9, 0x92, 0xe4, 0x65, 0x9b, 0xc7,
+    0x1d, 0xf2, 0x88, 0xe2, 0x6c, 0x0b, 0x2d, 0x49, 0xac, 0x58, 0x91, 0xe1, 0xb9, 0x0d, 0x12, 0xb0,
+    0x17, 0x02, 0xca, 0xcf, 0x1f, 0xe7, 0x1f, 0xe2, 0x32, 0xe8, 0x9c, 0x3c, 0x6d, 0xc3, 0xb1, 0x0e,
+    0x3c, 0x57, 0x69, 0x1b, 0x29, 0x96, 0x4e, 0x17, 0x00, 0x96, 0xa5, 0x6d, 0x6c, 0x4a, 0xce, 0xbb,
+    0xf5, 0xa2, 0x75, 0xd6, 0x02, 0xca, 0x27, 0xb0, 0x29, 0xc8, 0x36, 0xe2, 0x73, 0x25, 0x0d, 0x90,
+    0x30, 0x22, 0x8b, 0xef, 0xe0, 0x57, 0xa3, 0x64, 0xbb, 0xb3, 0x0f, 0x62, 0xca, 0xd8, 0xc7, 0x2d,
+    0x67, 0xf9, 0xbc, 0x6c, 0x57, 0x42, 0xdd, 0x09, 0xb8, 0x94, 0xa0, 0x47, 0xf8, 0xff, 0x20, 0x21,
+    0x31, 0x41, 0x69, 0x3c, 0xdf, 0x87, 0x70, 0xc2, 0xbd, 0x89, 0x28, 0x8d, 0x7b, 0x11, 0x4e, 0xc9,
+    0xb7, 0x72, 0xa0, 0x71, 0x48, 0xc2, 0x90, 0xc8, 0x42, 0x08, 0xf2, 0x8e, 0x78, 0xbe, 0xef, 0x91,
+    0xfe, 0xc2, 0x11, 0x58, 0x75, 0xc9, 0x67, 0x10, 0xb7, 0x4f, 0x3a, 0x7b, 0x69, 0x4b, 0xed, 0xdd,
+    0x64, 0x45, 0xdb, 0xcf, 0xd9, 0x21, 0xe0, 0x4a, 0x4b, 0x37, 0xe1, 0xa5, 0x75, 0x38, 0x67, 0xf8,
+    0xd3, 0xdd, 0x0f, 0x5c, 0xa8, 0xe3, 0x16, 0xb6, 0x76, 0xdc, 0x30, 0x7b, 0x48, 0x01, 0x0d, 0xc5,
+    0xda, 0x6a, 0x0d, 0xba, 0x02, 0xe7, 0xba, 0x12, 0x4b, 0xaa, 0xde, 0x37, 0xa8, 0x4a, 0x6d, 0xdb,
+    0x49, 0x84, 0x0e, 0xca, 0xb8, 0x9d, 0x3f, 0x83, 0xcb, 0x69, 0x59, 0x27, 0xa8, 0xee, 0x1a, 0x4e,
+    0xcb, 0x56, 0x74, 0x79, 0x63, 0x7a, 0xbd, 0x0e, 0x79, 0x45, 0xbc, 0x63, 0xef, 0x19, 0x6c, 0x63,
+    0xca, 0xee, 0x13, 0xad, 0x0a, 0x19, 0x0f, 0x95, 0x50, 0x7a, 0x8d, 0x97, 0x0c, 0x96, 0xa3, 0x07,
+    0xaa, 0x25, 0x36, 0xb2, 0xdc, 0x17, 0x2f, 0xe2, 0xb3, 0xd3, 0xc9, 0xe9, 0xa4, 0xdc, 0x1c, 0xde,
+    0x8b, 0xc9, 0x84, 0x9d, 0xf4, 0xbe, 0xdf, 0x9f, 0xb0, 0x52, 0xcd, 0x4e, 0xe0, 0x8e, 0xf9, 0x27,
+    0xbc, 0xac, 0x61, 0x02, 0x77, 0xd8, 0x3d, 0xac, 0xb4, 0x6d, 0x02, 0x58, 0x6a, 0xe6, 0x3b, 0x67,
+    0xf7, 0x63, 0x2a, 0x13, 0xd0, 0x8e, 0x7c, 0xa1, 0x07, 0x9d, 0xaf, 0xb3, 0x2f, 0x74, 0x75, 0xb3,
+    0xd9, 0x6b, 0xd4, 0xd7, 0x9f, 0x1c, 0xe5, 0xf5, 0xe5, 0xe5, 0x8e, 0x5a, 0x9f, 0x1a, 0x19, 0x56,
+    0x32, 0xb1, 0x54, 0x87, 0x95, 0x13, 0x25, 0xf6, 0x43, 0x79, 0x8f, 0xc3, 0x9f, 0x5d, 0xbb, 0x76,
+    0xbf, 0x26, 0x6f, 0x7a, 0xbd, 0xc5, 0xfa, 0xa1, 0xb0, 0xd7, 0x52, 0x35, 0xe8, 0x56, 0x57, 0x38,
+    0xfc, 0xb7, 0xba, 0x3b, 0xed, 0x17, 0xec, 0xcd, 0xb1, 0x6f, 0xdc, 0x0a, 0x00, 0x00,
+};
+
+// htmlSettings: 7288 -> 2065 bytes
+const uint8_t htmlSettingsGz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x19, 0x6b, 0x73, 0xe2, 0xc8,
+    0xf1, 0xfb, 0xfe, 0x8a, 0x29, 0x72, 0x7b, 0x12, 0x75, 0x46, 0x60, 0xf6, 0xb6, 0xe2, 0xd8, 0x40,
+    0xb2, 0xeb, 0xc7, 0xbd, 0xd6, 0xb7, 0xae, 0xc0, 0x25, 0x1f, 0x5c, 0x2e, 0x6a, 0x90, 0x1a, 0x98,
+    0x65, 0xf4, 0xb8, 0x99, 0x11, 0x36, 0xb9, 0xdc, 0x7f, 0x4f, 0xf7, 0x48, 0x02, 0x81, 0x84, 0x8d,
+    0xbd, 0x8e, 0xab, 0x76, 0x0b, 0x7a, 0xfa, 0x31, 0xfd, 0xee, 0x69, 0xde, 0xf4, 0xe6, 0x26, 0x94,
+    0x83, 0x37, 0xbd, 0x39, 0xf0, 0x60, 0xf0, 0x86, 0xe1, 0x5f, 0x2f, 0x04, 0xc3, 0x99, 0x3f, 0xe7,
+    0x4a, 0x83, 0xe9, 0x37, 0x7e, 0x1b, 0x5d, 0xb5, 0x4e, 0x1a, 0xe5, 0xa3, 0x88, 0x87, 0xd0, 0x77,
+    0x96, 0x02, 0xee, 0x93, 0x58, 0x19, 0x87, 0xf9, 0x71, 0x64, 0x20, 0x32, 0x7d, 0xe7, 0x5e, 0x04,
+    0x66, 0xde, 0x0f, 0x60, 0x29, 0x7c, 0x68, 0xd9, 0x2f, 0x47, 0x4c, 0x44, 0xc2, 0x08, 0x2e, 0x5b,
+    0xda, 0xe7, 0x12, 0xfa, 0xc7, 0x4e, 0xce, 0xc8, 0x08, 0x23, 0x61, 0xf0, 0x73, 0x8a, 0x98, 0x8a,
+    0x0d, 0xc1, 0x18, 0x11, 0xcd, 0x74, 0xaf, 0x9d, 0x81, 0x33, 0x14, 0x29, 0xa2, 0x05, 0x53, 0x20,
+    0xfb, 0x0d, 0x6d, 0x56, 0x12, 0xf4, 0x1c, 0xc0, 0x34, 0xd8, 0x5c, 0xc1, 0xb4, 0xdf, 0x68, 0x5b,
+    0x90, 0xe7, 0x6b, 0x8d, 0x37, 0xeb, 0xb5, 0xb3, 0xcb, 0xf7, 0x26, 0x71, 0xb0, 0xca, 0x89, 0x79,
+    0x86, 0xe8, 0xb4, 0xf1, 0x7a, 0x92, 0x6b, 0xdd, 0x77, 0x26, 0xdc, 0x5f, 0xb4, 0x26, 0x26, 0x72,
+    0x06, 0xdf, 0x4a, 0x73, 0xc6, 0x7e, 0x8c, 0x43, 0xe8, 0xb5, 0x79, 0x8e, 0x3e, 0xef, 0x56, 0xef,
+    0x82, 0xb0, 0xec, 0x30, 0x10, 0xcb, 0x82, 0x89, 0x11, 0x21, 0x38, 0x83, 0x11, 0xfe, 0x7f, 0xca,
+    0x7a, 0x3a, 0xe1, 0x11, 0x13, 0x41, 0x01, 0x6d, 0xb5, 0x7a, 0x6d, 0x02, 0x0d, 0xd8, 0x7f, 0xd9,
+    0x90, 0x1b, 0x5d, 0xc6, 0xd0, 0xf8, 0x1d, 0x31, 0x36, 0x08, 0x23, 0x08, 0x93, 0x2d, 0x16, 0xf8,
+    0xbd, 0xc4, 0xe2, 0xdb, 0x00, 0x66, 0x67, 0xe7, 0xbd, 0x36, 0x8a, 0xce, 0x2f, 0x31, 0x8d, 0x55,
+    0xc8, 0xb8, 0x6f, 0x44, 0x1c, 0xa1, 0x56, 0x9a, 0x2f, 0xc1, 0x61, 0xe8, 0x8d, 0x79, 0x8c, 0xc4,
+    0x37, 0x9f, 0x87, 0xa3, 0xdc, 0xb0, 0xbb, 0x17, 0xf6, 0xb9, 0x0a, 0x4a, 0x47, 0x99, 0xb2, 0xef,
+    0x06, 0x17, 0x4a, 0x2c, 0x51, 0x4b, 0x76, 0xa3, 0xe2, 0xa9, 0x90, 0x68, 0x08, 0x84, 0x6d, 0x23,
+    0x19, 0x3e, 0x91, 0x60, 0xaf, 0xa6, 0x78, 0x34, 0x03, 0xbd, 0xc3, 0x24, 0xc3, 0x51, 0x55, 0x60,
+    0x76, 0x30, 0x67, 0x2a, 0xbe, 0x27, 0x4d, 0xfa, 0x4e, 0xd7, 0x19, 0x0c, 0x13, 0x80, 0x00, 0x9d,
+    0x3b, 0x3f, 0x0c, 0x7d, 0x11, 0x3e, 0x8e, 0xeb, 0xc7, 0x32, 0xc3, 0x7d, 0xe7, 0x30, 0x1b, 0x07,
+    0x64, 0xbe, 0x07, 0xd3, 0xe2, 0x52, 0xcc, 0xa2, 0x53, 0x09, 0x53, 0xe3, 0x0c, 0xdc, 0x4f, 0x5c,
+    0x1b, 0xd6, 0xed, 0xb0, 0x2f, 0xe4, 0x56, 0xcd, 0xe2, 0x48, 0xae, 0x9a, 0xf5, 0x6c, 0x11, 0xaa,
+    0x9e, 0xa9, 0x5c, 0x55, 0xaa, 0x8f, 0x09, 0x00, 0xca, 0x19, 0xfc, 0xa6, 0xf9, 0x0c, 0xd8, 0xdb,
+    0xc7, 0x15, 0xd8, 0x4f, 0x6e, 0x83, 0x50, 0xbf, 0x94, 0xfa, 0x26, 0x95, 0x7a, 0x1f, 0xf5, 0xb6,
+    0x96, 0xf8, 0x8d, 0xfc, 0xbb, 0x13, 0x33, 0xf5, 0xc6, 0x3c, 0x0b, 0xb9, 0x9a, 0x89, 0xa8, 0x65,
+    0xe2, 0xe4, 0xf4, 0xb8, 0x93, 0x3c, 0x14, 0xdf, 0x27, 0xb1, 0x31, 0x71, 0x68, 0x41, 0xce, 0x60,
+    0x93, 0x70, 0x0a, 0xb0, 0x6c, 0x8c, 0x29, 0x25, 0xc6, 0xda, 0x50, 0xd8, 0x17, 0x6c, 0xd1, 0x6d,
+    0xb1, 0x3a, 0x55, 0x10, 0x9c, 0x59, 0x01, 0x01, 0xf8, 0xb1, 0xe2, 0x14, 0xcf, 0xa7, 0x51, 0x1c,
+    0xc1, 0xd9, 0x14, 0xab, 0x48, 0x4b, 0x8b, 0xff, 0xc0, 0xe9, 0xb1, 0x77, 0x0c, 0xa1, 0x33, 0xb8,
+    0xfd, 0x27, 0x71, 0x62, 0x43, 0x62, 0x72, 0x47, 0xa9, 0x5a, 0x4a, 0x87, 0x4c, 0x87, 0xed, 0xaf,
+    0xfb, 0xa3, 0x9e, 0x22, 0x9e, 0xd8, 0x08, 0x6d, 0x84, 0xaf, 0xb7, 0x83, 0xbd, 0xb7, 0x63, 0x88,
+    0xc2, 0xf7, 0x3d, 0x13, 0x0c, 0x46, 0xb1, 0xe1, 0x92, 0x5d, 0x20, 0x19, 0x8f, 0x7c, 0x4c, 0x12,
+    0x04, 0x11, 0x78, 0x93, 0xb5, 0x71, 0x10, 0x97, 0xb2, 0xda, 0xc6, 0x2d, 0x1e, 0x57, 0xe2, 0x69,
+    0x9b, 0xdf, 0xda, 0xc7, 0x96, 0x9b, 0xe5, 0x93, 0xa4, 0x61, 0x92, 0xd5, 0x87, 0x0a, 0xfd, 0xa3,
+    0x9e, 0xda, 0xf1, 0x4c, 0xd5, 0x0d, 0x75, 0x1e, 0xf8, 0x4b, 0xf0, 0xae, 0x3b, 0xed, 0x4e, 0x5f,
+    0xcb, 0x0b, 0x25, 0xb3, 0x27, 0x2a, 0x9e, 0xa1, 0x5c, 0xd4, 0xe4, 0x3c, 0x55, 0x0a, 0x83, 0x92,
+    0xea, 0x8b, 0x85, 0x94, 0x4b, 0xdd, 0x06, 0xab, 0xb0, 0xdc, 0xdb, 0xaf, 0xf2, 0xec, 0x0f, 0x10,
+    0x81, 0xe2, 0xf2, 0x70, 0xb7, 0x5e, 0xc5, 0xca, 0x07, 0x76, 0x19, 0x82, 0x9a, 0x41, 0xe4, 0xaf,
+    0xd8, 0x75, 0x1c, 0x00, 0x73, 0xb5, 0x08, 0x53, 0xc9, 0x0d, 0xd6, 0x8a, 0xf7, 0x9d, 0x45, 0xd8,
+    0xa6, 0x32, 0x13, 0x91, 0xe3, 0x0d, 0xd3, 0x54, 0xbe, 0x9a, 0x1b, 0xf7, 0x8b, 0x28, 0x49, 0x0d,
+    0x33, 0xab, 0x84, 0x4c, 0x3a, 0x07, 0x7f, 0x31, 0x89, 0x1f, 0x9c, 0xbc, 0x2b, 0x02, 0x71, 0x1d,
+    0x87, 0xc8, 0xd1, 0x19, 0x3c, 0x11, 0x0d, 0x68, 0x52, 0x65, 0xd8, 0x05, 0x48, 0xbe, 0x62, 0x6e,
+    0xb8, 0x87, 0x7f, 0x94, 0x86, 0x13, 0x4c, 0x6d, 0xf4, 0x20, 0x24, 0x7d, 0xe7, 0xb8, 0x10, 0xa3,
+    0x89, 0x76, 0x1c, 0xc8, 0xd5, 0xba, 0xbd, 0x21, 0x62, 0xcb, 0x12, 0x3e, 0x29, 0xf7, 0xf3, 0x74,
+    0xaa, 0x62, 0x1e, 0xb0, 0x9f, 0xa8, 0x68, 0x2c, 0x31, 0x20, 0xdd, 0x50, 0x44, 0x4f, 0x88, 0xcf,
+    0xa4, 0xc6, 0x19, 0xe5, 0x58, 0x44, 0xe6, 0xf9, 0x72, 0x37, 0x65, 0xbb, 0xbb, 0x0e, 0xc8, 0x39,
+    0x88, 0xd9, 0xdc, 0x9c, 0x76, 0xa9, 0xaa, 0x4c, 0x62, 0x15, 0x80, 0x2a, 0xaa, 0x0a, 0x05, 0xe3,
+    0x73, 0x38, 0x0e, 0x7a, 0x93, 0xc1, 0xf9, 0x9c, 0x8b, 0x88, 0x5d, 0xc9, 0x54, 0xcf, 0xad, 0x4f,
+    0x4f, 0x7b, 0xed, 0xc9, 0x53, 0xc6, 0xb8, 0x5c, 0x62, 0x98, 0x6a, 0xe6, 0xda, 0xd4, 0x3c, 0xc8,
+    0x08, 0x53, 0xe2, 0x3f, 0x86, 0xe5, 0x0b, 0x2c, 0x9f, 0xd5, 0x67, 0x96, 0xe0, 0x98, 0x61, 0xe5,
+    0x1e, 0x2e, 0x2e, 0x91, 0xfa, 0x05, 0xf2, 0x36, 0x1e, 0x1e, 0x62, 0x9a, 0x47, 0x81, 0x7e, 0x86,
+    0x82, 0x87, 0xfb, 0xb8, 0x5a, 0xa1, 0x9e, 0x95, 0xbe, 0x34, 0x09, 0x61, 0xfe, 0x9a, 0x54, 0x01,
+    0x3b, 0x8f, 0xf1, 0x73, 0xa4, 0x6d, 0x3d, 0x3a, 0x3c, 0x9f, 0xad, 0x59, 0xd9, 0x45, 0x9a, 0xd5,
+    0x31, 0x0c, 0x67, 0xdd, 0x64, 0xff, 0x60, 0xdd, 0xf7, 0xc5, 0x10, 0xf5, 0x98, 0xca, 0x18, 0xfa,
+    0x7d, 0xe7, 0x7d, 0xa7, 0xd0, 0xdd, 0xf8, 0xe3, 0x84, 0xb8, 0xad, 0x55, 0xb7, 0xdf, 0x0e, 0x75,
+    0x2f, 0x4f, 0x5f, 0x7c, 0x8f, 0x8d, 0x78, 0x62, 0xf2, 0x75, 0xd9, 0x45, 0xb9, 0xf0, 0x59, 0x48,
+    0xf6, 0x2f, 0xa1, 0xfd, 0x58, 0x0b, 0xb3, 0x2a, 0xc6, 0xbc, 0x43, 0x12, 0x62, 0xeb, 0x76, 0x8a,
+    0x07, 0x22, 0x5e, 0x67, 0xbf, 0x90, 0x63, 0x02, 0x3b, 0x0c, 0x43, 0x2a, 0x45, 0x40, 0xc7, 0x19,
+    0xb0, 0xd1, 0x1c, 0x53, 0x0e, 0x85, 0xad, 0xb5, 0x73, 0xc1, 0x9b, 0x79, 0xec, 0xc3, 0xe8, 0x8a,
+    0xb5, 0xd9, 0x47, 0x11, 0x37, 0x5f, 0x4f, 0x1c, 0xbe, 0x1d, 0xd8, 0xaf, 0x38, 0x05, 0x63, 0x3c,
+    0x57, 0x05, 0x5e, 0x0b, 0xdb, 0x04, 0xe8, 0x84, 0x9d, 0x74, 0xee, 0xff, 0xd6, 0x79, 0x45, 0xc1,
+    0xdd, 0x4c, 0x4f, 0x7f, 0x51, 0x23, 0xf7, 0x07, 0xe0, 0xca, 0x0a, 0x1d, 0x7e, 0xb8, 0x64, 0x4f,
+    0x4a, 0xad, 0xab, 0x81, 0x3b, 0x1d, 0xf7, 0x2c, 0x6f, 0xd2, 0x27, 0x27, 0x27, 0x9b, 0x36, 0x5a,
+    0xf7, 0x5a, 0x18, 0xfb, 0xe5, 0x27, 0x47, 0x39, 0xc6, 0x5e, 0x35, 0x3b, 0x39, 0x3e, 0xc2, 0xae,
+    0x63, 0x7c, 0xc4, 0xc5, 0xea, 0xf0, 0x8c, 0xbc, 0x8c, 0xe8, 0xec, 0xb0, 0x8e, 0x89, 0x2d, 0x76,
+    0x31, 0x86, 0xe8, 0xc9, 0xec, 0x3a, 0xe7, 0x09, 0xf7, 0x29, 0x98, 0xdd, 0x50, 0x3e, 0xaf, 0x59,
+    0x5a, 0x09, 0x3e, 0x4f, 0x5e, 0x50, 0x41, 0x2f, 0x54, 0x9c, 0xe8, 0x76, 0x28, 0x0f, 0x49, 0xde,
+    0x00, 0x71, 0xc7, 0xa1, 0xcc, 0x6b, 0xca, 0xf1, 0x8b, 0xa5, 0xd9, 0x72, 0x76, 0xb0, 0xc0, 0x97,
+    0x75, 0x86, 0x7f, 0x73, 0x15, 0xd1, 0xfb, 0x8f, 0x1b, 0xe6, 0xbe, 0x3d, 0xa8, 0x2b, 0x58, 0x23,
+    0xde, 0x23, 0xd9, 0x0b, 0xa4, 0x15, 0x61, 0xfc, 0x09, 0x96, 0x20, 0x6b, 0xc6, 0x68, 0xcb, 0x5b,
+    0xd2, 0x61, 0x69, 0x9a, 0x0e, 0xb1, 0x6d, 0xed, 0xa0, 0x24, 0xbe, 0x29, 0x0d, 0x8d, 0xcd, 0x57,
+    0x9d, 0x96, 0xb1, 0x3e, 0xca, 0xdd, 0x41, 0xb9, 0x7b, 0xc2, 0xff, 0xfa, 0xfd, 0xfb, 0xc3, 0x07,
+    0x65, 0xe2, 0xc1, 0x28, 0x63, 0x0e, 0x7d, 0xae, 0x90, 0x66, 0x92, 0x26, 0x2a, 0x50, 0xaa, 0xfa,
+    0x4e, 0x72, 0x2a, 0x2c, 0xca, 0xee, 0xd1, 0xe9, 0x24, 0x14, 0x66, 0x5d, 0xa4, 0x86, 0x76, 0x23,
+    0x50, 0xec, 0x3a, 0x0c, 0xba, 0x29, 0xdb, 0x3b, 0x10, 0x34, 0x10, 0x9a, 0xac, 0x52, 0xec, 0x77,
+    0xda, 0xb4, 0x4b, 0xc8, 0x3f, 0x6b, 0x5f, 0x89, 0xc4, 0x6c, 0x44, 0x4c, 0xd3, 0xc8, 0xee, 0x18,
+    0xd8, 0x37, 0xae, 0x08, 0x9a, 0xec, 0x0f, 0xa6, 0x00, 0x3b, 0x73, 0xc4, 0x82, 0xd8, 0x4f, 0x43,
+    0xf4, 0xa1, 0x37, 0x03, 0x73, 0x29, 0x81, 0x3e, 0x7e, 0x5c, 0xfd, 0x14, 0x10, 0xd2, 0x19, 0xfb,
+    0xb3, 0x4a, 0x3e, 0x15, 0x20, 0x03, 0x97, 0x42, 0xe7, 0x71, 0x26, 0xfa, 0xe3, 0xea, 0x57, 0x44,
+    0xca, 0x30, 0x6f, 0x3b, 0x77, 0xb5, 0xcc, 0xbe, 0xe8, 0x38, 0x72, 0x53, 0x25, 0x4b, 0xac, 0xa6,
+    0x60, 0xfc, 0xb9, 0x85, 0x79, 0x66, 0x0e, 0x91, 0x8b, 0x0f, 0x8a, 0x04, 0xe7, 0x75, 0x60, 0xfd,
+    0x01, 0x2b, 0x3e, 0x7b, 0x96, 0xae, 0xb9, 0x75, 0x41, 0xec, 0x84, 0xa1, 0xc0, 0x23, 0x2e, 0xa5,
+    0x7b, 0x6b, 0xcf, 0x9d, 0x36, 0x4f, 0x44, 0x1b, 0xc7, 0xa3, 0xa9, 0x98, 0x39, 0xcd, 0x23, 0x56,
+    0x02, 0x66, 0xaf, 0xa7, 0x2a, 0x2c, 0x45, 0xe0, 0x5d, 0x2e, 0xd8, 0xbd, 0xf5, 0x8f, 0xd0, 0x73,
+    0xf8, 0xef, 0xae, 0x49, 0xc2, 0xff, 0xd8, 0xca, 0x80, 0x6f, 0xdc, 0x6c, 0x39, 0xd4, 0xf4, 0x44,
+    0x84, 0x0d, 0x6a, 0x84, 0x91, 0xc4, 0xfa, 0x4c, 0x7b, 0x04, 0x3c, 0xdb, 0xc5, 0xb4, 0x4b, 0xa2,
+    0x5d, 0x4c, 0x02, 0x56, 0x30, 0xed, 0xb6, 0xa8, 0xc2, 0x13, 0x81, 0xe7, 0xac, 0xdf, 0x67, 0x51,
+    0x8a, 0x61, 0xf8, 0x77, 0xe6, 0xb4, 0x5a, 0x0e, 0x3b, 0x2d, 0x0e, 0x3c, 0x13, 0x5f, 0x89, 0x07,
+    0x08, 0xdc, 0xe3, 0x66, 0x2d, 0x3b, 0x6c, 0x27, 0x5f, 0xc1, 0x70, 0x8b, 0xe3, 0x12, 0x5b, 0x22,
+    0xed, 0x73, 0x90, 0x89, 0xe3, 0x6c, 0x0b, 0xf3, 0xbd, 0x6c, 0x9b, 0xe4, 0x61, 0x08, 0x5e, 0x72,
+    0xf4, 0xa0, 0xab, 0x8e, 0x98, 0xa8, 0x31, 0x1c, 0xfd, 0x59, 0x1e, 0xdf, 0xf5, 0x59, 0xa3, 0xa8,
+    0x23, 0x0d, 0xf6, 0x1d, 0x53, 0x1e, 0x96, 0xd7, 0x5f, 0xc2, 0x39, 0x7e, 0x6c, 0xb4, 0x72, 0x00,
+    0x7f, 0xc8, 0x01, 0x8c, 0x1e, 0x6e, 0xb6, 0x2c, 0xe0, 0x49, 0xed, 0x02, 0xa5, 0xf1, 0x44, 0xd3,
+    0xe8, 0x78, 0xeb, 0xb6, 0xb1, 0x08, 0x89, 0xbd, 0x20, 0xbe, 0xeb, 0x2c, 0xcb, 0x04, 0x2e, 0xc2,
+    0xb5, 0xf2, 0xdd, 0x66, 0x76, 0x9e, 0x27, 0xde, 0x62, 0xbb, 0x24, 0x3e, 0x76, 0x8b, 0xbd, 0x7b,
+    0x9c, 0x62, 0x02, 0x98, 0x4e, 0xa7, 0x8e, 0x55, 0x59, 0x9b, 0xdc, 0x6a, 0xb7, 0xe2, 0xce, 0x4b,
+    0x69, 0xc1, 0x74, 0xe3, 0x9b, 0x92, 0xf9, 0xe9, 0x06, 0x6f, 0xff, 0x5f, 0xf2, 0x70, 0x1a, 0xa2,
+    0x75, 0x28, 0xc9, 0x78, 0xa1, 0x61, 0x33, 0x6b, 0x26, 0xfb, 0x8c, 0x99, 0x64, 0x8f, 0xa2, 0xb2,
+    0x15, 0xf7, 0x0c, 0xdd, 0x8d, 0xed, 0x58, 0xfa, 0xb3, 0x1a, 0xc8, 0xf9, 0xaa, 0x92, 0x02, 0x59,
+    0x83, 0x32, 0x1f, 0x82, 0x2f, 0x9c, 0x74, 0xfc, 0x71, 0x74, 0xfd, 0xc9, 0x75, 0x26, 0x80, 0x41,
+    0x07, 0x10, 0x05, 0xce, 0x91, 0x0d, 0xad, 0xdd, 0xb0, 0x45, 0x7a, 0xda, 0xe7, 0xec, 0x64, 0x81,
+    0xf1, 0x10, 0xf8, 0x4b, 0xf8, 0x58, 0xfa, 0x64, 0xdb, 0x9b, 0x0a, 0x1d, 0x81, 0xcf, 0x57, 0xbe,
+    0x84, 0x6a, 0xfe, 0xae, 0x57, 0x20, 0x55, 0xa2, 0xfc, 0x64, 0xdb, 0xc3, 0x3b, 0x37, 0xcd, 0x8a,
+    0x6b, 0x79, 0xd7, 0xd0, 0xf4, 0xec, 0x58, 0x05, 0x01, 0x72, 0xf1, 0x3d, 0x28, 0x56, 0x1b, 0x76,
+    0xd3, 0x11, 0x9c, 0xd5, 0x11, 0x6f, 0x36, 0x08, 0x4d, 0xcf, 0xfa, 0xc3, 0x52, 0x5a, 0xa8, 0x5d,
+    0x49, 0x5c, 0xaf, 0xc5, 0x77, 0x9a, 0xb5, 0x0c, 0xca, 0xcb, 0x80, 0x32, 0x8b, 0x1c, 0x8e, 0x03,
+    0x79, 0x2d, 0xd9, 0xfa, 0xf9, 0x5c, 0xa6, 0xb1, 0x40, 0x0f, 0xec, 0x5b, 0xfc, 0x11, 0x2a, 0x9a,
+    0x75, 0xaa, 0x64, 0x59, 0x00, 0x3d, 0x42, 0xb6, 0x7b, 0xc3, 0x8c, 0x4c, 0xe4, 0x8f, 0xe3, 0x61,
+    0x2d, 0xe5, 0xfa, 0x21, 0x58, 0x26, 0xb4, 0x75, 0x0f, 0x9f, 0xa8, 0x99, 0xc8, 0x6b, 0xbd, 0x97,
+    0xd2, 0xbe, 0xe1, 0xea, 0x29, 0xe9, 0x68, 0x97, 0x72, 0xdd, 0x17, 0x7f, 0x4f, 0x41, 0xad, 0x86,
+    0x20, 0xc1, 0xc7, 0x71, 0xdb, 0x6d, 0xd8, 0x0c, 0xb8, 0xdd, 0x79, 0x95, 0xdc, 0xdd, 0x96, 0xd2,
+    0xa7, 0xc4, 0x19, 0x11, 0x46, 0x78, 0x6e, 0x13, 0xe9, 0xae, 0x51, 0x0e, 0x08, 0xa3, 0x52, 0xa8,
+    0xbf, 0x6a, 0x3e, 0x7a, 0x6f, 0x47, 0x0f, 0x41, 0x3d, 0xb0, 0x13, 0x7c, 0xb0, 0x9f, 0x8c, 0xe6,
+    0xe9, 0x2d, 0x0d, 0x89, 0xca, 0xcf, 0x67, 0xf4, 0x6b, 0xf9, 0x54, 0xf4, 0x14, 0xc3, 0x72, 0x85,
+    0x05, 0x1d, 0xe8, 0x1b, 0x50, 0xd7, 0x72, 0x3f, 0xdd, 0x6e, 0x1c, 0x6c, 0x11, 0xda, 0xf1, 0x79,
+    0xff, 0xbd, 0xed, 0x08, 0x5b, 0x21, 0x26, 0x28, 0xa6, 0x5c, 0xb5, 0x33, 0x6e, 0x26, 0xd3, 0x4a,
+    0x77, 0x24, 0x3a, 0x7b, 0x54, 0xd2, 0xb6, 0xae, 0xb9, 0x16, 0x93, 0x6b, 0x2d, 0x83, 0xa4, 0x94,
+    0xe7, 0x9d, 0x66, 0xcd, 0x48, 0xb0, 0xa4, 0x40, 0x2a, 0x06, 0x38, 0xa4, 0x9b, 0x72, 0x52, 0x8f,
+    0xb5, 0xdb, 0xec, 0x73, 0x24, 0x57, 0x8c, 0xe3, 0x93, 0x32, 0x4c, 0x24, 0x18, 0x60, 0xf6, 0x17,
+    0xa2, 0x90, 0xaf, 0xd8, 0x04, 0x18, 0xd1, 0x05, 0x6f, 0x36, 0x95, 0x12, 0x3d, 0x43, 0xf3, 0x92,
+    0x5b, 0x3f, 0xa2, 0xac, 0x47, 0xd0, 0xed, 0x2b, 0x3a, 0xc5, 0x6f, 0x61, 0x28, 0x23, 0x95, 0x01,
+    0x8b, 0x62, 0x43, 0xbc, 0x09, 0x1b, 0x82, 0x23, 0xfa, 0x69, 0x8e, 0xd6, 0x88, 0x38, 0x05, 0xb1,
+    0x04, 0x7b, 0x92, 0x57, 0x6a, 0xf5, 0x45, 0x69, 0xc6, 0x51, 0x3d, 0x9f, 0x2f, 0x7b, 0xed, 0xec,
+    0xc7, 0x39, 0x7c, 0x43, 0xda, 0xdf, 0x1b, 0xff, 0x07, 0x01, 0xcd, 0x91, 0x9a, 0x78, 0x1c, 0x00,
+    0x00,
+};
+
+// htmlHelp: 6816 -> 2275 bytes
+const uint8_t htmlHelpGz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0x6b, 0x6f, 0xdb, 0xc8,
+    0x15, 0xfd, 0x9e, 0x5f, 0x71, 0x91, 0x45, 0x97, 0x12, 0x60, 0x49, 0x7e, 0xd4, 0x69, 0xe0, 0xc8,
+    0x02, 0x9c, 0x38, 0x4e, 0xd2, 0xc6, 0x0f, 0xd8, 0x4e, 0x8d, 0xa2, 0xe8, 0x87, 0x11, 0x39, 0x12,
+    0x67, 0x4d, 0x72, 0xd8, 0x99, 0xa1, 0x64, 0xb5, 0xd8, 0xff, 0xbe, 0xe7, 0xce, 0x90, 0x7a, 0x38,
+    0x92, 0x12, 0x3b, 0x59, 0x7f, 0x30, 0x64, 0x8a, 0x73, 0xdf, 0xf7, 0xdc, 0x73, 0xc7, 0x2f, 0xfa,
+    0xa9, 0xcb, 0xb3, 0xc1, 0x8b, 0x7e, 0x2a, 0x45, 0x32, 0x78, 0x41, 0xf8, 0xe9, 0xe7, 0xd2, 0x09,
+    0x8a, 0x53, 0x61, 0xac, 0x74, 0xc7, 0x2f, 0xbf, 0xdc, 0x9e, 0x75, 0x5e, 0xbf, 0x5c, 0xfe, 0xaa,
+    0x10, 0xb9, 0x3c, 0x8e, 0x26, 0x4a, 0x4e, 0x4b, 0x6d, 0x5c, 0x44, 0xb1, 0x2e, 0x9c, 0x2c, 0xdc,
+    0x71, 0x34, 0x55, 0x89, 0x4b, 0x8f, 0x13, 0x39, 0x51, 0xb1, 0xec, 0xf8, 0x3f, 0x76, 0x48, 0x15,
+    0xca, 0x29, 0x91, 0x75, 0x6c, 0x2c, 0x32, 0x79, 0xbc, 0x17, 0xd5, 0x82, 0x9c, 0x72, 0x99, 0x1c,
+    0x7c, 0x94, 0x59, 0xd9, 0xef, 0x85, 0xcf, 0xe1, 0x79, 0xa6, 0x8a, 0x7b, 0x32, 0x32, 0x3b, 0x7e,
+    0x69, 0xdd, 0x2c, 0x93, 0x36, 0x95, 0xd2, 0xbd, 0xa4, 0xd4, 0xc8, 0xd1, 0xf1, 0xcb, 0x9e, 0x7f,
+    0xd4, 0x8d, 0xad, 0x6d, 0xcc, 0xf1, 0x0f, 0x06, 0x43, 0x9d, 0xcc, 0xfe, 0x8f, 0x83, 0xb2, 0x93,
+    0x4a, 0x35, 0x4e, 0xdd, 0xd1, 0x5e, 0xf7, 0xd5, 0xef, 0xfd, 0xf0, 0x36, 0x3c, 0xeb, 0x05, 0xd7,
+    0xfa, 0xfc, 0x5a, 0x7d, 0x4e, 0x04, 0x89, 0x51, 0x0f, 0xc6, 0x67, 0xc2, 0xda, 0xe3, 0x68, 0x28,
+    0xe2, 0xfb, 0xce, 0xd0, 0x15, 0xd1, 0xe0, 0xd7, 0xcc, 0xbd, 0xa1, 0x8f, 0x3a, 0x97, 0xfd, 0x9e,
+    0xa8, 0x5f, 0x4f, 0xf7, 0x07, 0xe7, 0xa2, 0xa8, 0x44, 0x06, 0x59, 0xfb, 0xf5, 0xb3, 0x44, 0x4d,
+    0xc8, 0x6b, 0x38, 0x8e, 0x9c, 0x7c, 0x70, 0x1d, 0x91, 0xa9, 0x71, 0x71, 0x14, 0x23, 0x0e, 0xd2,
+    0xbc, 0x89, 0x75, 0xa6, 0xcd, 0xd1, 0x2f, 0xaf, 0x5f, 0xbf, 0x7e, 0x93, 0x0b, 0x33, 0x56, 0x45,
+    0x67, 0xa8, 0x9d, 0xd3, 0xf9, 0xd1, 0xde, 0x61, 0xf9, 0x10, 0x0d, 0xfe, 0x29, 0x8d, 0x55, 0xba,
+    0x38, 0xa2, 0xbd, 0xee, 0x5e, 0x77, 0xb7, 0xdf, 0x83, 0xac, 0x46, 0xd3, 0xc1, 0xe0, 0x4c, 0x0a,
+    0x57, 0x19, 0x69, 0xa1, 0xeb, 0xa0, 0x7e, 0x5a, 0x65, 0xe1, 0x43, 0x1d, 0xa1, 0x41, 0x7f, 0x38,
+    0xf8, 0x70, 0x75, 0x43, 0xef, 0x10, 0x77, 0xa3, 0xb3, 0xa3, 0x7e, 0x6f, 0x38, 0xa0, 0x9b, 0x52,
+    0xca, 0xa4, 0x93, 0xc8, 0x52, 0x16, 0x09, 0x8c, 0x40, 0xdc, 0x61, 0xc8, 0x44, 0x64, 0x96, 0x5a,
+    0x27, 0xb1, 0x53, 0x13, 0x49, 0x03, 0xda, 0xdb, 0xa5, 0xfb, 0xbc, 0x97, 0xb6, 0xbb, 0xfd, 0x1e,
+    0xa4, 0x3c, 0x16, 0x79, 0x6a, 0xd4, 0xc8, 0xd1, 0x99, 0xca, 0x70, 0x30, 0xc8, 0xfc, 0x34, 0x2e,
+    0x34, 0x2c, 0x21, 0x56, 0x66, 0xe1, 0x9e, 0xc8, 0x90, 0x9a, 0x51, 0x26, 0x21, 0x4f, 0x17, 0x10,
+    0x9c, 0x57, 0x99, 0x53, 0xa5, 0x70, 0x69, 0x9b, 0x9c, 0xa6, 0xd2, 0xc8, 0x09, 0x6b, 0x1e, 0xa7,
+    0xda, 0x3a, 0xca, 0x55, 0x26, 0xc5, 0x58, 0xae, 0x57, 0x75, 0x2d, 0x54, 0x41, 0xe7, 0x3a, 0x91,
+    0x5e, 0xcf, 0xfc, 0xdb, 0xaf, 0x9c, 0x5d, 0x3e, 0x76, 0xaa, 0xab, 0x21, 0x0a, 0x82, 0xb4, 0xca,
+    0x48, 0xe4, 0xba, 0x2a, 0xdc, 0x23, 0xd9, 0xcb, 0x2f, 0xdf, 0x56, 0x06, 0x06, 0xea, 0xd1, 0x88,
+    0x44, 0x85, 0xb8, 0x0b, 0xa7, 0x50, 0x7e, 0xd9, 0x8c, 0xc4, 0x08, 0xce, 0xd1, 0xc1, 0x2e, 0xcc,
+    0x2b, 0x48, 0x1b, 0xd2, 0x05, 0x3c, 0x1a, 0x6a, 0xbd, 0x4e, 0x56, 0xbf, 0xb7, 0x12, 0xf7, 0x75,
+    0x7e, 0xbc, 0x4b, 0xd9, 0x91, 0xb3, 0xac, 0xb2, 0xe9, 0x53, 0xdd, 0xb9, 0x54, 0x48, 0x4d, 0x29,
+    0x8d, 0xd2, 0x49, 0x6d, 0x5b, 0xeb, 0x56, 0xe5, 0x92, 0x86, 0xc2, 0xca, 0xa4, 0x4d, 0x23, 0x18,
+    0x17, 0x23, 0x82, 0x85, 0x2a, 0xc6, 0x5b, 0xfc, 0xfc, 0x62, 0xe5, 0xa8, 0xca, 0x56, 0xde, 0x26,
+    0x97, 0x4a, 0xee, 0xde, 0xe0, 0x60, 0x70, 0x18, 0x1d, 0x30, 0x99, 0x91, 0xc1, 0xb3, 0xe7, 0xf9,
+    0xf9, 0x36, 0x43, 0x71, 0xb1, 0xec, 0x27, 0x3a, 0xe9, 0x2b, 0x4f, 0x38, 0x64, 0x6d, 0xa2, 0x04,
+    0xdd, 0xc9, 0x21, 0x7d, 0xe2, 0xb2, 0x1c, 0x89, 0x58, 0x6e, 0x71, 0xea, 0xba, 0x42, 0xee, 0xca,
+    0x2a, 0x2f, 0x3d, 0xb2, 0xa8, 0xa2, 0xd2, 0x95, 0x45, 0x7c, 0xd8, 0xc9, 0xfd, 0x5d, 0xcb, 0xa5,
+    0x36, 0x52, 0x59, 0xe6, 0xfd, 0xe4, 0xae, 0xdf, 0x22, 0x09, 0xa6, 0x9f, 0x24, 0x89, 0xe2, 0xf2,
+    0x0f, 0x15, 0x7d, 0x6b, 0xd4, 0x78, 0x8c, 0x80, 0x88, 0x31, 0xc7, 0x07, 0x92, 0xd0, 0xba, 0x68,
+    0x18, 0x4a, 0x2a, 0x23, 0xb8, 0xa8, 0x51, 0xd3, 0xe2, 0x81, 0x5e, 0xed, 0xda, 0xf6, 0x16, 0xa9,
+    0x97, 0x05, 0xac, 0x99, 0x6a, 0x73, 0x6f, 0x49, 0x38, 0x80, 0x80, 0x28, 0x12, 0xeb, 0x60, 0xd1,
+    0xf3, 0x62, 0x7b, 0x39, 0x1a, 0x19, 0x2d, 0x92, 0x1f, 0x0b, 0x2d, 0xe4, 0xbc, 0x7a, 0xa0, 0xb7,
+    0x15, 0x40, 0xa6, 0xa0, 0x77, 0x99, 0x8a, 0xef, 0x59, 0xd2, 0x36, 0x1f, 0x7c, 0xf9, 0x01, 0x67,
+    0xe0, 0x8a, 0x2f, 0x39, 0x6e, 0x05, 0xc7, 0x05, 0xd8, 0x92, 0xdd, 0x71, 0x97, 0xd0, 0xca, 0x66,
+    0x46, 0x87, 0xdc, 0x27, 0xed, 0xef, 0xab, 0x3f, 0x9b, 0xe9, 0x29, 0x77, 0x9c, 0x77, 0xc6, 0x28,
+    0x5f, 0x2e, 0xd3, 0x54, 0x1a, 0x49, 0x89, 0xe2, 0x18, 0xc5, 0x92, 0x94, 0x25, 0x9b, 0x62, 0x64,
+    0xd0, 0xb0, 0x72, 0x75, 0x89, 0x16, 0x28, 0x2c, 0xdf, 0xd3, 0xcf, 0x0b, 0xde, 0xfb, 0x5c, 0x9a,
+    0xb1, 0x2c, 0xe2, 0xd9, 0x93, 0xc3, 0x07, 0x58, 0xe8, 0x88, 0x79, 0x0c, 0xd5, 0x88, 0x0a, 0xed,
+    0x71, 0x6e, 0x40, 0x07, 0xec, 0xf4, 0x16, 0x9f, 0x6f, 0x14, 0x70, 0xcf, 0x9f, 0x12, 0x5c, 0xa0,
+    0xec, 0x1b, 0xaa, 0x80, 0xe1, 0x17, 0xee, 0xd3, 0x61, 0xc0, 0x58, 0x42, 0x51, 0x90, 0x48, 0x12,
+    0x5f, 0xae, 0x3a, 0xc1, 0x38, 0x41, 0xdd, 0x6f, 0x11, 0x7a, 0xaa, 0xac, 0xf0, 0xf0, 0x16, 0xcd,
+    0xb1, 0x31, 0x7a, 0x5e, 0x48, 0x2e, 0x78, 0x04, 0x2e, 0xc2, 0x41, 0xa7, 0x2a, 0xb7, 0xf4, 0xf9,
+    0xfd, 0x29, 0xd7, 0x38, 0xe7, 0x24, 0x91, 0x23, 0x34, 0x4d, 0x42, 0xa9, 0xae, 0x8c, 0x5d, 0x0f,
+    0xcf, 0x3e, 0x38, 0x37, 0xa2, 0x69, 0x9a, 0x1b, 0xe9, 0xd0, 0x85, 0x63, 0xeb, 0x7d, 0x2a, 0x8d,
+    0x1e, 0x63, 0x26, 0x20, 0x93, 0xf8, 0x3e, 0x59, 0x6d, 0x00, 0x6a, 0xf5, 0xe9, 0x6f, 0xdb, 0x46,
+    0xcc, 0x8d, 0x13, 0xce, 0x36, 0x9d, 0x88, 0x89, 0x6b, 0xe7, 0xa1, 0xd9, 0xa1, 0xdf, 0x2a, 0xb0,
+    0x06, 0xbb, 0xe3, 0x95, 0x84, 0x68, 0x42, 0x15, 0x1a, 0x7d, 0xb9, 0xbf, 0x17, 0xee, 0xf3, 0xa4,
+    0xc4, 0xfc, 0x1b, 0xa9, 0x71, 0xdd, 0xb9, 0x4b, 0xe3, 0xb2, 0x9c, 0x7f, 0x23, 0xb9, 0xb2, 0xd8,
+    0xe9, 0xc5, 0x34, 0x04, 0xe4, 0xd6, 0xe2, 0x8d, 0x28, 0xc6, 0xa8, 0xc9, 0xc2, 0x03, 0x49, 0xee,
+    0xf1, 0x80, 0x53, 0x00, 0xf3, 0xca, 0xcd, 0x73, 0xd7, 0x8f, 0xd9, 0xa5, 0x89, 0x5b, 0x4b, 0x09,
+    0x4d, 0xb3, 0xb7, 0xdb, 0x39, 0x38, 0xdc, 0xe6, 0xff, 0x7d, 0xde, 0xe4, 0xa4, 0xe9, 0x88, 0xda,
+    0x2e, 0x6a, 0xdd, 0xe7, 0x6d, 0x1a, 0x4a, 0x37, 0x95, 0xb2, 0xa8, 0x8d, 0xde, 0x90, 0x9c, 0x2f,
+    0x16, 0x63, 0x95, 0xfe, 0x12, 0x04, 0x5d, 0x49, 0xc3, 0x94, 0x83, 0x9f, 0xa0, 0xf6, 0x12, 0xa3,
+    0x26, 0x7e, 0x02, 0x70, 0x1f, 0x7b, 0xc7, 0xd0, 0x71, 0xb5, 0x81, 0x29, 0xa8, 0x16, 0xc2, 0x5d,
+    0xe2, 0x3b, 0xf5, 0x3f, 0xbc, 0xb4, 0xc1, 0xc2, 0xbf, 0xfb, 0x2c, 0x04, 0xe1, 0x17, 0x55, 0x3e,
+    0x44, 0xb4, 0x20, 0xb8, 0x8e, 0xa2, 0x9f, 0xef, 0xa8, 0xe8, 0x00, 0xa2, 0x32, 0x59, 0x2f, 0xe2,
+    0xaa, 0xca, 0x6c, 0x23, 0xe2, 0x8a, 0x51, 0xbc, 0xf4, 0x0f, 0x7c, 0xe4, 0x03, 0x43, 0x68, 0x9d,
+    0xca, 0x91, 0x00, 0x77, 0x38, 0xa2, 0xfd, 0xf6, 0xfa, 0xec, 0x96, 0x8c, 0x2c, 0x14, 0xfd, 0xfb,
+    0x5a, 0x82, 0x83, 0x92, 0x2f, 0x9b, 0xff, 0x44, 0xdc, 0x4a, 0x3c, 0xe5, 0x0c, 0x45, 0x75, 0x10,
+    0x22, 0x5f, 0x2d, 0x51, 0x30, 0x9a, 0xfb, 0xa5, 0x5c, 0x54, 0xc7, 0xad, 0xcc, 0xa1, 0xd1, 0x73,
+    0x29, 0x30, 0x25, 0x7c, 0x2e, 0xec, 0xd7, 0x85, 0x72, 0x92, 0xfc, 0x56, 0x59, 0x57, 0x4f, 0x9b,
+    0x5c, 0x02, 0x93, 0x0a, 0x15, 0xdb, 0x05, 0x22, 0x32, 0xd9, 0x98, 0x28, 0x1b, 0x6b, 0xab, 0x1c,
+    0x4f, 0xe8, 0x85, 0xcc, 0x76, 0x77, 0x7b, 0x9d, 0x40, 0x9d, 0xae, 0x69, 0xd4, 0xb5, 0xfc, 0x6f,
+    0xa5, 0x98, 0x47, 0xb9, 0x25, 0x93, 0xac, 0x7f, 0xa1, 0x4b, 0x9f, 0x46, 0x80, 0x1b, 0x6b, 0x11,
+    0xde, 0x1d, 0x6e, 0x4d, 0x0e, 0x8b, 0xc7, 0x0c, 0xdb, 0x34, 0x1d, 0x63, 0x2b, 0x68, 0x58, 0x8e,
+    0x22, 0x59, 0x3a, 0xbf, 0x81, 0x57, 0xc9, 0x11, 0xf2, 0x82, 0xc2, 0x9a, 0x37, 0x2e, 0xf9, 0x6c,
+    0xf8, 0x30, 0x5d, 0x89, 0x0a, 0x9f, 0x9e, 0x22, 0x0e, 0x43, 0x82, 0x6e, 0x67, 0xe5, 0x5c, 0x1a,
+    0x33, 0x3f, 0x9a, 0x01, 0x37, 0x1e, 0xc5, 0xa5, 0x6e, 0x54, 0xc4, 0x27, 0x55, 0xc5, 0x0e, 0x5d,
+    0x78, 0xf1, 0x3b, 0x84, 0xbf, 0xe2, 0xfb, 0x0d, 0x75, 0xf6, 0x59, 0x8f, 0x55, 0x5c, 0x23, 0x01,
+    0xda, 0xcf, 0xce, 0x2c, 0xac, 0x79, 0x44, 0xd6, 0xf0, 0x3b, 0xae, 0x91, 0x96, 0x5b, 0xd4, 0x84,
+    0x30, 0x26, 0x24, 0x0b, 0x80, 0x7e, 0xe0, 0x03, 0x20, 0xda, 0x89, 0x34, 0xbd, 0xa9, 0x30, 0x18,
+    0x04, 0xcb, 0x0e, 0x2d, 0xe5, 0x90, 0xcf, 0x5a, 0x6f, 0xfb, 0x5a, 0x4c, 0x59, 0x6e, 0xad, 0x32,
+    0x81, 0xb6, 0xc0, 0x51, 0xd0, 0x94, 0xb5, 0x79, 0x4b, 0x49, 0x43, 0x3b, 0xe5, 0x52, 0xd8, 0xca,
+    0x5b, 0xe1, 0x27, 0xe4, 0x9e, 0x1f, 0x91, 0x15, 0x6c, 0xdc, 0x08, 0x53, 0x27, 0xd5, 0x03, 0x5d,
+    0xf1, 0xd4, 0xc3, 0x0e, 0x81, 0xaa, 0x35, 0x8f, 0x91, 0x8a, 0x39, 0x7c, 0xf0, 0x10, 0x6f, 0xa2,
+    0xd1, 0x04, 0xc4, 0x5e, 0x56, 0xae, 0xc4, 0x8c, 0x64, 0x17, 0x45, 0x8c, 0xda, 0x46, 0xa9, 0x28,
+    0xa8, 0xf0, 0x19, 0x0d, 0x38, 0x0a, 0x79, 0xa7, 0x32, 0x13, 0x33, 0x6f, 0xa3, 0x67, 0xdf, 0xda,
+    0x71, 0x7a, 0x86, 0xc2, 0x39, 0x36, 0x2c, 0x10, 0x3f, 0xa6, 0xb6, 0x80, 0x15, 0xc8, 0x01, 0x27,
+    0x04, 0x12, 0xdc, 0x37, 0x04, 0x31, 0xd7, 0x4e, 0x9b, 0xed, 0x25, 0x1c, 0xec, 0x9e, 0x36, 0xcb,
+    0x40, 0xa0, 0xd4, 0x97, 0x17, 0xb5, 0x64, 0x11, 0xe2, 0xea, 0x0d, 0x49, 0xd8, 0x10, 0x1e, 0xf6,
+    0x21, 0xd8, 0xef, 0x6f, 0xae, 0xbc, 0x62, 0x6c, 0x08, 0xd8, 0x20, 0x94, 0xe7, 0x55, 0x97, 0x17,
+    0x1b, 0x0a, 0xe1, 0x23, 0xd6, 0x1d, 0x44, 0xf3, 0x83, 0x51, 0x65, 0x8d, 0x19, 0x27, 0xa1, 0x08,
+    0xf0, 0xf0, 0xea, 0xee, 0xdc, 0x53, 0x40, 0x04, 0xa8, 0xfb, 0x7d, 0x63, 0x9d, 0xb9, 0x2a, 0xf2,
+    0x1e, 0x04, 0x9d, 0x63, 0xf7, 0xcc, 0xab, 0x9c, 0xd9, 0xaf, 0xa3, 0x0c, 0xf9, 0xca, 0xb6, 0x53,
+    0xc5, 0x25, 0x6c, 0xff, 0x54, 0xc4, 0x06, 0x89, 0x46, 0x19, 0xf9, 0xc3, 0x53, 0xe5, 0xd2, 0x7a,
+    0x6a, 0xb4, 0xee, 0x14, 0x7a, 0x29, 0x4e, 0x31, 0xee, 0xda, 0xdb, 0xc5, 0x71, 0xe1, 0x6c, 0x96,
+    0xc6, 0x95, 0x4b, 0x2d, 0xd3, 0x40, 0x03, 0xbf, 0x4c, 0x01, 0x34, 0xbe, 0x21, 0x96, 0xf9, 0x41,
+    0x1d, 0x28, 0xa6, 0x17, 0x08, 0xb4, 0xe5, 0x6d, 0x8f, 0xe6, 0xbc, 0xe1, 0x1b, 0x4e, 0x72, 0xc6,
+    0xaa, 0xda, 0xb0, 0x8f, 0xe0, 0x0a, 0x54, 0x72, 0x8e, 0x7d, 0xa9, 0x81, 0xf7, 0xd6, 0xd9, 0xf5,
+    0x79, 0xdd, 0x2e, 0x08, 0xbc, 0x15, 0x18, 0x15, 0xe4, 0xbc, 0xd3, 0xc6, 0xa0, 0xf8, 0x6c, 0x8d,
+    0x6a, 0x68, 0x55, 0xe1, 0xf9, 0x5f, 0x18, 0x8b, 0x20, 0x57, 0x65, 0x06, 0xca, 0x9f, 0x80, 0xed,
+    0x01, 0xbc, 0x53, 0x94, 0xa4, 0x2c, 0xb0, 0x14, 0xcb, 0xf6, 0x13, 0x18, 0xce, 0x6a, 0x4f, 0xdd,
+    0xa9, 0x33, 0x45, 0xbf, 0xae, 0x6e, 0x14, 0x2b, 0x7d, 0xe5, 0x5f, 0x40, 0xbb, 0xb2, 0xa1, 0x67,
+    0x67, 0xde, 0xc8, 0xe1, 0xac, 0x01, 0xd8, 0x6f, 0xd4, 0x7d, 0xcd, 0x0a, 0x83, 0x6b, 0x87, 0xab,
+    0xb4, 0x7a, 0xc3, 0xea, 0x2c, 0xc5, 0xca, 0x21, 0x4f, 0xa0, 0x78, 0xfb, 0xf4, 0x3d, 0xd1, 0x8c,
+    0xe5, 0xd6, 0x62, 0x03, 0x5f, 0xac, 0x66, 0x1e, 0x3f, 0x90, 0x3f, 0x2f, 0x00, 0x60, 0xba, 0x11,
+    0x46, 0x6a, 0x2b, 0xce, 0xaa, 0x22, 0xac, 0xdf, 0xdb, 0xef, 0x07, 0xf6, 0x1e, 0x82, 0xbd, 0x75,
+    0xef, 0xea, 0xf1, 0x18, 0xf8, 0xbc, 0x99, 0x5b, 0x36, 0xcd, 0xc8, 0x45, 0x39, 0xa0, 0x7d, 0xbb,
+    0x7a, 0xac, 0x41, 0xb0, 0x88, 0x5a, 0xe1, 0x1e, 0x84, 0x2e, 0x01, 0x7e, 0xe0, 0xf8, 0x72, 0x43,
+    0x53, 0x7f, 0x4b, 0x3b, 0xb5, 0x5e, 0xed, 0xee, 0x82, 0x96, 0x7a, 0xe0, 0xd8, 0x20, 0xe3, 0x60,
+    0xad, 0x8c, 0xe5, 0x6d, 0x69, 0x83, 0x13, 0x7f, 0x5d, 0x7b, 0xf0, 0xf1, 0xaa, 0xbe, 0xe1, 0xf0,
+    0xe1, 0xda, 0xc3, 0x5c, 0x4d, 0xcf, 0x0c, 0xd9, 0xc6, 0x7c, 0x9e, 0x0b, 0x26, 0x7f, 0x05, 0xd3,
+    0xc0, 0xed, 0xa9, 0x3c, 0x43, 0x69, 0x68, 0x20, 0xba, 0xe7, 0x42, 0x0d, 0xa3, 0xc0, 0x47, 0xf4,
+    0x2a, 0x28, 0xf7, 0x9c, 0x27, 0x60, 0x06, 0x34, 0xe5, 0x4d, 0x27, 0x13, 0xa1, 0x32, 0x26, 0xb3,
+    0x5f, 0xef, 0xdd, 0x9c, 0xc2, 0xb9, 0x62, 0x70, 0x82, 0xb1, 0x6c, 0x6f, 0x36, 0x11, 0x71, 0x02,
+    0x46, 0x60, 0xfa, 0x99, 0x38, 0x9d, 0x2d, 0x59, 0xc9, 0x97, 0x5f, 0xf5, 0xc5, 0x59, 0x81, 0xb1,
+    0x13, 0x0d, 0x98, 0xc5, 0xf8, 0xcb, 0xa0, 0x8c, 0x47, 0x4b, 0xc2, 0xbb, 0x11, 0x26, 0x8e, 0xaf,
+    0x69, 0x6e, 0x89, 0xc5, 0x05, 0xd7, 0xba, 0x52, 0xed, 0xd2, 0x52, 0x72, 0x16, 0xc0, 0x24, 0x81,
+    0x6b, 0x57, 0x46, 0x61, 0xf2, 0xa1, 0x2b, 0xc8, 0x5f, 0x0a, 0x78, 0xe4, 0xac, 0x4b, 0x60, 0x7d,
+    0x3a, 0xf6, 0xbb, 0xcd, 0xf7, 0x75, 0xa4, 0xe6, 0xc7, 0xbc, 0xf4, 0x0d, 0xa5, 0xd6, 0xa5, 0xf9,
+    0x22, 0x59, 0x37, 0x70, 0xb8, 0x32, 0x03, 0x72, 0xf1, 0x4e, 0x98, 0x01, 0x62, 0xbb, 0x34, 0x5f,
+    0xd1, 0x36, 0x21, 0x6d, 0x53, 0x7f, 0x5d, 0x5a, 0x60, 0xf4, 0x67, 0x80, 0xeb, 0xb2, 0x1f, 0x9b,
+    0x42, 0xcd, 0x0b, 0x1a, 0xd3, 0xdc, 0x6a, 0x6b, 0x5f, 0xdb, 0x52, 0x14, 0x4d, 0xe0, 0xfd, 0x1d,
+    0x63, 0x67, 0xa8, 0x1f, 0xa2, 0xe6, 0x1e, 0x92, 0xef, 0x30, 0xc7, 0x46, 0x57, 0x45, 0x72, 0x84,
+    0x15, 0x4d, 0x16, 0xd1, 0xa0, 0xdf, 0xe3, 0x13, 0x03, 0x46, 0xc1, 0x0f, 0xfc, 0x24, 0xd8, 0xc4,
+    0x2e, 0x5d, 0xfe, 0x83, 0x5a, 0xd7, 0x40, 0xe9, 0xf5, 0xdd, 0xf7, 0xdd, 0x7a, 0x86, 0x59, 0x25,
+    0x57, 0xd4, 0xbc, 0xc5, 0x83, 0xa0, 0x65, 0xb9, 0xdd, 0x43, 0x38, 0x7f, 0x48, 0x53, 0x3c, 0x13,
+    0xab, 0x0e, 0xbd, 0xc3, 0x03, 0x6a, 0x0d, 0xf9, 0xc2, 0xb8, 0x5d, 0x6b, 0xfc, 0xaa, 0xc7, 0x7f,
+    0x86, 0xe2, 0x1c, 0x2d, 0x82, 0x0d, 0x6b, 0x45, 0xf7, 0x79, 0x78, 0xf6, 0x48, 0xfd, 0x0a, 0x36,
+    0xfd, 0xc9, 0xaa, 0xeb, 0x0d, 0x2d, 0xdc, 0x59, 0xdc, 0xf8, 0xbb, 0xd9, 0x9f, 0x1f, 0xde, 0xda,
+    0xaf, 0xd5, 0x4b, 0x16, 0x80, 0xf7, 0xc5, 0xca, 0x55, 0xc9, 0x8f, 0x55, 0xd0, 0x4c, 0x66, 0x99,
+    0x9e, 0xae, 0xa8, 0xfe, 0x97, 0x7f, 0x14, 0x94, 0x5f, 0x86, 0xcd, 0xb3, 0x75, 0x60, 0x77, 0x68,
+    0x08, 0x5a, 0x01, 0x7e, 0x69, 0xe9, 0xe0, 0xe1, 0x39, 0x3a, 0xb5, 0xc1, 0xaa, 0x70, 0xb4, 0x57,
+    0x3e, 0x90, 0xd5, 0x99, 0x4a, 0xe8, 0x97, 0x38, 0x8e, 0x57, 0xf4, 0xde, 0xa5, 0x0a, 0xec, 0xdf,
+    0x6f, 0xab, 0xb5, 0xe7, 0x9e, 0x45, 0x84, 0xcb, 0x84, 0x9f, 0x92, 0x50, 0xec, 0x0d, 0x2b, 0x1a,
+    0xaf, 0x99, 0x50, 0xee, 0x3f, 0xd0, 0x4a, 0x19, 0xdd, 0x82, 0xa6, 0xd3, 0x9d, 0x30, 0x7c, 0x99,
+    0x1b, 0xfd, 0x74, 0x75, 0x5e, 0x55, 0xad, 0x69, 0xe5, 0x5a, 0x37, 0xfa, 0x33, 0xda, 0x73, 0x24,
+    0x00, 0x7e, 0xcb, 0xde, 0x9d, 0x29, 0x93, 0x4f, 0x79, 0x36, 0x84, 0x5d, 0xeb, 0x2b, 0x3c, 0xc4,
+    0x4b, 0xfe, 0xdf, 0x34, 0x40, 0x41, 0xff, 0x7f, 0xa9, 0x3f, 0x00, 0x6e, 0x8a, 0x9c, 0x54, 0xa0,
+    0x1a, 0x00, 0x00,
+};
+
+// htmlUpdate: 581 -> 356 bytes
+const uint8_t htmlUpdateGz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x92, 0x3f, 0x6f, 0x83, 0x30,
+    0x10, 0xc5, 0xf7, 0x7c, 0x0a, 0x97, 0xa1, 0x5e, 0x4a, 0x50, 0x3b, 0xb6, 0xc0, 0xd2, 0x3f, 0xea,
+    0x96, 0x48, 0x4d, 0x87, 0x8e, 0x87, 0xb9, 0x94, 0x53, 0x6c, 0x83, 0xec, 0x23, 0x29, 0x8a, 0xf2,
+    0xdd, 0x6b, 0x30, 0xa8, 0x95, 0xaa, 0xb2, 0x20, 0x9f, 0xdf, 0xfd, 0xb8, 0xf7, 0x8e, 0x55, 0x7e,
+    0xf5, 0xb4, 0x79, 0xdc, 0x7d, 0x6c, 0x9f, 0x45, 0xc3, 0x46, 0x97, 0xab, 0x7c, 0x79, 0x21, 0xd4,
+    0xe5, 0x4a, 0x84, 0x27, 0x37, 0xc8, 0x20, 0x2c, 0x18, 0x2c, 0xe4, 0x91, 0xf0, 0xd4, 0xb5, 0x8e,
+    0xa5, 0x50, 0xad, 0x65, 0xb4, 0x5c, 0xc8, 0x13, 0xd5, 0xdc, 0x14, 0x35, 0x1e, 0x49, 0x61, 0x3a,
+    0x1d, 0x6e, 0x04, 0x59, 0x62, 0x02, 0x9d, 0x7a, 0x05, 0x1a, 0x8b, 0x5b, 0x39, 0x83, 0x98, 0x58,
+    0x63, 0xf9, 0x42, 0xce, 0x9c, 0xc0, 0xa1, 0x78, 0xef, 0x6a, 0x60, 0xcc, 0xb3, 0x58, 0x8e, 0x12,
+    0x4d, 0xf6, 0x20, 0x1c, 0xea, 0x22, 0xf1, 0x3c, 0x68, 0xf4, 0x0d, 0x22, 0x27, 0xa2, 0x71, 0xb8,
+    0x2f, 0x92, 0x6c, 0x2a, 0xad, 0x95, 0xf7, 0xc9, 0xac, 0x9e, 0x0a, 0x65, 0xd5, 0xd6, 0xc3, 0x99,
+    0xf1, 0x8b, 0x53, 0xd0, 0xf4, 0x69, 0xef, 0x55, 0x98, 0x0b, 0xdd, 0x45, 0xec, 0x5b, 0x67, 0xce,
+    0x35, 0xf9, 0x4e, 0xc3, 0x70, 0x4f, 0x36, 0xa0, 0x31, 0xad, 0x74, 0xab, 0x0e, 0x97, 0x3c, 0xa2,
+    0x82, 0xcd, 0x2c, 0xfa, 0xcc, 0x47, 0xc6, 0x0c, 0x85, 0xf8, 0x39, 0x99, 0x05, 0x93, 0x1a, 0xbc,
+    0x2f, 0x64, 0x05, 0xea, 0x90, 0x56, 0x6c, 0x65, 0x79, 0xad, 0xf9, 0x41, 0xbc, 0xb6, 0x26, 0x4c,
+    0x0d, 0xb3, 0xbc, 0xb9, 0xfb, 0xeb, 0x28, 0xd4, 0xe2, 0xe5, 0x38, 0x82, 0x08, 0xf9, 0x35, 0x6d,
+    0x5d, 0xc8, 0xed, 0xe6, 0x6d, 0x27, 0x05, 0x28, 0xa6, 0xd6, 0x06, 0x7c, 0x3f, 0x89, 0xa5, 0x40,
+    0xab, 0x78, 0xe8, 0x42, 0xb8, 0xa6, 0xd7, 0x4c, 0x1d, 0x38, 0xce, 0xc6, 0xb6, 0x34, 0xdc, 0xc2,
+    0x9c, 0xdc, 0xc4, 0x22, 0xdb, 0xf5, 0x2c, 0xa2, 0x74, 0x4f, 0x3a, 0x74, 0xc6, 0x9d, 0x2c, 0x1c,
+    0x50, 0x0a, 0xbb, 0xb0, 0x90, 0x75, 0x45, 0xf6, 0x77, 0x5f, 0xe5, 0xfe, 0x81, 0xf8, 0xbe, 0x32,
+    0x14, 0x56, 0x79, 0x04, 0xdd, 0x87, 0x63, 0x1c, 0x5e, 0x2c, 0x66, 0x7e, 0xdc, 0xf3, 0x82, 0xcb,
+    0xa7, 0xc1, 0xc6, 0xd4, 0x62, 0x5c, 0xc1, 0xe8, 0xf4, 0xb3, 0x7c, 0x03, 0xc1, 0xf1, 0xfd, 0x9f,
+    0x45, 0x02, 0x00, 0x00,
+};
+
+// htmlMaintenance: 2245 -> 847 bytes
+const uint8_t htmlMaintenanceGz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x56, 0xdb, 0x6e, 0xdb, 0x38,
+    0x10, 0x7d, 0xf7, 0x57, 0xcc, 0xaa, 0x40, 0x65, 0x21, 0xb6, 0xac, 0xd4, 0x08, 0xb6, 0xb0, 0x25,
+    0x01, 0xbd, 0x24, 0xd8, 0x3c, 0x04, 0x5b, 0xb4, 0xce, 0x43, 0xbb, 0x28, 0x02, 0x9a, 0x1a, 0xd9,
+    0xdc, 0x50, 0xa2, 0x41, 0x51, 0xbe, 0x20, 0xc8, 0xbf, 0xef, 0x50, 0xb2, 0x1d, 0xc9, 0xb5, 0xb3,
+    0x49, 0xf9, 0x22, 0x92, 0xc3, 0x39, 0x73, 0x86, 0x33, 0x87, 0x50, 0x27, 0xfc, 0xe3, 0xf3, 0xdf,
+    0x9f, 0x26, 0xdf, 0xbf, 0x5c, 0xc2, 0xdc, 0x64, 0x32, 0xee, 0x84, 0xbb, 0x0f, 0xb2, 0x24, 0xee,
+    0x00, 0x8d, 0x30, 0x43, 0xc3, 0x80, 0xcf, 0x99, 0x2e, 0xd0, 0x44, 0xce, 0xed, 0xe4, 0xaa, 0xff,
+    0xde, 0x69, 0x9a, 0x72, 0x96, 0x61, 0xe4, 0x2e, 0x05, 0xae, 0x16, 0x4a, 0x1b, 0x17, 0xb8, 0xca,
+    0x0d, 0xe6, 0x26, 0x72, 0x57, 0x22, 0x31, 0xf3, 0x28, 0xc1, 0xa5, 0xe0, 0xd8, 0xaf, 0x16, 0x3d,
+    0x10, 0xb9, 0x30, 0x82, 0xc9, 0x7e, 0xc1, 0x99, 0xc4, 0xe8, 0xdc, 0xdd, 0x02, 0x19, 0x61, 0x24,
+    0xc6, 0x37, 0x4c, 0x58, 0x57, 0x96, 0x73, 0x0c, 0x07, 0xf5, 0x56, 0x6d, 0x96, 0x22, 0xbf, 0x07,
+    0x8d, 0x32, 0x72, 0x0a, 0xb3, 0x91, 0x58, 0xcc, 0x11, 0x8d, 0x03, 0x73, 0x8d, 0x69, 0xe4, 0x0c,
+    0xaa, 0x2d, 0x9f, 0x17, 0xc5, 0x8e, 0x55, 0xc1, 0xb5, 0x58, 0x98, 0x7a, 0x61, 0x87, 0x44, 0x03,
+    0x5c, 0x0a, 0x7e, 0x5f, 0x40, 0x04, 0x0f, 0x1a, 0x0b, 0xc3, 0xb4, 0x19, 0x41, 0xd0, 0x23, 0x48,
+    0xca, 0x89, 0x66, 0x8f, 0xe3, 0xfd, 0xe1, 0xb4, 0xcc, 0xb9, 0x11, 0x2a, 0xb7, 0x69, 0xa4, 0x42,
+    0x67, 0x1f, 0xaa, 0x55, 0xd7, 0x6c, 0x16, 0xd8, 0x83, 0x52, 0xcb, 0x1e, 0x4c, 0x4d, 0x7e, 0x9d,
+    0xf4, 0x20, 0xc1, 0x94, 0x95, 0xd2, 0x4c, 0x70, 0x6d, 0x3c, 0x78, 0xd8, 0xfb, 0xdb, 0x51, 0x07,
+    0xfb, 0xc7, 0xfa, 0xfc, 0x3c, 0x3b, 0x1b, 0xb7, 0x6c, 0x96, 0x0c, 0x21, 0x10, 0x93, 0x44, 0xf1,
+    0x32, 0xa3, 0x8b, 0xf2, 0x67, 0x68, 0x2e, 0x25, 0xda, 0xe9, 0xc7, 0xcd, 0x75, 0xd2, 0xad, 0xf0,
+    0xbd, 0xb6, 0x97, 0x48, 0xa1, 0xdb, 0x44, 0x85, 0x38, 0x82, 0xe1, 0x61, 0x58, 0x3b, 0xc8, 0xd9,
+    0x17, 0x79, 0x8e, 0xda, 0xf2, 0xa2, 0x20, 0xce, 0xe5, 0x1a, 0x79, 0x69, 0x44, 0x3e, 0xf3, 0x7d,
+    0xdf, 0x19, 0xff, 0x72, 0x7e, 0x25, 0xf2, 0x44, 0xad, 0x7c, 0xa9, 0x38, 0xb3, 0x79, 0xfa, 0xf6,
+    0x4e, 0xc9, 0x8d, 0x12, 0x6d, 0x9f, 0x7d, 0x04, 0x94, 0x05, 0xbe, 0x20, 0x60, 0xe3, 0x5a, 0xe0,
+    0x0c, 0x1c, 0xe8, 0x3a, 0xf4, 0x69, 0x51, 0xa7, 0xdd, 0xc1, 0xd0, 0x3b, 0xc2, 0x45, 0xa4, 0x36,
+    0x77, 0xdf, 0x88, 0x0c, 0x55, 0x49, 0x97, 0xca, 0x25, 0x32, 0x3d, 0xa9, 0x57, 0x2d, 0xcb, 0xf8,
+    0x28, 0x8b, 0xad, 0x95, 0x38, 0x50, 0x51, 0x77, 0x6e, 0x5d, 0x0f, 0xa2, 0x18, 0x1e, 0xe0, 0x17,
+    0x8f, 0xc3, 0x3a, 0x91, 0x5b, 0x30, 0x3e, 0x7e, 0xec, 0x99, 0x14, 0x8f, 0x78, 0x3c, 0xf6, 0xe0,
+    0x5d, 0x10, 0x04, 0x07, 0x24, 0x1f, 0x3b, 0xed, 0x59, 0x38, 0xd8, 0x75, 0x69, 0x38, 0xa8, 0xb5,
+    0x16, 0x4e, 0x55, 0xb2, 0xd9, 0x76, 0x30, 0xab, 0x7b, 0xdb, 0x1d, 0x90, 0x9a, 0x24, 0x2b, 0x8a,
+    0xc8, 0x9d, 0x32, 0x7e, 0xdf, 0x27, 0x22, 0x6e, 0xfc, 0x56, 0x52, 0xd4, 0xbf, 0x54, 0x46, 0x12,
+    0x61, 0xdb, 0xe3, 0xf3, 0x77, 0x6d, 0xe9, 0xd0, 0xba, 0x32, 0xd4, 0xd6, 0x44, 0x2c, 0x77, 0x28,
+    0x9c, 0xe9, 0xc4, 0x7d, 0x12, 0x46, 0x38, 0x1f, 0xc6, 0xdf, 0x36, 0x85, 0xc1, 0x0c, 0x26, 0x4a,
+    0xc9, 0x82, 0x3c, 0x87, 0x0d, 0xeb, 0x9e, 0x85, 0x21, 0xc9, 0xdc, 0x2d, 0xca, 0x6c, 0xf1, 0x44,
+    0x87, 0x98, 0x40, 0x25, 0xbc, 0x9a, 0xda, 0x4c, 0xab, 0x32, 0x4f, 0x46, 0x6f, 0x2e, 0x2e, 0x2e,
+    0xc6, 0x90, 0x31, 0x3d, 0x13, 0x79, 0x7f, 0xaa, 0x8c, 0x51, 0xd9, 0xe8, 0x3c, 0x58, 0xac, 0xdd,
+    0x78, 0x42, 0x10, 0xf0, 0x85, 0x20, 0xa0, 0x7b, 0x4e, 0x5f, 0xea, 0x25, 0x6f, 0xcf, 0xbf, 0x1d,
+    0x4c, 0x64, 0x65, 0x33, 0x8c, 0xbd, 0xfd, 0x7e, 0x81, 0x7c, 0x1f, 0xee, 0x18, 0xfa, 0xf5, 0xcd,
+    0x2d, 0x7c, 0xb2, 0x7a, 0x9d, 0x95, 0xba, 0xea, 0xe3, 0x13, 0xd8, 0xa4, 0xe9, 0x42, 0x49, 0x7c,
+    0x35, 0xfe, 0x37, 0xd4, 0xf4, 0x68, 0xd9, 0x10, 0xd6, 0xfd, 0x04, 0xb8, 0xbd, 0xa0, 0x3b, 0x7a,
+    0x5b, 0x4c, 0xf1, 0x6a, 0xfc, 0xea, 0x62, 0xa8, 0x65, 0x49, 0xa6, 0x4f, 0x55, 0x1d, 0x50, 0xe1,
+    0xe2, 0xce, 0x4b, 0x6a, 0xf8, 0x99, 0xe5, 0x33, 0xd4, 0xf0, 0x43, 0xe5, 0xd8, 0x2e, 0x61, 0x93,
+    0xa5, 0x48, 0x2a, 0x3e, 0xfd, 0xea, 0xcd, 0x73, 0xb7, 0xa4, 0xff, 0x65, 0x4b, 0x56, 0x37, 0xe2,
+    0x68, 0xa9, 0x44, 0xd2, 0x0d, 0xbc, 0x67, 0xb9, 0x37, 0x4b, 0xfd, 0x3e, 0x20, 0xbd, 0x70, 0x25,
+    0x95, 0x1e, 0xbd, 0x49, 0xd3, 0xf4, 0x68, 0xd9, 0x41, 0xe5, 0x95, 0xc6, 0x22, 0xa7, 0xfd, 0x9a,
+    0xba, 0x35, 0x89, 0x1e, 0xb8, 0x83, 0x94, 0x71, 0xa3, 0xf4, 0xe6, 0x6e, 0xbf, 0xf3, 0xc4, 0x91,
+    0x16, 0x57, 0xb5, 0x15, 0xbe, 0xda, 0x0d, 0xe8, 0x0e, 0xd7, 0xb5, 0x66, 0x3d, 0xd7, 0x73, 0xe2,
+    0x53, 0xb6, 0xc3, 0xf2, 0x34, 0x12, 0xb7, 0x0f, 0xff, 0xcb, 0x52, 0x7f, 0x55, 0x77, 0x3f, 0x97,
+    0x66, 0x15, 0xd2, 0x26, 0xda, 0x98, 0x37, 0xd9, 0xd0, 0xf2, 0x6b, 0x3d, 0x85, 0xad, 0x14, 0xdb,
+    0x59, 0x9e, 0x34, 0x9e, 0xe8, 0xc2, 0x72, 0x91, 0x30, 0x83, 0xbf, 0x2f, 0xd4, 0x2b, 0xa2, 0xbf,
+    0x62, 0x1a, 0xe1, 0xb6, 0x02, 0x3a, 0x11, 0x65, 0x2a, 0x11, 0x13, 0xea, 0xd6, 0xff, 0x8d, 0x93,
+    0xa6, 0xfc, 0x3c, 0xf8, 0x73, 0xdf, 0x28, 0x81, 0x6d, 0x9a, 0xa3, 0x0a, 0xab, 0x92, 0xfc, 0xb8,
+    0x85, 0x85, 0x1b, 0x95, 0x60, 0x95, 0x6b, 0xc6, 0xd6, 0xde, 0xa1, 0x24, 0xc2, 0x41, 0xfd, 0x54,
+    0x52, 0xaf, 0x57, 0x3f, 0x2b, 0xff, 0x01, 0x26, 0xbd, 0x70, 0x79, 0xc5, 0x08, 0x00, 0x00,
+};
+
+// htmlConsole: 1465 -> 627 bytes
+const uint8_t htmlConsoleGz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x54, 0x4d, 0x6f, 0xdb, 0x30,
+    0x0c, 0xbd, 0xf7, 0x57, 0x68, 0x19, 0x30, 0x39, 0x58, 0x6d, 0xb7, 0x3d, 0x15, 0x89, 0xed, 0x43,
+    0x3f, 0x86, 0x16, 0x28, 0xd0, 0x02, 0xc9, 0x0e, 0x3b, 0x2a, 0x32, 0x13, 0x0b, 0x95, 0x25, 0x43,
+    0x62, 0x92, 0x66, 0x45, 0xff, 0x7b, 0xe9, 0x8f, 0x34, 0xee, 0x92, 0x60, 0xd8, 0x61, 0xba, 0xd8,
+    0xe2, 0x7b, 0x22, 0xa9, 0x27, 0x92, 0x27, 0xc9, 0x97, 0x9b, 0xc7, 0xeb, 0xe9, 0xaf, 0xa7, 0x5b,
+    0x56, 0x60, 0xa9, 0xb3, 0x93, 0x64, 0xfb, 0x01, 0x91, 0x67, 0x27, 0x8c, 0x56, 0x52, 0x02, 0x0a,
+    0x26, 0x0b, 0xe1, 0x3c, 0x60, 0x3a, 0xf8, 0x39, 0xfd, 0x11, 0x5e, 0x0e, 0xfa, 0x90, 0x11, 0x25,
+    0xa4, 0x7c, 0xa5, 0x60, 0x5d, 0x59, 0x87, 0x9c, 0x49, 0x6b, 0x10, 0x0c, 0xa6, 0x7c, 0xad, 0x72,
+    0x2c, 0xd2, 0x1c, 0x56, 0x4a, 0x42, 0xd8, 0x6c, 0x4e, 0x99, 0x32, 0x0a, 0x95, 0xd0, 0xa1, 0x97,
+    0x42, 0x43, 0x7a, 0xce, 0x3b, 0x47, 0xa8, 0x50, 0x43, 0x36, 0x01, 0x47, 0x18, 0xbb, 0xb6, 0xc6,
+    0x5b, 0x0d, 0x49, 0xdc, 0x5a, 0x5b, 0x86, 0x56, 0xe6, 0x99, 0x39, 0xd0, 0xe9, 0xc0, 0xe3, 0x46,
+    0x83, 0x2f, 0x00, 0x70, 0xc0, 0x0a, 0x07, 0xf3, 0x74, 0x10, 0x37, 0xa6, 0x48, 0x7a, 0xbf, 0x4d,
+    0xcc, 0x4b, 0xa7, 0x2a, 0x6c, 0x37, 0xf5, 0x9a, 0x2f, 0x8d, 0x44, 0x65, 0x0d, 0x9b, 0x03, 0xca,
+    0xe2, 0xc1, 0x2e, 0x7c, 0x30, 0x64, 0xaf, 0x1f, 0x70, 0x43, 0xa9, 0x91, 0x80, 0xc7, 0xb2, 0x8d,
+    0x1e, 0xe7, 0x02, 0x05, 0x1f, 0x7e, 0xa2, 0xd4, 0x2b, 0xc2, 0x02, 0x4c, 0xe0, 0xc0, 0x57, 0xc4,
+    0x03, 0x96, 0x66, 0x6c, 0xfb, 0x1f, 0x21, 0xbc, 0x60, 0x30, 0x3c, 0x76, 0xa4, 0xf6, 0x57, 0xd3,
+    0x5f, 0xf7, 0xf0, 0x7a, 0xad, 0x84, 0x63, 0x5d, 0xe4, 0x1b, 0xb5, 0x62, 0x29, 0xcb, 0xad, 0x5c,
+    0x96, 0x24, 0x63, 0xb4, 0x00, 0xbc, 0xd5, 0x50, 0xff, 0x5e, 0x6d, 0xee, 0xf3, 0x80, 0x77, 0x2c,
+    0x3e, 0x1c, 0x1f, 0x75, 0xa4, 0xfc, 0x44, 0x3a, 0xab, 0x35, 0xe4, 0x53, 0x7b, 0x65, 0x11, 0x6d,
+    0x49, 0x0e, 0x77, 0xde, 0x23, 0xdf, 0xa0, 0x77, 0xa0, 0x16, 0x05, 0xb2, 0xb0, 0x8f, 0x48, 0xad,
+    0x28, 0x50, 0x87, 0x24, 0x07, 0x0e, 0x4d, 0x6d, 0xc5, 0xbe, 0xb3, 0xf3, 0xc3, 0xb1, 0x0f, 0x1a,
+    0x7b, 0x2e, 0x94, 0x31, 0xe0, 0xa6, 0xa4, 0x52, 0x7d, 0x3f, 0x92, 0xe3, 0x1f, 0xbc, 0xa8, 0x79,
+    0xb0, 0x7f, 0xab, 0xe1, 0x61, 0x2d, 0xff, 0x88, 0xba, 0x4b, 0xfc, 0xa8, 0x08, 0x87, 0x13, 0x79,
+    0xdb, 0xb3, 0xbe, 0xf5, 0x44, 0xdf, 0xa1, 0xd4, 0x17, 0xf7, 0x54, 0xf2, 0x6e, 0x25, 0x74, 0xf0,
+    0x51, 0x5f, 0xa7, 0xec, 0xe2, 0xec, 0xac, 0x47, 0x5f, 0x2b, 0x93, 0xdb, 0x75, 0x64, 0x8d, 0xb6,
+    0x22, 0xa7, 0x4c, 0xb6, 0x15, 0xf9, 0xd7, 0x3a, 0x9c, 0x59, 0x8b, 0xff, 0xa5, 0x0e, 0x8f, 0x97,
+    0x58, 0x1b, 0x72, 0xff, 0xb9, 0x3e, 0xdf, 0xbf, 0xfd, 0x4d, 0xe2, 0x6d, 0xaf, 0x25, 0x71, 0x3b,
+    0x34, 0x92, 0x99, 0xcd, 0x37, 0x5d, 0x1f, 0x8a, 0xb6, 0x43, 0x79, 0x4c, 0x63, 0x41, 0x0b, 0xef,
+    0x53, 0x3e, 0x13, 0xf2, 0x39, 0x9c, 0xa1, 0xe1, 0xd9, 0x37, 0x8d, 0x63, 0x76, 0x67, 0x4b, 0x6a,
+    0x74, 0xd1, 0xd1, 0x8b, 0x8b, 0xbd, 0x19, 0x40, 0xa6, 0x16, 0xcb, 0xa9, 0x2d, 0x9a, 0x3e, 0x4f,
+    0xf9, 0x9c, 0x26, 0x4c, 0xe8, 0xd5, 0x6f, 0x18, 0x9d, 0x45, 0x97, 0x50, 0x8e, 0xa5, 0xd5, 0xd6,
+    0x8d, 0xbe, 0x0a, 0x21, 0xc6, 0xa5, 0x70, 0x0b, 0x65, 0xc2, 0x59, 0x53, 0x1f, 0xa3, 0xcb, 0xea,
+    0x85, 0x67, 0x57, 0x74, 0x9b, 0x11, 0x8d, 0x84, 0x4a, 0x18, 0xa6, 0xf2, 0xb4, 0xbd, 0x5d, 0x16,
+    0x52, 0xe2, 0x64, 0xc9, 0x92, 0x98, 0x1c, 0xf7, 0x42, 0xd4, 0x8c, 0x6d, 0x8b, 0x65, 0x0f, 0xf4,
+    0x56, 0xca, 0x2c, 0xa2, 0x28, 0xea, 0xd3, 0xe6, 0xd6, 0x95, 0x4c, 0x34, 0xaf, 0x97, 0xee, 0xde,
+    0x49, 0x6a, 0x10, 0x8e, 0x33, 0x1a, 0x89, 0x85, 0x25, 0x1f, 0x4f, 0x8f, 0x93, 0x29, 0xdf, 0x0d,
+    0xa0, 0x44, 0x99, 0x6a, 0x89, 0x0c, 0x37, 0x15, 0xe5, 0xef, 0x97, 0xb3, 0x52, 0xd1, 0xa4, 0xa4,
+    0x82, 0x59, 0xd2, 0xf6, 0xba, 0x3e, 0xc9, 0xa8, 0x68, 0x76, 0x22, 0xd5, 0xfa, 0x74, 0xf2, 0xd6,
+    0xd1, 0x6a, 0x71, 0x5b, 0x55, 0x49, 0x90, 0x66, 0x40, 0xbf, 0x03, 0xf5, 0x21, 0x74, 0x63, 0xb9,
+    0x05, 0x00, 0x00,
+};
+
+#endif
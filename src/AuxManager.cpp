@@ -4,7 +4,26 @@
 #define AUX_PWM_FREQ 1000 // 1 kHz for grips/relays
 #define AUX_PWM_RES 8     // 8-bit (0-255)
 
-AuxManager::AuxManager() {
+static const uint16_t AUX_CONFIG_VERSION = 1;
+
+const ConfigField AuxManager::CONFIG_FIELDS[] = {
+    CONFIG_FIELD(AuxManager::ConfigData, mode, "mode", T_I32, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, baseLevel, "base", T_I32, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, speedFactor, "speedF", T_BLOB, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, tempFactor, "tempF", T_BLOB, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, tempOffset, "tempO", T_BLOB, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, startTemp, "startT", T_BLOB, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, rainBoost, "rainB", T_I32, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, startupBoostLevel, "startL", T_I32, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, startupBoostSec, "startS", T_I32, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, startDelaySec, "startD", T_I32, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, reactionSpeed, "react", T_I32, 1),
+    CONFIG_FIELD(AuxManager::ConfigData, manualOverride, "man_ovr", T_U8, 1),
+};
+const int AuxManager::CONFIG_FIELD_COUNT = sizeof(AuxManager::CONFIG_FIELDS) / sizeof(AuxManager::CONFIG_FIELDS[0]);
+
+AuxManager::AuxManager() : _config(AUX_CONFIG_VERSION, CONFIG_FIELDS, CONFIG_FIELD_COUNT) {
+    _prefs.begin("aux");
 }
 
 void AuxManager::begin(ImuHandler* imu) {
@@ -20,30 +39,31 @@ void AuxManager::begin(ImuHandler* imu) {
     ledcAttachPin(AUX_PIN, AUX_PWM_CHANNEL);
     ledcWrite(AUX_PWM_CHANNEL, 0);
     
-    // Load Preferences
-    _prefs.begin("aux", false);
-    _mode = (AuxMode)_prefs.getInt("mode", AUX_MODE_OFF);
-    
-    _baseLevel = _prefs.getInt("base", 25);
-    _speedFactor = _prefs.getFloat("speedF", 0.5);
-    _tempFactor = _prefs.getFloat("tempF", 2.0);
-    _tempOffset = _prefs.getFloat("tempO", 0.0);
-    _startTemp = _prefs.getFloat("startT", 20.0);
-    _rainBoost = _prefs.getInt("rainB", 10);
-    _startupBoostLevel = _prefs.getInt("startL", 100);
-    _startupBoostSec = _prefs.getInt("startS", 75);
-    _startDelaySec = _prefs.getInt("startD", 15);
-    _reactionSpeed = (ReactionSpeed)_prefs.getInt("react", REACTION_SLOW);
+    // Load Preferences (one record, the member defaults fill the gaps)
+    fillConfig();
+    ConfigLoadResult result = _config.load(_prefs);
+    const ConfigData& cfg = _config.data();
+    _mode = (AuxMode)cfg.mode;
+    
+    _baseLevel = cfg.baseLevel;
+    _speedFactor = cfg.speedFactor;
+    _tempFactor = cfg.tempFactor;
+    _tempOffset = cfg.tempOffset;
+    _startTemp = cfg.startTemp;
+    _rainBoost = cfg.rainBoost;
+    _startupBoostLevel = cfg.startupBoostLevel;
+    _startupBoostSec = cfg.startupBoostSec;
+    _startDelaySec = cfg.startDelaySec;
+    _reactionSpeed = (ReactionSpeed)cfg.reactionSpeed;
     
     // Load saved state for manual override (persistence)
-    _manualOverride = _prefs.getBool("man_ovr", true);
+    _manualOverride = cfg.manualOverride != 0;
+    if (result != CONFIG_LOADED) _config.save(_prefs);
     
     // If enabled at boot, calculate boost end time
     if (_manualOverride) {
         calcBoostEndTime();
     }
-
-    _prefs.end();
 }
 
 void AuxManager::loop(float currentSpeedKmh, float currentTempC, bool isRainMode) {
@@ -67,9 +87,7 @@ void AuxManager::toggleManualOverride() {
         calcBoostEndTime();
     }
 
-    _prefs.begin("aux", false);
-    _prefs.putBool("man_ovr", _manualOverride);
-    _prefs.end();
+    saveConfig();
 }
 
 void AuxManager::handleAuxPower() {
@@ -155,9 +173,7 @@ void AuxManager::setPwm(int percent) {
 
 void AuxManager::setMode(AuxMode mode) {
     _mode = mode;
-    _prefs.begin("aux", false);
-    _prefs.putInt("mode", (int)_mode);
-    _prefs.end();
+    saveConfig();
 }
 
 void AuxManager::setGripSettings(int baseLevel, float speedFactor, float tempFactor, float tempOffset, float startTemp, int rainBoost, int startupBoostLevel, int startupBoostSec, int startDelaySec, int reactionSpeed) {
@@ -172,18 +188,28 @@ void AuxManager::setGripSettings(int baseLevel, float speedFactor, float tempFac
     _startDelaySec = startDelaySec;
     _reactionSpeed = (ReactionSpeed)reactionSpeed;
     
-    _prefs.begin("aux", false);
-    _prefs.putInt("base", _baseLevel);
-    _prefs.putFloat("speedF", _speedFactor);
-    _prefs.putFloat("tempF", _tempFactor);
-    _prefs.putFloat("tempO", _tempOffset);
-    _prefs.putFloat("startT", _startTemp);
-    _prefs.putInt("rainB", _rainBoost);
-    _prefs.putInt("startL", _startupBoostLevel);
-    _prefs.putInt("startS", _startupBoostSec);
-    _prefs.putInt("startD", _startDelaySec);
-    _prefs.putInt("react", (int)_reactionSpeed);
-    _prefs.end();
+    saveConfig();
+}
+
+void AuxManager::fillConfig() {
+    ConfigData& cfg = _config.data();
+    cfg.mode = (int32_t)_mode;
+    cfg.baseLevel = _baseLevel;
+    cfg.speedFactor = _speedFactor;
+    cfg.tempFactor = _tempFactor;
+    cfg.tempOffset = _tempOffset;
+    cfg.startTemp = _startTemp;
+    cfg.rainBoost = _rainBoost;
+    cfg.startupBoostLevel = _startupBoostLevel;
+    cfg.startupBoostSec = _startupBoostSec;
+    cfg.startDelaySec = _startDelaySec;
+    cfg.reactionSpeed = (int32_t)_reactionSpeed;
+    cfg.manualOverride = _manualOverride;
+}
+
+void AuxManager::saveConfig() {
+    fillConfig();
+    _config.save(_prefs);
 }
 
 void AuxManager::getGripSettings(int &baseLevel, float &speedFactor, float &tempFactor, float &tempOffset, float &startTemp, int &rainBoost, int &startupBoostLevel, int &startupBoostSec, int &startDelaySec, int &reactionSpeed) {
@@ -0,0 +1,69 @@
+#include "BootTimeline.h"
+
+BootTimeline bootTimeline;
+
+BootTimeline::BootTimeline() {
+    _count = 0;
+    _lastMarkUs = 0;
+    _setupDoneUs = 0;
+    _firstFixMs = 0;
+    _firstUpdateMs = 0;
+}
+
+void BootTimeline::mark(const char* phase) {
+    uint32_t now = micros();
+    addPhase(phase, _lastMarkUs, now, false);
+    _lastMarkUs = now;
+}
+
+void BootTimeline::addBackground(const char* phase, uint32_t startUs, uint32_t endUs) {
+    addPhase(phase, startUs, endUs, true);
+}
+
+void BootTimeline::addPhase(const char* phase, uint32_t startUs, uint32_t endUs, bool background) {
+    if (_count >= BOOT_TIMELINE_MAX_PHASES) return;
+    Phase& p = _phases[_count++];
+    p.name = phase;
+    p.startUs = startUs;
+    p.endUs = endUs;
+    p.background = background;
+}
+
+void BootTimeline::setupDone() {
+    _setupDoneUs = micros();
+}
+
+void BootTimeline::fixApplied(unsigned long rxMs) {
+    if (_firstUpdateMs != 0) return;
+    unsigned long now = millis();
+    _firstFixMs = rxMs ? rxMs : 1; // 0 = none
+    _firstUpdateMs = now ? now : 1;
+}
+
+String BootTimeline::format() const {
+    String out;
+    char buf[40];
+    for (int i = 0; i < _count; i++) {
+        if (_phases[i].background) continue;
+        snprintf(buf, sizeof(buf), "%s%s=%.1fms", i ? " " : "", _phases[i].name, getPhaseUs(i) / 1000.0);
+        out += buf;
+    }
+    if (_setupDoneUs) {
+        snprintf(buf, sizeof(buf), " setup=%.1fms", _setupDoneUs / 1000.0);
+        out += buf;
+    }
+    for (int i = 0; i < _count; i++) {
+        if (!_phases[i].background) continue;
+        snprintf(buf, sizeof(buf), " %s=bg:%.1fms", _phases[i].name, getPhaseUs(i) / 1000.0);
+        out += buf;
+    }
+    if (_firstFixMs) {
+        snprintf(buf, sizeof(buf), " fix=%.1fs", _firstFixMs / 1000.0);
+        out += buf;
+    }
+    if (_firstUpdateMs) {
+        snprintf(buf, sizeof(buf), " update=%.1fs", _firstUpdateMs / 1000.0);
+        out += buf;
+    }
+    return out;
+}
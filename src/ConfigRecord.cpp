@@ -0,0 +1,46 @@
+#include "ConfigRecord.h"
+#include "Crc32.h"
+#include <string.h>
+
+ConfigLoadResult ConfigRecordBase::load(PersistStore& store, uint16_t version, const ConfigField* fields, int fieldCount,
+                                        uint8_t* blob, uint8_t* scratch, size_t size) {
+    uint8_t* data = blob + sizeof(ConfigHeader);
+
+    // A record from a newer firmware (larger) is not ours to read
+    size_t len = store.getBytesLength(CONFIG_RECORD_KEY);
+    if (len >= sizeof(ConfigHeader) && len <= sizeof(ConfigHeader) + size &&
+        store.getBytes(CONFIG_RECORD_KEY, scratch, len) == len) {
+        ConfigHeader header;
+        memcpy(&header, scratch, sizeof(header));
+        const uint8_t* payload = scratch + sizeof(ConfigHeader);
+        if (header.version >= 1 && header.version <= version && header.size == len - sizeof(ConfigHeader) &&
+            header.crc == crc32(payload, header.size)) {
+            // Take the fields this version already had, the rest keep their defaults
+            for (int i = 0; i < fieldCount; i++) {
+                const ConfigField& f = fields[i];
+                if (f.since > header.version || f.offset + f.size > header.size) continue;
+                memcpy(data + f.offset, payload + f.offset, f.size);
+            }
+            return header.version == version ? CONFIG_LOADED : CONFIG_UPGRADED;
+        }
+        Serial.printf("[CONFIG] Record %s invalid (v%u, %u bytes), using single keys\n",
+                      CONFIG_RECORD_KEY, header.version, (unsigned)len);
+    }
+
+    // No record yet: pick up the settings of older firmware once
+    bool found = false;
+    for (int i = 0; i < fieldCount; i++) {
+        const ConfigField& f = fields[i];
+        if (f.legacyKey == NULL) continue;
+        if (store.getValue(f.legacyKey, f.type, data + f.offset, f.size)) found = true;
+    }
+    return found ? CONFIG_MIGRATED : CONFIG_DEFAULTS;
+}
+
+void ConfigRecordBase::seal(uint8_t* blob, uint16_t version, size_t size) {
+    ConfigHeader header;
+    header.version = version;
+    header.size = size;
+    header.crc = crc32(blob + sizeof(ConfigHeader), size);
+    memcpy(blob, &header, sizeof(header));
+}
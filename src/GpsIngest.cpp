@@ -0,0 +1,122 @@
+#include "GpsIngest.h"
+#include "BootTimeline.h"
+#include <string.h>
+
+GpsIngest::GpsIngest() {
+    _sentenceDone = false;
+    _published = 0;
+    _dropped = 0;
+    _rxErrors = 0;
+
+    memset(&_lastFix, 0, sizeof(_lastFix));
+    _speedKmh = 0.0;
+    _signalPoor = false;
+    _lastOilerUpdate = 0;
+    _updateCount = 0;
+    _freshCount = 0;
+    resetLatencyStats();
+}
+
+void GpsIngest::encode(char c) {
+    if (_gps.encode(c)) _sentenceDone = true;
+}
+
+bool GpsIngest::publish(uint32_t rxMicros) {
+    if (!_sentenceDone) return false;
+    _sentenceDone = false;
+
+    GpsFix fix;
+    fix.rxMicros = rxMicros;
+    // Check the flags before reading the values (reading clears them)
+    fix.fresh = _gps.location.isUpdated() || _gps.speed.isUpdated();
+    fix.locationValid = _gps.location.isValid();
+    fix.lat = _gps.location.lat();
+    fix.lng = _gps.location.lng();
+    fix.speedValid = _gps.speed.isValid();
+    fix.speedKmh = _gps.speed.kmph();
+    fix.sats = _gps.satellites.value();
+    fix.hdop = _gps.hdop.hdop();
+    fix.timeValid = _gps.time.isValid();
+    fix.dateValid = _gps.date.isValid();
+    fix.hour = _gps.time.hour();
+    fix.minute = _gps.time.minute();
+    fix.day = _gps.date.day();
+    fix.month = _gps.date.month();
+    fix.year = _gps.date.year();
+    fix.sentencesOk = _gps.passedChecksum();
+    fix.sentencesFailed = _gps.failedChecksum();
+
+    if (!_queue.push(fix)) {
+        _dropped++;
+        return false;
+    }
+    _published++;
+    return true;
+}
+
+void GpsIngest::applyFix(const GpsFix& fix) {
+    _lastFix = fix;
+
+    float currentSpeed = fix.speedValid ? fix.speedKmh : 0.0;
+
+    // GPS Filter: Ignore data if signal is poor (Multipath/Indoor protection)
+    // 1. Minimum GPS_MIN_SATS Satellites (Outdoors usually > 8)
+    // 2. HDOP must be good (< GPS_MAX_HDOP).
+    bool signalPoor = false;
+    if (fix.locationValid) {
+        if (fix.sats < GPS_MIN_SATS || fix.hdop > GPS_MAX_HDOP) {
+            signalPoor = true;
+            currentSpeed = 0.0; // Force 0 speed
+        }
+    }
+    _speedKmh = currentSpeed;
+    _signalPoor = signalPoor;
+}
+
+bool GpsIngest::process(Oiler& oiler) {
+    bool updated = false;
+    GpsFix fix;
+
+    while (_queue.pop(fix)) {
+        applyFix(fix);
+
+        // Pass current time to Oiler (for Night Mode)
+        if (fix.timeValid && fix.dateValid) {
+            int h = oiler.calculateLocalHour(fix.hour, fix.day, fix.month, fix.year);
+            oiler.setCurrentHour(h);
+        }
+
+        if (fix.fresh) {
+            // Treat poor signal as invalid to ensure we don't get stuck in "0 km/h" state while driving
+            bool valid = !_signalPoor;
+            oiler.update(_speedKmh, fix.lat, fix.lng, valid);
+            _lastOilerUpdate = millis();
+            _updateCount++;
+            if (valid) _freshCount++;
+            updated = true;
+
+            uint32_t latency = micros() - fix.rxMicros;
+            if (valid) bootTimeline.fixApplied(millis() - latency / 1000);
+            _latencySumUs += latency;
+            _latencyCount++;
+            if (latency > _latencyMaxUs) _latencyMaxUs = latency;
+        }
+    }
+
+    // Ensure update is called at least every GPS_UPDATE_TIMEOUT_MS to handle Emergency Mode (Forced or Auto)
+    // Called due to timeout, we pass false as validity
+    // This allows the Oiler to detect signal loss and trigger Auto-Emergency Mode
+    if (!updated && (millis() - _lastOilerUpdate > GPS_UPDATE_TIMEOUT_MS)) {
+        oiler.update(_speedKmh, _lastFix.lat, _lastFix.lng, false);
+        _lastOilerUpdate = millis();
+        _updateCount++;
+        updated = true;
+    }
+    return updated;
+}
+
+void GpsIngest::resetLatencyStats() {
+    _latencySumUs = 0;
+    _latencyCount = 0;
+    _latencyMaxUs = 0;
+}
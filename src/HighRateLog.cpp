@@ -0,0 +1,72 @@
+#include "HighRateLog.h"
+
+const TelemetryLog::Column HighRateLog::COLUMNS[FIELD_COUNT] = {
+    { "Speed_GPS",    TelemetryLog::ENC_U16, 2 },
+    { "Speed_Smooth", TelemetryLog::ENC_U16, 2 },
+    { "Pump_State",   TelemetryLog::ENC_BIT, 0 },
+    { "Roll",         TelemetryLog::ENC_I16, 1 },
+    { "Pitch",        TelemetryLog::ENC_I16, 1 },
+    { "Accel_X",      TelemetryLog::ENC_I16, 2 },
+    { "Accel_Y",      TelemetryLog::ENC_I16, 2 },
+    { "Accel_Z",      TelemetryLog::ENC_I16, 2 },
+};
+
+HighRateLog::HighRateLog() {
+    _count[0] = _count[1] = 0;
+    _full[0] = false;
+    _full[1] = false;
+    _fill = 0;
+    _fillCount = 0;
+    _samples = 0;
+    _dropped = 0;
+    _take = 0;
+    _written = 0;
+}
+
+bool HighRateLog::add(const Sample& s) {
+    if (_full[_fill].load(std::memory_order_acquire)) { // Writer hasn't finished it yet
+        _dropped++;
+        return false;
+    }
+    _buf[_fill][_fillCount++] = s;
+    _samples++;
+    if (_fillCount >= HIGHRATE_BUFFER_SAMPLES) handOver();
+    return true;
+}
+
+void HighRateLog::handOver() {
+    if (_fillCount == 0 || _full[_fill].load(std::memory_order_acquire)) return;
+    _count[_fill] = _fillCount;
+    _full[_fill].store(true, std::memory_order_release);
+    _fill ^= 1;
+    _fillCount = 0;
+}
+
+bool HighRateLog::peekTime(uint32_t& timeMs) const {
+    if (!_full[_take].load(std::memory_order_acquire)) return false;
+    timeMs = _buf[_take][0].timeMs;
+    return true;
+}
+
+uint32_t HighRateLog::writeNext(TelemetryLog& out) {
+    if (!_full[_take].load(std::memory_order_acquire)) return 0;
+
+    uint32_t n = _count[_take];
+    double values[FIELD_COUNT];
+    for (uint32_t i = 0; i < n; i++) {
+        const Sample& s = _buf[_take][i];
+        values[SPEED_GPS] = s.speedGps;
+        values[SPEED_SMOOTH] = s.speedSmooth;
+        values[PUMP_STATE] = s.pumpOn;
+        values[ROLL] = s.roll;
+        values[PITCH] = s.pitch;
+        values[ACCEL_X] = s.accelX;
+        values[ACCEL_Y] = s.accelY;
+        values[ACCEL_Z] = s.accelZ;
+        out.write(TelemetryLog::REC_DATA, s.timeMs, values);
+    }
+    _full[_take].store(false, std::memory_order_release);
+    _take ^= 1;
+    _written++;
+    return n;
+}
@@ -1,10 +1,26 @@
 #include "ImuHandler.h"
 
-ImuHandler::ImuHandler() {
+static const uint16_t IMU_CONFIG_VERSION = 1;
+
+const ConfigField ImuHandler::CALIBRATION_FIELDS[] = {
+    CONFIG_FIELD(ImuHandler::CalibrationData, offsetRoll, "off_r", T_BLOB, 1),
+    CONFIG_FIELD(ImuHandler::CalibrationData, offsetPitch, "off_p", T_BLOB, 1),
+    CONFIG_FIELD(ImuHandler::CalibrationData, sideStandRoll, "side_r", T_BLOB, 1),
+    CONFIG_FIELD(ImuHandler::CalibrationData, sideStandCalibrated, "side_cal", T_U8, 1),
+    CONFIG_FIELD(ImuHandler::CalibrationData, chainOnRight, "chain_r", T_U8, 1),
+};
+const int ImuHandler::CALIBRATION_FIELD_COUNT = sizeof(ImuHandler::CALIBRATION_FIELDS) / sizeof(ImuHandler::CALIBRATION_FIELDS[0]);
+
+ImuHandler::ImuHandler() : _calibration(IMU_CONFIG_VERSION, CALIBRATION_FIELDS, CALIBRATION_FIELD_COUNT) {
     _lastMotionTime = 0;
+    _prefs.begin("imu");
 }
 
 bool ImuHandler::begin(int sda, int scl) {
+    return probe() && activate();
+}
+
+bool ImuHandler::probe() {
     // Initialize I2C
     // Wire.begin(sda, scl); // Assumed Wire is already started or we start it here
     // Better to let main handle Wire.begin if shared, but here we can do it safely.
@@ -13,7 +29,7 @@ bool ImuHandler::begin(int sda, int scl) {
     
     if (!_bno.begin_I2C()) {
         Serial.println("IMU: BNO08x not detected. Disabling IMU features.");
-        _available = false;
+        _found = false;
         return false;
     }
 
@@ -32,6 +48,12 @@ bool ImuHandler::begin(int sda, int scl) {
         Serial.println("IMU: Could not enable Linear Accel");
     }
 
+    _found = true;
+    return true;
+}
+
+bool ImuHandler::activate() {
+    if (!_found) return false;
     loadCalibration();
     _available = true;
     return true;
@@ -132,23 +154,30 @@ void ImuHandler::calibrateSideStand() {
 }
 
 void ImuHandler::saveCalibration() {
-    _prefs.begin("imu", false);
-    _prefs.putFloat("off_r", _offsetRoll);
-    _prefs.putFloat("off_p", _offsetPitch);
-    _prefs.putFloat("side_r", _sideStandRoll);
-    _prefs.putBool("side_cal", _sideStandCalibrated);
-    _prefs.putBool("chain_r", _chainOnRight);
-    _prefs.end();
+    CalibrationData& cal = _calibration.data();
+    cal.offsetRoll = _offsetRoll;
+    cal.offsetPitch = _offsetPitch;
+    cal.sideStandRoll = _sideStandRoll;
+    cal.sideStandCalibrated = _sideStandCalibrated;
+    cal.chainOnRight = _chainOnRight;
+    _calibration.save(_prefs);
 }
 
 void ImuHandler::loadCalibration() {
-    _prefs.begin("imu", true);
-    _offsetRoll = _prefs.getFloat("off_r", 0.0);
-    _offsetPitch = _prefs.getFloat("off_p", 0.0);
-    _sideStandRoll = _prefs.getFloat("side_r", 0.0);
-    _sideStandCalibrated = _prefs.getBool("side_cal", false);
-    _chainOnRight = _prefs.getBool("chain_r", true);
-    _prefs.end();
+    CalibrationData& cal = _calibration.data();
+    cal.offsetRoll = 0.0;
+    cal.offsetPitch = 0.0;
+    cal.sideStandRoll = 0.0;
+    cal.sideStandCalibrated = false;
+    cal.chainOnRight = true;
+    ConfigLoadResult result = _calibration.load(_prefs);
+
+    _offsetRoll = cal.offsetRoll;
+    _offsetPitch = cal.offsetPitch;
+    _sideStandRoll = cal.sideStandRoll;
+    _sideStandCalibrated = cal.sideStandCalibrated != 0;
+    _chainOnRight = cal.chainOnRight != 0;
+    if (result != CONFIG_LOADED) _calibration.save(_prefs);
 }
 
 void ImuHandler::setChainSide(bool isRight) {
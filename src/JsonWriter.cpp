@@ -0,0 +1,123 @@
+#include "JsonWriter.h"
+#include <math.h>
+
+static const uint32_t POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+JsonWriter::JsonWriter(Print& out) : _out(out) {
+    _started = 0;
+    _depth = 0;
+}
+
+void JsonWriter::next(const char* key) {
+    uint16_t bit = 1 << _depth;
+    if (_started & bit) _out.write(',');
+    _started |= bit;
+    if (key != NULL) {
+        string(key);
+        _out.write(':');
+    }
+}
+
+void JsonWriter::open(const char* key, char c) {
+    if (_depth > 0) next(key);
+    _out.write(c);
+    if (_depth < MAX_DEPTH - 1) _depth++;
+    _started &= ~(1 << _depth);
+}
+
+void JsonWriter::close(char c) {
+    _out.write(c);
+    if (_depth > 0) _depth--;
+}
+
+void JsonWriter::beginObject(const char* key) { open(key, '{'); }
+void JsonWriter::endObject() { close('}'); }
+void JsonWriter::beginArray(const char* key) { open(key, '['); }
+void JsonWriter::endArray() { close(']'); }
+
+void JsonWriter::digits(unsigned long long value) {
+    char tmp[20];
+    int n = 0;
+    do {
+        tmp[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+    while (n) _out.write(tmp[--n]);
+}
+
+void JsonWriter::string(const char* s) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    _out.write('"');
+    for (; *s; s++) {
+        uint8_t c = *s;
+        if (c == '"' || c == '\\') {
+            _out.write('\\');
+            _out.write(c);
+        } else if (c == '\n') {
+            _out.print("\\n");
+        } else if (c < 0x20) {
+            _out.print("\\u00");
+            _out.write(HEX_DIGITS[c >> 4]);
+            _out.write(HEX_DIGITS[c & 15]);
+        } else {
+            _out.write(c); // UTF-8 passes through
+        }
+    }
+    _out.write('"');
+}
+
+void JsonWriter::add(const char* key, const char* value) {
+    next(key);
+    if (value == NULL) _out.print("null");
+    else string(value);
+}
+
+void JsonWriter::add(const char* key, long value) {
+    next(key);
+    if (value < 0) {
+        _out.write('-');
+        digits((unsigned long)0 - (unsigned long)value);
+    } else {
+        digits((unsigned long)value);
+    }
+}
+
+void JsonWriter::add(const char* key, unsigned long value) {
+    next(key);
+    digits(value);
+}
+
+// Same rounding as LogWriter::addFixed()
+void JsonWriter::addFixed(const char* key, double value, uint8_t decimals) {
+    next(key);
+    if (decimals > 6) decimals = 6;
+    if (isnan(value) || isinf(value) || fabs(value) >= 1e12) {
+        _out.print("null");
+        return;
+    }
+    if (value < 0) {
+        value = -value;
+        if (value * POW10[decimals] >= 0.5) _out.write('-'); // No "-0.00"
+    }
+    unsigned long long scaled = (unsigned long long)(value * POW10[decimals] + 0.5);
+    digits(scaled / POW10[decimals]);
+    if (decimals == 0) return;
+    char frac[7];
+    uint32_t f = (uint32_t)(scaled % POW10[decimals]);
+    for (int i = decimals - 1; i >= 0; i--) {
+        frac[i] = '0' + f % 10;
+        f /= 10;
+    }
+    _out.write('.');
+    _out.write((const uint8_t*)frac, decimals);
+}
+
+void JsonWriter::addBool(const char* key, bool value) {
+    next(key);
+    _out.print(value ? "true" : "false");
+}
+
+void JsonWriter::addNull(const char* key) {
+    next(key);
+    _out.print("null");
+}
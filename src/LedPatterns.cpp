@@ -0,0 +1,99 @@
+#include "LedPatterns.h"
+#include "LedRenderer.h"
+#include "config.h"
+
+namespace {
+    enum Wave : uint8_t {
+        WAVE_STATIC,  // color @ level
+        WAVE_BLINK,   // First half of the period color @ level, second half color2 @ level2
+        WAVE_DOUBLE,  // color @ level during [0, onMs) and [2*onMs, 3*onMs), else color2 @ level2
+        WAVE_PULSE    // Sine from minPct % to 100 % of level, at least minBri
+    };
+
+    enum Level : uint8_t {
+        LEVEL_DIM,
+        LEVEL_HIGH
+    };
+
+    struct Pattern {
+        uint8_t bit;       // LedStatusBit (= priority)
+        Wave wave;
+        uint32_t color;
+        uint8_t level;
+        uint32_t color2;
+        uint8_t level2;
+        uint16_t periodMs;
+        uint16_t onMs;     // WAVE_DOUBLE
+        uint8_t minPct;    // WAVE_PULSE
+        uint8_t minBri;    // WAVE_PULSE
+    };
+
+    constexpr uint32_t rgb(uint8_t r, uint8_t g, uint8_t b) {
+        return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+
+    constexpr uint32_t RED = rgb(255, 0, 0);
+    constexpr uint32_t GREEN = rgb(0, 255, 0);
+    constexpr uint32_t BLUE = rgb(0, 0, 255);
+    constexpr uint32_t CYAN = rgb(0, 255, 255);
+    constexpr uint32_t MAGENTA = rgb(255, 0, 255);
+    constexpr uint32_t WHITE = rgb(255, 255, 255);
+    constexpr uint32_t YELLOW = rgb(255, 200, 0);
+    constexpr uint32_t ORANGE = rgb(255, 140, 0);
+    constexpr uint32_t ORANGE_RED = rgb(255, 69, 0);
+    constexpr uint32_t OFF = 0;
+
+    // Ordered by priority, see LedStatusBit
+    constexpr Pattern PATTERNS[LED_ST_COUNT] = {
+        { LED_ST_UPDATE,      WAVE_BLINK,  CYAN,       LEVEL_HIGH, OFF,   LEVEL_HIGH, 2 * LED_BLINK_FAST,    0,   0, 0 },
+        { LED_ST_CRASH,       WAVE_BLINK,  RED,        LEVEL_HIGH, WHITE, LEVEL_HIGH, 200,                   0,   0, 0 },
+        { LED_ST_BLEEDING,    WAVE_BLINK,  RED,        LEVEL_HIGH, OFF,   LEVEL_HIGH, 2 * LED_BLINK_FAST,    0,   0, 0 },
+        { LED_ST_FLUSH,       WAVE_BLINK,  CYAN,       LEVEL_HIGH, OFF,   LEVEL_HIGH, 2 * LED_PERIOD_FLUSH,  0,   0, 0 },
+        { LED_ST_OFFROAD,     WAVE_BLINK,  MAGENTA,    LEVEL_HIGH, OFF,   LEVEL_HIGH, 2000,                  0,   0, 0 },
+        { LED_ST_WIFI_NEW,    WAVE_PULSE,  WHITE,      LEVEL_HIGH, OFF,   LEVEL_HIGH, LED_PERIOD_WIFI,       0,  20, 5 },
+        { LED_ST_OILING,      WAVE_PULSE,  YELLOW,     LEVEL_HIGH, OFF,   LEVEL_HIGH, LED_PERIOD_OILING,     0,   0, 5 },
+        { LED_ST_WIFI,        WAVE_PULSE,  WHITE,      LEVEL_HIGH, OFF,   LEVEL_HIGH, 3142,                  0,   0, 10 }, // sin(now / 500)
+        { LED_ST_TANK_LOW,    WAVE_DOUBLE, ORANGE_RED, LEVEL_HIGH, OFF,   LEVEL_HIGH, LED_BLINK_TANK,        200, 0, 0 },
+        { LED_ST_NOFIX_EMERG, WAVE_STATIC, CYAN,       LEVEL_DIM,  OFF,   LEVEL_DIM,  0,                     0,   0, 0 },
+        { LED_ST_NOFIX,       WAVE_STATIC, OFF,        LEVEL_DIM,  OFF,   LEVEL_DIM,  0,                     0,   0, 0 },
+        { LED_ST_EMERGENCY,   WAVE_DOUBLE, ORANGE,     LEVEL_HIGH, GREEN, LEVEL_DIM,  LED_PERIOD_EMERGENCY,  100, 0, 0 },
+        { LED_ST_RAIN,        WAVE_STATIC, BLUE,       LEVEL_DIM,  OFF,   LEVEL_DIM,  0,                     0,   0, 0 },
+        { LED_ST_IDLE,        WAVE_STATIC, GREEN,      LEVEL_DIM,  OFF,   LEVEL_DIM,  0,                     0,   0, 0 }
+    };
+
+    // Every entry must sit at its own bit number
+    constexpr bool tableOrdered(int i) {
+        return i >= LED_ST_COUNT || (PATTERNS[i].bit == i && tableOrdered(i + 1));
+    }
+    static_assert(tableOrdered(0), "PATTERNS must be ordered by LedStatusBit");
+}
+
+void LedPatterns::render(uint32_t status, unsigned long now, uint8_t dim, uint8_t high, uint32_t& color, uint8_t& bri) {
+    status |= LED_STATUS(LED_ST_IDLE);
+    const Pattern& p = PATTERNS[__builtin_ctz(status)];
+    uint8_t level = (p.level == LEVEL_HIGH) ? high : dim;
+
+    switch (p.wave) {
+        case WAVE_STATIC:
+            color = p.color;
+            bri = level;
+            break;
+        case WAVE_BLINK:
+        case WAVE_DOUBLE: {
+            unsigned long phase = now % p.periodMs;
+            bool on = (p.wave == WAVE_BLINK) ? (phase < p.periodMs / 2u)
+                                             : (phase < p.onMs || (phase >= 2u * p.onMs && phase < 3u * p.onMs));
+            color = on ? p.color : p.color2;
+            bri = on ? level : ((p.level2 == LEVEL_HIGH) ? high : dim);
+            break;
+        }
+        case WAVE_PULSE: {
+            uint16_t lo = (uint16_t)level * p.minPct / 100;
+            uint16_t span = (uint16_t)level * (100 - p.minPct) / 100;
+            bri = (uint8_t)(lo + ((uint16_t)LedRenderer::sine8(now, p.periodMs) * span) / 255);
+            if (bri < p.minBri) bri = p.minBri;
+            color = p.color;
+            break;
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#include "LedRenderer.h"
+#include <string.h>
+
+// WS2812 bit timing (ns)
+#define WS2812_T0H_NS 400
+#define WS2812_T0L_NS 850
+#define WS2812_T1H_NS 800
+#define WS2812_T1L_NS 450
+
+static uint32_t t0hTicks = 0;
+static uint32_t t0lTicks = 0;
+static uint32_t t1hTicks = 0;
+static uint32_t t1lTicks = 0;
+
+// (sin(2*PI*i/256) + 1) / 2 * 255
+static const uint8_t SINE8[256] = {
+    128, 131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 162, 165, 167, 170, 173,
+    176, 179, 182, 185, 188, 190, 193, 196, 198, 201, 203, 206, 208, 211, 213, 215,
+    218, 220, 222, 224, 226, 228, 230, 232, 234, 235, 237, 238, 240, 241, 243, 244,
+    245, 246, 248, 249, 250, 250, 251, 252, 253, 253, 254, 254, 254, 255, 255, 255,
+    255, 255, 255, 255, 254, 254, 254, 253, 253, 252, 251, 250, 250, 249, 248, 246,
+    245, 244, 243, 241, 240, 238, 237, 235, 234, 232, 230, 228, 226, 224, 222, 220,
+    218, 215, 213, 211, 208, 206, 203, 201, 198, 196, 193, 190, 188, 185, 182, 179,
+    176, 173, 170, 167, 165, 162, 158, 155, 152, 149, 146, 143, 140, 137, 134, 131,
+    128, 124, 121, 118, 115, 112, 109, 106, 103, 100,  97,  93,  90,  88,  85,  82,
+     79,  76,  73,  70,  67,  65,  62,  59,  57,  54,  52,  49,  47,  44,  42,  40,
+     37,  35,  33,  31,  29,  27,  25,  23,  21,  20,  18,  17,  15,  14,  12,  11,
+     10,   9,   7,   6,   5,   5,   4,   3,   2,   2,   1,   1,   1,   0,   0,   0,
+      0,   0,   0,   0,   1,   1,   1,   2,   2,   3,   4,   5,   5,   6,   7,   9,
+     10,  11,  12,  14,  15,  17,  18,  20,  21,  23,  25,  27,  29,  31,  33,  35,
+     37,  40,  42,  44,  47,  49,  52,  54,  57,  59,  62,  65,  67,  70,  73,  76,
+     79,  82,  85,  88,  90,  93,  97, 100, 103, 106, 109, 112, 115, 118, 121, 124,
+};
+
+// RMT translator: one item per bit, MSB first (runs in the RMT interrupt)
+static void IRAM_ATTR ws2812Translate(const void* src, rmt_item32_t* dest, size_t srcSize,
+                                      size_t wantedNum, size_t* translatedSize, size_t* itemNum) {
+    if (src == NULL || dest == NULL) {
+        *translatedSize = 0;
+        *itemNum = 0;
+        return;
+    }
+    rmt_item32_t bit0;
+    rmt_item32_t bit1;
+    bit0.duration0 = t0hTicks; bit0.level0 = 1; bit0.duration1 = t0lTicks; bit0.level1 = 0;
+    bit1.duration0 = t1hTicks; bit1.level0 = 1; bit1.duration1 = t1lTicks; bit1.level1 = 0;
+
+    const uint8_t* in = (const uint8_t*)src;
+    size_t size = 0;
+    size_t num = 0;
+    while (size < srcSize && num + 8 <= wantedNum) {
+        for (int i = 7; i >= 0; i--) {
+            dest->val = (in[size] & (1 << i)) ? bit1.val : bit0.val;
+            dest++;
+        }
+        num += 8;
+        size++;
+    }
+    *translatedSize = size;
+    *itemNum = num;
+}
+
+LedRenderer::LedRenderer(int pin, rmt_channel_t channel) {
+    _pin = pin;
+    _channel = channel;
+    _ready = false;
+    _pending = false;
+    memset(_frame, 0, sizeof(_frame));
+    memset(_tx, 0, sizeof(_tx));
+    _frames = 0;
+    _pushes = 0;
+    _busy = 0;
+}
+
+void LedRenderer::begin() {
+    rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)_pin, _channel);
+    config.clk_div = 2; // 40 MHz, 25 ns per tick
+    if (rmt_config(&config) != ESP_OK || rmt_driver_install(_channel, 0, 0) != ESP_OK) {
+        Serial.println("LED: RMT init failed!");
+        return;
+    }
+
+    uint32_t counterHz = 0;
+    rmt_get_counter_clock(_channel, &counterHz);
+    float ticksPerNs = (float)counterHz / 1e9;
+    t0hTicks = (uint32_t)(ticksPerNs * WS2812_T0H_NS);
+    t0lTicks = (uint32_t)(ticksPerNs * WS2812_T0L_NS);
+    t1hTicks = (uint32_t)(ticksPerNs * WS2812_T1H_NS);
+    t1lTicks = (uint32_t)(ticksPerNs * WS2812_T1L_NS);
+    rmt_translator_init(_channel, ws2812Translate);
+    _ready = true;
+
+    // All pixels off
+    _pending = true;
+    show();
+}
+
+void LedRenderer::setPixel(int index, uint32_t color, uint8_t brightness) {
+    if (index < 0 || index >= NUM_LEDS) return;
+    // Same scaling as Adafruit_NeoPixel::setBrightness(), but per pixel
+    uint16_t scale = (uint16_t)brightness + 1;
+    uint8_t* p = &_frame[index * 3];
+    p[0] = (uint8_t)((((color >> 8) & 0xFF) * scale) >> 8);  // G
+    p[1] = (uint8_t)((((color >> 16) & 0xFF) * scale) >> 8); // R
+    p[2] = (uint8_t)(((color & 0xFF) * scale) >> 8);         // B
+}
+
+bool LedRenderer::show() {
+    _frames++;
+    if (!_ready) return false;
+    if (!_pending && memcmp(_frame, _tx, sizeof(_frame)) == 0) return false; // Nothing changed
+
+    // _tx is still read by the driver until the last transfer is done
+    if (rmt_wait_tx_done(_channel, 0) != ESP_OK) {
+        _pending = true;
+        _busy++;
+        return false;
+    }
+    memcpy(_tx, _frame, sizeof(_tx));
+    rmt_write_sample(_channel, _tx, sizeof(_tx), false);
+    _pending = false;
+    _pushes++;
+    return true;
+}
+
+uint8_t LedRenderer::sine8(unsigned long now, unsigned long periodMs) {
+    if (periodMs == 0) return 0;
+    return SINE8[(uint8_t)(((uint64_t)(now % periodMs) << 8) / periodMs)];
+}
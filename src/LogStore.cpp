@@ -0,0 +1,315 @@
+#include "LogStore.h"
+#include <string.h>
+
+LogStore::LogStore(const char* dir, const char* ext, uint32_t segmentSize, uint16_t segmentCount) {
+    _fs = NULL;
+    _dir = dir;
+    _ext = ext;
+    _segmentSize = segmentSize - segmentSize % LOG_SEGMENT_HEADER_SIZE;
+    if (_segmentSize < (LOG_INDEX_SECTORS + 2) * LOG_SEGMENT_HEADER_SIZE) {
+        _segmentSize = (LOG_INDEX_SECTORS + 2) * LOG_SEGMENT_HEADER_SIZE;
+    }
+    _count = segmentCount > 0 ? segmentCount : 1;
+    _slot = 0;
+    _seq = 0;
+    _log = 0;
+    _part = 0;
+    _partOffset = 0;
+    _length = 0;
+    memset(_index, 0, sizeof(_index));
+    _indexCount = 0;
+    _indexDirty = false;
+    _indexDropped = 0;
+    _segmentStarted = false;
+    _headerOffset = 0;
+    _headerLength = 0;
+    _spareSlot = 0;
+    _spareSize = 0;
+    _sparesReady = 0;
+    _spareError = false;
+    _rotations = 0;
+    _created = 0;
+}
+
+String LogStore::segmentPath(uint16_t slot) const {
+    char name[8];
+    snprintf(name, sizeof(name), "/%03u", slot);
+    return String(_dir) + name + _ext;
+}
+
+String LogStore::indexPath() const {
+    return String(_dir) + "/store.idx";
+}
+
+bool LogStore::readHeader(uint16_t slot, LogSegmentHeader& h) {
+    File f = _fs->open(segmentPath(slot), FILE_READ);
+    if (!f) return false;
+    bool ok = f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) && h.isValid();
+    f.close();
+    return ok;
+}
+
+// "slot seq log" of the newest segment
+bool LogStore::readIndex(uint16_t& slot, uint32_t& seq, uint32_t& log) {
+    File f = _fs->open(indexPath(), FILE_READ);
+    if (!f) return false;
+    char buf[40];
+    int len = f.read((uint8_t*)buf, sizeof(buf) - 1);
+    f.close();
+    if (len <= 0) return false;
+    buf[len] = 0;
+    unsigned s;
+    unsigned long q, l;
+    if (sscanf(buf, "%u %lu %lu", &s, &q, &l) != 3) return false;
+    slot = s;
+    seq = q;
+    log = l;
+    return true;
+}
+
+void LogStore::writeIndex() {
+    File f = _fs->open(indexPath(), FILE_WRITE);
+    if (!f) return;
+    char buf[40];
+    int len = snprintf(buf, sizeof(buf), "%u %lu %lu\n", _slot, (unsigned long)_seq, (unsigned long)_log);
+    f.write((const uint8_t*)buf, len);
+    f.close();
+}
+
+// Zero filled once, afterwards only overwritten (no more cluster allocation)
+bool LogStore::preallocate(uint16_t slot) {
+    String path = segmentPath(slot);
+    if (_spare && _spareSlot == slot) _spare.close(); // Half filled spare: finish it here
+    File f = _fs->open(path, FILE_READ);
+    if (f) {
+        bool ready = f.size() >= _segmentSize;
+        f.close();
+        if (ready) return true;
+    }
+
+    f = _fs->open(path, FILE_WRITE);
+    if (!f) return false;
+    uint8_t zero[LOG_SEGMENT_HEADER_SIZE];
+    memset(zero, 0, sizeof(zero));
+    uint32_t size = 0;
+    while (size < _segmentSize && f.write(zero, sizeof(zero)) == sizeof(zero)) size += sizeof(zero);
+    f.close();
+    _created++;
+    return size >= _segmentSize;
+}
+
+bool LogStore::begin(fs::FS& fs, uint32_t log) {
+    std::lock_guard<std::mutex> guard(_spareLock);
+    _fs = &fs;
+    if (!fs.exists(_dir)) fs.mkdir(_dir);
+
+    // Newest segment from the index, the headers are only read if it is missing or stale
+    int newest = -1;
+    uint32_t newestSeq = 0;
+    uint32_t maxLog = 0;
+    LogSegmentHeader h;
+    uint16_t slot;
+    uint32_t seq, indexLog;
+    if (readIndex(slot, seq, indexLog) && slot < _count && readHeader(slot, h) && h.seq == seq) {
+        newest = slot;
+        newestSeq = seq;
+        maxLog = indexLog;
+    } else {
+        for (uint16_t s = 0; s < _count; s++) {
+            if (!readHeader(s, h)) continue; // Not created yet or never used
+            if (newest < 0 || h.seq > newestSeq) {
+                newest = s;
+                newestSeq = h.seq;
+            }
+            if (h.log > maxLog) maxLog = h.log;
+        }
+        Serial.printf("[LOG] %s index rebuilt\n", _dir);
+    }
+
+    _seq = newestSeq;
+    _log = log != 0 ? log : maxLog + 1;
+    _part = 0;
+    _partOffset = 0;
+    bool ok = startSegment(newest < 0 ? 0 : (newest + 1) % _count);
+    _sparesReady = 0;
+    while (_sparesReady < LOG_STORE_PREALLOC_AHEAD && _sparesReady + 1 < _count &&
+           preallocate((_slot + 1 + _sparesReady) % _count)) {
+        _sparesReady++;
+    }
+    return ok;
+}
+
+bool LogStore::prepareSpares() {
+    std::lock_guard<std::mutex> guard(_spareLock);
+    if (!_file || _spareError) return false;
+
+    while (_sparesReady < LOG_STORE_PREALLOC_AHEAD && _sparesReady + 1 < _count) {
+        uint16_t slot = (_slot + 1 + _sparesReady) % _count;
+        if (!_spare || _spareSlot != slot) {
+            if (_spare) _spare.close();
+            String path = segmentPath(slot);
+            File f = _fs->open(path, FILE_READ);
+            bool ready = f && f.size() >= _segmentSize;
+            if (f) f.close();
+            if (ready) { // Recycled segment, already full size
+                _sparesReady++;
+                continue;
+            }
+            _spare = _fs->open(path, FILE_WRITE);
+            if (!_spare) {
+                _spareError = true;
+                return false;
+            }
+            _spareSlot = slot;
+            _spareSize = 0;
+        }
+
+        uint8_t zero[LOG_SEGMENT_HEADER_SIZE];
+        memset(zero, 0, sizeof(zero));
+        uint32_t end = _spareSize + LOG_STORE_PREALLOC_CHUNK_KB * 1024UL;
+        if (end > _segmentSize) end = _segmentSize;
+        while (_spareSize < end && _spare.write(zero, sizeof(zero)) == sizeof(zero)) _spareSize += sizeof(zero);
+        if (_spareSize < end) {
+            _spare.close();
+            _spareError = true;
+            return false;
+        }
+        if (_spareSize >= _segmentSize) {
+            _spare.close();
+            _created++;
+            _sparesReady++;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool LogStore::startSegment(uint16_t slot) {
+    if (_file) _file.close();
+    _slot = slot;
+    if (!preallocate(slot)) { // Only slow without a spare (or on a full card)
+        Serial.printf("[LOG] Cannot allocate %s\n", segmentPath(slot).c_str());
+        return false;
+    }
+    _file = _fs->open(segmentPath(slot), "r+"); // Overwrite in place, keeps the size
+    if (!_file) return false;
+
+    _seq++;
+    _length = 0;
+    _headerOffset = 0;
+    _headerLength = 0;
+    _indexCount = 0;
+    _indexDirty = false;
+    writeIndex();
+    if (!writeHeader()) {
+        _file.close();
+        return false;
+    }
+    return true;
+}
+
+// Sector 0 is rewritten in place, the file position is kept at the end of the data
+bool LogStore::writeHeader() {
+    uint8_t sector[LOG_SEGMENT_HEADER_SIZE];
+    memset(sector, 0, sizeof(sector));
+    LogSegmentHeader h;
+    h.magic = LOG_SEGMENT_MAGIC;
+    h.seq = _seq;
+    h.log = _log;
+    h.part = _part;
+    h.offset = _partOffset;
+    h.length = _length;
+    h.segmentSize = _segmentSize;
+    h.indexSectors = LOG_INDEX_SECTORS;
+    h.indexCount = _indexCount;
+    h.headerOffset = _headerOffset;
+    h.headerLength = _headerLength;
+    h.seal();
+    memcpy(sector, &h, sizeof(h));
+
+    bool ok = _file.seek(0) && _file.write(sector, sizeof(sector)) == sizeof(sector);
+    _file.seek(LOG_SEGMENT_HEADER_SIZE + _length);
+    return ok;
+}
+
+// The index sector holding the newest entry, in place like the header
+bool LogStore::writeIndexSector() {
+    uint32_t sector = (_indexCount - 1) / INDEX_PER_SECTOR;
+    uint32_t used = _indexCount - sector * INDEX_PER_SECTOR;
+    memset(_index + used, 0, (INDEX_PER_SECTOR - used) * sizeof(LogIndexEntry));
+
+    uint32_t pos = LOG_SEGMENT_HEADER_SIZE + dataCapacity() + sector * LOG_SEGMENT_HEADER_SIZE;
+    bool ok = _file.seek(pos) && _file.write((const uint8_t*)_index, sizeof(_index)) == sizeof(_index);
+    _file.seek(LOG_SEGMENT_HEADER_SIZE + _length);
+    _indexDirty = false;
+    return ok;
+}
+
+void LogStore::addIndex(uint32_t timeMs, uint32_t offset, bool event) {
+    if (!_file) return;
+    if (_indexCount >= LOG_INDEX_SECTORS * INDEX_PER_SECTOR) { // Readers fall back to scanning
+        _indexDropped++;
+        return;
+    }
+    LogIndexEntry& e = _index[_indexCount % INDEX_PER_SECTOR];
+    e.timeMs = timeMs;
+    e.offset = offset | (event ? LOG_INDEX_EVENT : 0);
+    _indexCount++;
+    _indexDirty = true;
+    if (_indexCount % INDEX_PER_SECTOR == 0) writeIndexSector();
+}
+
+bool LogStore::rotate() {
+    std::lock_guard<std::mutex> guard(_spareLock); // The spare task may be filling the next one
+    if (_indexDirty) writeIndexSector();
+    writeHeader(); // Final length
+    _file.flush();
+    _partOffset += _length;
+    _part++;
+    _rotations++;
+    _segmentStarted = true;
+    if (_sparesReady > 0) _sparesReady--; // Using one up
+    _spareError = false;
+    return startSegment((_slot + 1) % _count);
+}
+
+bool LogStore::takeSegmentStarted() {
+    if (!_segmentStarted) return false;
+    _segmentStarted = false;
+    return true;
+}
+
+// Written with the next header update (flush / rotation)
+void LogStore::setHeaderCopy(uint32_t offset, uint32_t length) {
+    if (offset < _partOffset) return; // Already in the next segment (not expected: the header is small)
+    _headerOffset = offset;
+    _headerLength = length;
+}
+
+size_t LogStore::write(const uint8_t* buffer, size_t size) {
+    size_t done = 0;
+    while (done < size && _file) {
+        uint32_t room = dataCapacity() - _length;
+        if (room == 0) {
+            if (!rotate()) break; // Full: continue in the next (oldest) segment
+            continue;
+        }
+        size_t n = size - done < room ? size - done : room;
+        size_t written = _file.write(buffer + done, n);
+        _length += written;
+        done += written;
+        if (written != n) break;
+    }
+    return done;
+}
+
+size_t LogStore::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+void LogStore::flush() {
+    if (!_file) return;
+    if (_indexDirty) writeIndexSector();
+    writeHeader();
+    _file.flush();
+}
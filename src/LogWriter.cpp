@@ -0,0 +1,143 @@
+#include "LogWriter.h"
+
+static const uint32_t POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+LogWriter::LogWriter() {
+    _out = NULL;
+    _len = 0;
+    _lastFlush = 0;
+    _position = 0;
+    _lines = 0;
+    _bytes = 0;
+    _writes = 0;
+    _errors = 0;
+    _maxWriteUs = 0;
+}
+
+void LogWriter::begin(Print* out) {
+    if (_out != NULL && out != _out) flush();
+    _out = out;
+    _len = 0;
+    _position = 0;
+    _lastFlush = millis();
+}
+
+void LogWriter::reserve(size_t n) {
+    if (_len + n <= sizeof(_buf)) return;
+    writeSectors();
+    if (_len + n > sizeof(_buf)) writeOut(_len); // Less than a sector buffered
+}
+
+void LogWriter::add(const char* s) {
+    size_t n = strlen(s);
+    reserve(n);
+    if (n > sizeof(_buf) - _len) n = sizeof(_buf) - _len;
+    memcpy(_buf + _len, s, n);
+    _len += n;
+}
+
+void LogWriter::add(char c) {
+    reserve(1);
+    _buf[_len++] = c;
+}
+
+void LogWriter::addUInt(uint32_t value) {
+    addDigits(value);
+}
+
+void LogWriter::addDigits(uint64_t value) {
+    char tmp[20];
+    int n = 0;
+    do {
+        tmp[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+    reserve(n);
+    while (n) _buf[_len++] = tmp[--n];
+}
+
+void LogWriter::addInt(int32_t value) {
+    if (value < 0) {
+        add('-');
+        addUInt((uint32_t)0 - (uint32_t)value);
+    } else {
+        addUInt((uint32_t)value);
+    }
+}
+
+void LogWriter::addFixed(double value, uint8_t decimals) {
+    if (decimals > 6) decimals = 6;
+    if (isnan(value)) { add("nan"); return; }
+    if (value < 0) {
+        value = -value;
+        if (value * POW10[decimals] >= 0.5) add('-'); // No "-0.00"
+    }
+    if (!(value < 1e12)) { add("inf"); return; }
+
+    uint64_t scaled = (uint64_t)(value * POW10[decimals] + 0.5);
+    addDigits(scaled / POW10[decimals]);
+    if (decimals == 0) return;
+    uint32_t frac = (uint32_t)(scaled % POW10[decimals]);
+    reserve(decimals + 1);
+    _buf[_len++] = '.';
+    for (int i = decimals - 1; i >= 0; i--) {
+        _buf[_len + i] = '0' + frac % 10;
+        frac /= 10;
+    }
+    _len += decimals;
+}
+
+void LogWriter::addBytes(const void* data, size_t len) {
+    reserve(len);
+    if (len > sizeof(_buf) - _len) len = sizeof(_buf) - _len;
+    memcpy(_buf + _len, data, len);
+    _len += len;
+}
+
+void LogWriter::endLine() {
+    add('\n');
+    endRecord();
+}
+
+void LogWriter::endRecord() {
+    _lines++;
+    // Nearly full: the next line might not fit
+    if (_len > sizeof(_buf) - LOG_SECTOR_SIZE / 2) writeSectors();
+}
+
+void LogWriter::writeOut(size_t n) {
+    if (n == 0) return;
+    if (_out != NULL) {
+        uint32_t start = micros();
+        size_t written = _out->write((const uint8_t*)_buf, n);
+        uint32_t us = micros() - start;
+        if (us > _maxWriteUs) _maxWriteUs = us;
+        _writes++;
+        _bytes += written;
+        _position += written;
+        if (written != n) _errors++;
+    }
+    // Dropped on errors: a retry would only stall the loop on a dead card
+    memmove(_buf, _buf + n, _len - n);
+    _len -= n;
+}
+
+// Up to the last sector boundary of the file, not of the buffer: after a
+// flush() the file ends mid-sector and the next write fills that sector up
+void LogWriter::writeSectors() {
+    size_t partial = (_position + _len) % LOG_SECTOR_SIZE;
+    if (partial <= _len) writeOut(_len - partial);
+}
+
+void LogWriter::service() {
+    if (millis() - _lastFlush < LOG_FLUSH_INTERVAL_MS) return;
+    _lastFlush = millis();
+    writeSectors();
+    if (_out != NULL) _out->flush(); // Directory entry, so the data survives a power cut
+}
+
+void LogWriter::flush() {
+    writeOut(_len);
+    if (_out != NULL) _out->flush();
+    _lastFlush = millis();
+}
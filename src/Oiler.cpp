@@ -1,16 +1,62 @@
 #include "Oiler.h"
 #include "WebConsole.h"
-#include <Preferences.h>
+#include "ViscosityTable.h"
+#include "LedPatterns.h"
+#include "RtcShadow.h"
+#include "BootTimeline.h"
+#include "Persistence.h"
 #include <OneWire.h>
 #include <DallasTemperature.h>
 
-Preferences preferences;
+PersistStore preferences; // "oiler" namespace, written back by the persistence service
+
+// Settings record layout. Version 1 replaced the single keys of older firmware.
+static const uint16_t OILER_CONFIG_VERSION = 1;
+
+const ConfigField Oiler::CONFIG_FIELDS[] = {
+    CONFIG_FIELD(Oiler::ConfigData, rangeKm[0], "r0_km", T_BLOB, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rangeKm[1], "r1_km", T_BLOB, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rangeKm[2], "r2_km", T_BLOB, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rangeKm[3], "r3_km", T_BLOB, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rangeKm[4], "r4_km", T_BLOB, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rangePulses[0], "r0_p", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rangePulses[1], "r1_p", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rangePulses[2], "r2_p", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rangePulses[3], "r3_p", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rangePulses[4], "r4_p", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, tcPulse, "tc_pulse", T_BLOB, 1),
+    CONFIG_FIELD(Oiler::ConfigData, tcPause, "tc_pause", T_BLOB, 1),
+    CONFIG_FIELD(Oiler::ConfigData, tcOil, "tc_oil", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, ledDim, "led_dim", T_U8, 1),
+    CONFIG_FIELD(Oiler::ConfigData, ledHigh, "led_high", T_U8, 1),
+    CONFIG_FIELD(Oiler::ConfigData, nightEnabled, "night_en", T_U8, 1),
+    CONFIG_FIELD(Oiler::ConfigData, nightBri, "night_bri", T_U8, 1),
+    CONFIG_FIELD(Oiler::ConfigData, nightBriHigh, "night_bri_h", T_U8, 1),
+    CONFIG_FIELD(Oiler::ConfigData, rainMode, "rain_mode", T_U8, 1),
+    CONFIG_FIELD(Oiler::ConfigData, emergencyMode, "emerg_mode", T_U8, 1),
+    CONFIG_FIELD(Oiler::ConfigData, emergencyForced, "emerg_force", T_U8, 1),
+    CONFIG_FIELD(Oiler::ConfigData, nightStart, "night_start", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, nightEnd, "night_end", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, offroadIntervalMin, "off_int", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, startupDelayMeters, "start_dly_m", T_BLOB, 1),
+    CONFIG_FIELD(Oiler::ConfigData, flushEvents, "tb_evt", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, flushPulses, "tb_pls", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, flushIntervalSec, "tb_int", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, tankEnabled, "tank_en", T_U8, 1),
+    CONFIG_FIELD(Oiler::ConfigData, tankCapacityMl, "tank_cap", T_BLOB, 1),
+    CONFIG_FIELD(Oiler::ConfigData, dropsPerMl, "drop_ml", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, dropsPerPulse, "drop_pls", T_I32, 1),
+    CONFIG_FIELD(Oiler::ConfigData, tankWarnPercent, "tank_warn", T_I32, 1),
+};
+const int Oiler::CONFIG_FIELD_COUNT = sizeof(Oiler::CONFIG_FIELDS) / sizeof(Oiler::CONFIG_FIELDS[0]);
+static_assert(NUM_RANGES == 5, "CONFIG_FIELDS lists the legacy range keys r0..r4");
 
 // Setup OneWire and DallasTemperature
 OneWire oneWire(TEMP_SENSOR_PIN);
 DallasTemperature sensors(&oneWire);
 
-Oiler::Oiler() : strip(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800) {
+Oiler::Oiler() : leds(LED_PIN, (rmt_channel_t)LED_RMT_CHANNEL),
+                 configRecord(OILER_CONFIG_VERSION, CONFIG_FIELDS, CONFIG_FIELD_COUNT) {
     pumpPin = PUMP_PIN;
     // Pin initialization moved to begin() to avoid issues during global constructor execution
     
@@ -125,7 +171,7 @@ Oiler::Oiler() : strip(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800) {
     currentHour = 12;    // Default noon
 
     // Tank Monitor Defaults
-    tankMonitorEnabled = false;
+    tankMonitorEnabled = true;
     tankCapacityMl = 100.0;
     currentTankLevelMl = 100.0;
     dropsPerMl = 50; // Calibrated: 6200 drops / 125ml = 49.6
@@ -162,44 +208,43 @@ void Oiler::begin() {
         ledcSetup(PUMP_PWM_CHANNEL, PUMP_PWM_FREQ, PUMP_PWM_RESOLUTION);
         ledcAttachPin(pumpPin, PUMP_PWM_CHANNEL);
     }
+    pump.begin(pumpPin);
+    bootTimeline.mark("pump");
 
-    // Initialize Temp Sensor
+    // Initialize Temp Sensor (non-blocking conversions, see serviceTemperature)
     sensors.begin();
+    sensors.setResolution(TEMP_RESOLUTION_BITS);
+    sensors.setWaitForConversion(false);
+    tempAddressValid = sensors.getAddress(tempAddress, 0);
+    tempConversionTimeoutMs = sensors.millisToWaitForConversion(TEMP_RESOLUTION_BITS) + 50;
+    bootTimeline.mark("temp");
 
-    // Initialize IMU
-    imu.begin(IMU_SDA, IMU_SCL);
+    // IMU: probed in an init task (main.cpp startInitTasks), see ImuHandler::probe()
 
     ledOilingEndTimestamp = 0;
 
-    preferences.begin("oiler", false);
+    preferences.begin("oiler");
+    if (!journal.begin()) Serial.println("No journal partition, progress is saved to NVS");
+    bootTimeline.mark("journal");
     loadConfig();
+    bootTimeline.mark("config");
 
     // Hardware Init
     pinMode(BUTTON_PIN, INPUT_PULLUP);
     pinMode(BOOT_BUTTON_PIN, INPUT_PULLUP); // Init onboard button
-    strip.begin();
-    strip.setBrightness(ledBrightnessDim);
-    strip.show(); // All pixels off
+    leds.begin(); // All pixels off
 }
 
 void Oiler::performFactoryReset() {
     Serial.println("PERFORMING FACTORY RESET...");
     webConsole.log("PERFORMING FACTORY RESET...");
     
-    // Ensure any previous session is closed
-    preferences.end();
-
-    // Clear Oiler Preferences
-    preferences.begin("oiler", false);
-    preferences.clear(); // Nuke everything
-    preferences.end();
-    
-    delay(100);
-
-    // Clear Aux Preferences
-    preferences.begin("aux", false);
-    preferences.clear();
-    preferences.end();
+    // Clear Oiler and Aux settings and the progress journal (pending changes are dropped)
+    persistence.clear("oiler"); // Nuke everything
+    persistence.clear("aux");
+    journal.erase();
+    RtcShadow::invalidate();
+    persistence.flush(); // IMU calibration
 
     Serial.println("Done. Restarting...");
     delay(500); // Give time to send response if called from Web
@@ -207,15 +252,21 @@ void Oiler::performFactoryReset() {
 }
 
 void Oiler::loop() {
+    serviceControl();
+    servicePump();
+    serviceLED();
+}
+
+uint32_t Oiler::serviceControl() {
     imu.loop(); // Update IMU data
     
     // Check for Crash (Latch)
-    if (imu.isCrashed()) {
+    if (imu.isCrashed() && !crashTripped) {
         crashTripped = true;
+        setLedBit(LED_ST_CRASH, true);
     }
 
     handleButton();
-    processPump(); // Unified pump logic
     
     // Offroad Mode Logic (Time Based)
     if (offroadMode) {
@@ -252,21 +303,29 @@ void Oiler::loop() {
         }
     }
     
-    // Temperature Update (Periodic)
-    if (millis() - lastTempUpdate > TEMP_UPDATE_INTERVAL_MS) {
-        updateTemperature();
-        lastTempUpdate = millis();
-    }
+    // Temperature Update (Periodic, conversion runs in the background)
+    serviceTemperature();
 
     // Rain Mode Auto-Off
     if (rainMode && (millis() - rainModeStartTime > RAIN_MODE_AUTO_OFF_MS)) {
         rainMode = false;
+        setLedBit(LED_ST_RAIN, false);
         webConsole.log("Rain Mode Auto-Off");
         Serial.println("Rain Mode Auto-Off");
         saveConfig();
     }
 
+    return SCHED_CONTROL_INTERVAL_MS * 1000UL;
+}
+
+uint32_t Oiler::servicePump() {
+    processPump(); // Unified pump logic
+    return getPumpDueUs();
+}
+
+uint32_t Oiler::serviceLED() {
     updateLED();
+    return LED_FRAME_MS * 1000UL;
 }
 
 bool Oiler::checkWifiToggleRequest() {
@@ -364,10 +423,60 @@ void Oiler::setCurrentHour(int hour) {
     currentHour = hour;
 }
 
+// Status bits for the LED pattern table. The setters and update() keep them current,
+// the full rebuild is only needed after loading the config.
+void Oiler::refreshLedStatus() {
+    ledStatus = LED_STATUS(LED_ST_IDLE);
+    setLedBit(LED_ST_UPDATE, updateMode);
+    setLedBit(LED_ST_CRASH, crashTripped);
+    setLedBit(LED_ST_BLEEDING, bleedingMode);
+    setLedBit(LED_ST_FLUSH, flushMode);
+    setLedBit(LED_ST_OFFROAD, offroadMode);
+    setLedBit(LED_ST_WIFI, wifiActive);
+    setLedBit(LED_ST_RAIN, rainMode);
+    updateOilingLed();
+    updateTankLed();
+    updateFixLed();
+}
+
+void Oiler::setLedBit(uint8_t bit, bool on) {
+    if (on) ledStatus |= LED_STATUS(bit);
+    else ledStatus &= ~LED_STATUS(bit);
+}
+
+// Oiling run or its LED follow-up (the rest runs out in updateLED)
+void Oiler::updateOilingLed() {
+    setLedBit(LED_ST_OILING, isOiling || (long)(millis() - ledOilingEndTimestamp) < 0);
+}
+
+void Oiler::updateTankLed() {
+    // level / capacity < warn %, without the divide
+    setLedBit(LED_ST_TANK_LOW, tankMonitorEnabled && currentTankLevelMl * 100.0f < tankCapacityMl * tankWarningThresholdPercent);
+}
+
+void Oiler::updateFixLed() {
+    bool emergency = emergencyModeForced || emergencyMode;
+    setLedBit(LED_ST_NOFIX, !hasFix);
+    setLedBit(LED_ST_NOFIX_EMERG, !hasFix && emergency);
+    setLedBit(LED_ST_EMERGENCY, emergency);
+}
+
 void Oiler::updateLED() {
-    // LED Update
-    uint32_t color = 0;
+    // LED Update (frame rate capped, loop() may call faster)
     unsigned long now = millis();
+    if (lastLedUpdate != 0 && now - lastLedUpdate < LED_FRAME_MS) return;
+    lastLedUpdate = now;
+
+    // Time limited status bits run out here (stored deadlines, nothing else to check)
+    if ((ledStatus & LED_STATUS(LED_ST_WIFI_NEW)) && (long)(now - ledWifiNewEndTime) >= 0) {
+        setLedBit(LED_ST_WIFI_NEW, false);
+    }
+    if ((ledStatus & LED_STATUS(LED_ST_OILING)) && !isOiling && (long)(now - ledOilingEndTimestamp) >= 0) {
+        setLedBit(LED_ST_OILING, false);
+    }
+
+    uint32_t color = 0;
+    uint8_t bri = 0; // Brightness of the status LED
 
     // Determine Brightness
     uint8_t currentDimBrightness = ledBrightnessDim;
@@ -389,249 +498,132 @@ void Oiler::updateLED() {
         }
     }
 
-    // Helper for sine wave pulse (0.0 to 1.0)
-    auto getPulse = [&](int periodMs) -> float {
-        float angle = (now % periodMs) * 2.0 * PI / periodMs;
-        return (sin(angle) + 1.0) / 2.0;
-    };
-
-    // 0. Update Mode (Critical) -> CYAN Fast Blink
-    if (updateMode) {
-        strip.setBrightness(currentHighBrightness);
-        if ((now / LED_BLINK_FAST) % 2 == 0) {
-            color = strip.Color(0, 255, 255); // Cyan
-        } else {
-            color = 0; // Off
-        }
-    }
-    // 0.1 Crash Detected (Latch) -> RED/WHITE Fast Alternating
-    else if (crashTripped) {
-        strip.setBrightness(currentHighBrightness);
-        if ((now / 100) % 2 == 0) {
-            color = strip.Color(255, 0, 0); // Red
-        } else {
-            color = strip.Color(255, 255, 255); // White
-        }
-    }
-    // 1. Bleeding Mode (Highest Priority) -> RED Blinking fast
-    else if (bleedingMode) {
-        strip.setBrightness(currentHighBrightness);
-        if ((now / LED_BLINK_FAST) % 2 == 0) {
-            color = strip.Color(255, 0, 0);
-        } else {
-            color = 0; // Off
-        }
-    } 
-    // 1.5 Chain Flush Mode (High Priority) -> CYAN Blinking
-    else if (flushMode) {
-        strip.setBrightness(currentHighBrightness);
-        if ((now / LED_PERIOD_FLUSH) % 2 == 0) {
-            color = strip.Color(0, 255, 255); // Cyan
-        } else {
-            color = 0; // Off
-        }
-    }
-    // 1.6 Offroad Mode -> MAGENTA Blinking
-    else if (offroadMode) {
-        strip.setBrightness(currentHighBrightness);
-        if ((now / 1000) % 2 == 0) { // Slow blink (1s on, 1s off)
-            color = strip.Color(255, 0, 255); // Magenta
-        } else {
-            color = 0; // Off
-        }
-    }
-    // 2. WiFi Active (High Priority Indication) -> WHITE Pulsing
-    else if (wifiActive && (now - wifiActivationTime < LED_WIFI_SHOW_DURATION)) {
-        float pulse = getPulse(LED_PERIOD_WIFI) * 0.8 + 0.2;
-        uint8_t bri = (uint8_t)(pulse * currentHighBrightness);
-        if (bri < 5) bri = 5;
-        strip.setBrightness(bri);
-        color = strip.Color(255, 255, 255);
-    }
-    // 3. Oiling Event -> YELLOW Breathing
-    else if (isOiling || millis() < ledOilingEndTimestamp) {
-        float breath = getPulse(LED_PERIOD_OILING); 
-        uint8_t bri = (uint8_t)(breath * currentHighBrightness);
-        if (bri < 5) bri = 5;
-        strip.setBrightness(bri);
-        color = strip.Color(255, 200, 0);
-    } else if (wifiActive) {
-        // WiFi Active: White pulsing
-        // Use sine wave for smooth pulsing
-        float pulse = (sin(now / 500.0) + 1.0) / 2.0; // 0.0 to 1.0
-        uint8_t brightness = (uint8_t)(pulse * currentHighBrightness);
-        if (brightness < 10) brightness = 10; // Minimum brightness
-        
-        strip.setBrightness(brightness);
-        color = strip.Color(255, 255, 255); // White
-    } 
-    // 4. Tank Warning -> ORANGE Blinking (2x fast)
-    else if (tankMonitorEnabled && (currentTankLevelMl / tankCapacityMl * 100.0) < tankWarningThresholdPercent) {
-        strip.setBrightness(currentHighBrightness);
-        int phase = now % LED_BLINK_TANK; // 2s cycle
-        // Blink 1: 0-200, Blink 2: 400-600
-        if ((phase >= 0 && phase < 200) || (phase >= 400 && phase < 600)) {
-            color = strip.Color(255, 69, 0); // OrangeRed
-        } else {
-            color = 0; // Off
-        }
-    }
-    else if (!hasFix) {
-        // No GPS
-        unsigned long timeSinceLoss = (lastEmergUpdate > 0) ? (now - lastEmergUpdate) : 0;
-        
-        if (emergencyModeForced) {
-             // Forced Emergency: Cyan
-             strip.setBrightness(currentDimBrightness);
-             color = strip.Color(0, 255, 255); 
-        } else if (emergencyMode) {
-             // Auto Emergency Active: Cyan Dim
-             strip.setBrightness(currentDimBrightness);
-             color = strip.Color(0, 255, 255);
-        } else {
-            color = 0; // Off
-        }
-    }
-    // 5. Emergency Mode (Forced or Auto) -> ORANGE Double Pulse over GREEN
-    else if (emergencyModeForced || emergencyMode || (!hasFix && (lastEmergUpdate > 0 && (now - lastEmergUpdate) > EMERGENCY_TIMEOUT_MS))) {
-         int phase = now % LED_PERIOD_EMERGENCY; // 1.5s Cycle
-         // Pulse 1: 0-100, Pulse 2: 200-300
-         if ((phase >= 0 && phase < 100) || (phase >= 200 && phase < 300)) {
-             strip.setBrightness(currentHighBrightness);
-             color = strip.Color(255, 140, 0); // Orange
-         } else {
-             strip.setBrightness(currentDimBrightness);
-             color = strip.Color(0, 255, 0); // Green
-         }
-    }
-    // 6. Rain Mode -> BLUE Static
-    else if (rainMode) {
-        strip.setBrightness(currentDimBrightness);
-        color = strip.Color(0, 0, 255);
-    }
-    // 7. No GPS (Searching) -> MAGENTA Pulsing
-    else if (!hasFix) {
-        float pulse = getPulse(LED_PERIOD_GPS);
-        uint8_t bri = (uint8_t)(pulse * currentDimBrightness);
-        if (bri < 5) bri = 5;
-        strip.setBrightness(bri);
-        color = strip.Color(255, 0, 255);
-    }
-    // 8. Idle / Ready -> GREEN Static
-    else {
-        strip.setBrightness(currentDimBrightness);
-        color = strip.Color(0, 255, 0);
-    }
-
-    for(int i=0; i<NUM_LEDS; i++) {
-        // LED 0: Main Status LED (Logic above)
-        if (i == 0) {
-            strip.setPixelColor(i, color);
-        } 
-        // LED 1: Aux Status LED (Heated Grips / Aux Power)
-        else if (i == 1) {
-            uint32_t auxColor = 0;
-            
-            if (auxMode == 0 || auxPwm == 0) {
-                auxColor = 0; // OFF
-            } else if (auxMode == 1) {
-                // Aux Power Active -> Green Static
-                strip.setBrightness(currentDimBrightness);
-                auxColor = strip.Color(0, 255, 0);
-            } else if (auxMode == 2) {
-                // Heated Grips -> Gradient Blue to Red
-                strip.setBrightness(currentDimBrightness); // Use dim brightness for constant light
-                
-                if (auxBoost) {
-                    // Startup Boost -> Color Cycle (Blue -> Yellow -> Orange -> Red)
-                    // Simulates "Heating Up"
-                    strip.setBrightness(currentHighBrightness);
-                    int phase = (now / 500) % 4; 
-                    switch(phase) {
-                        case 0: auxColor = strip.Color(0, 0, 255); break;   // Blue
-                        case 1: auxColor = strip.Color(255, 255, 0); break; // Yellow
-                        case 2: auxColor = strip.Color(255, 140, 0); break; // Orange
-                        case 3: auxColor = strip.Color(255, 0, 0); break;   // Red
-                    }
-                } else if (auxPwm < 30) {
-                    auxColor = strip.Color(0, 0, 255); // Blue (Low)
-                } else if (auxPwm < 60) {
-                    auxColor = strip.Color(255, 255, 0); // Yellow (Med-Low)
-                } else if (auxPwm < 80) {
-                    auxColor = strip.Color(255, 140, 0); // Orange (Med-High)
-                } else {
-                    auxColor = strip.Color(255, 0, 0); // Red (High)
-                }
+    // Status LED: highest priority status bit -> pattern table (see LedPatterns.cpp)
+    LedPatterns::render(ledStatus, now, currentDimBrightness, currentHighBrightness, color, bri);
+
+    // LED 0: Main Status LED
+    leds.setPixel(0, color, bri);
+
+    // LED 1: Aux Status LED (Heated Grips / Aux Power)
+    uint32_t auxColor = 0;
+    uint8_t auxBri = currentDimBrightness; // Use dim brightness for constant light
+    if (auxMode == 0 || auxPwm == 0) {
+        auxColor = 0; // OFF
+    } else if (auxMode == 1) {
+        // Aux Power Active -> Green Static
+        auxColor = LedRenderer::Color(0, 255, 0);
+    } else if (auxMode == 2) {
+        // Heated Grips -> Gradient Blue to Red
+        if (auxBoost) {
+            // Startup Boost -> Color Cycle (Blue -> Yellow -> Orange -> Red)
+            // Simulates "Heating Up"
+            auxBri = currentHighBrightness;
+            int phase = (now / 500) % 4; 
+            switch(phase) {
+                case 0: auxColor = LedRenderer::Color(0, 0, 255); break;   // Blue
+                case 1: auxColor = LedRenderer::Color(255, 255, 0); break; // Yellow
+                case 2: auxColor = LedRenderer::Color(255, 140, 0); break; // Orange
+                case 3: auxColor = LedRenderer::Color(255, 0, 0); break;   // Red
             }
-            strip.setPixelColor(i, auxColor);
+        } else if (auxPwm < 30) {
+            auxColor = LedRenderer::Color(0, 0, 255); // Blue (Low)
+        } else if (auxPwm < 60) {
+            auxColor = LedRenderer::Color(255, 255, 0); // Yellow (Med-Low)
+        } else if (auxPwm < 80) {
+            auxColor = LedRenderer::Color(255, 140, 0); // Orange (Med-High)
+        } else {
+            auxColor = LedRenderer::Color(255, 0, 0); // Red (High)
         }
     }
-    strip.show();
+    if (NUM_LEDS > 1) leds.setPixel(1, auxColor, auxBri);
+
+    leds.show(); // Only sent if a byte changed
 }
 
-void Oiler::loadConfig() {
-    // Load configuration from Flash (NVS)
-    // If nothing is saved yet, default values remain
+void Oiler::fillConfigRecord() {
+    ConfigData& cfg = configRecord.data();
     for(int i=0; i<NUM_RANGES; i++) {
-        String keyBase = "r" + String(i);
-        ranges[i].intervalKm = preferences.getFloat((keyBase + "_km").c_str(), ranges[i].intervalKm);
-        ranges[i].pulses = preferences.getInt((keyBase + "_p").c_str(), ranges[i].pulses);
-    }
-
-    // Load Temperature Compensation Settings (New Simplified Model)
-    tempConfig.basePulse25 = preferences.getFloat("tc_pulse", (float)PULSE_DURATION_MS);
-    tempConfig.basePause25 = preferences.getFloat("tc_pause", (float)PAUSE_DURATION_MS);
-    tempConfig.oilType = (OilType)preferences.getInt("tc_oil", (int)OIL_NORMAL);
-
-    currentProgress = preferences.getFloat("progress", 0.0);
-    ledBrightnessDim = preferences.getUChar("led_dim", LED_BRIGHTNESS_DIM);
-    ledBrightnessHigh = preferences.getUChar("led_high", LED_BRIGHTNESS_HIGH);
-    
-    nightModeEnabled = preferences.getBool("night_en", true);
-    nightStartHour = preferences.getInt("night_start", 20);
-    nightEndHour = preferences.getInt("night_end", 6);
-    nightBrightness = preferences.getUChar("night_bri", 13);
-    nightBrightnessHigh = preferences.getUChar("night_bri_h", 64);
-    
-    // Restore Rain Mode
-    rainMode = preferences.getBool("rain_mode", false); 
-    
-    emergencyMode = preferences.getBool("emerg_mode", false);
+        cfg.rangeKm[i] = ranges[i].intervalKm;
+        cfg.rangePulses[i] = ranges[i].pulses;
+    }
+    cfg.tcPulse = tempConfig.basePulse25;
+    cfg.tcPause = tempConfig.basePause25;
+    cfg.tcOil = (int32_t)tempConfig.oilType;
+    cfg.ledDim = ledBrightnessDim;
+    cfg.ledHigh = ledBrightnessHigh;
+    cfg.nightEnabled = nightModeEnabled;
+    cfg.nightStart = nightStartHour;
+    cfg.nightEnd = nightEndHour;
+    cfg.nightBri = nightBrightness;
+    cfg.nightBriHigh = nightBrightnessHigh;
+    cfg.rainMode = rainMode;
+    cfg.emergencyMode = emergencyMode;
+    cfg.emergencyForced = emergencyModeForced;
+    cfg.offroadIntervalMin = offroadIntervalMin;
+    cfg.startupDelayMeters = startupDelayMeters;
+    cfg.flushEvents = flushConfigEvents;
+    cfg.flushPulses = flushConfigPulses;
+    cfg.flushIntervalSec = flushConfigIntervalSec;
+    cfg.tankEnabled = tankMonitorEnabled;
+    cfg.tankCapacityMl = tankCapacityMl;
+    cfg.dropsPerMl = dropsPerMl;
+    cfg.dropsPerPulse = dropsPerPulse;
+    cfg.tankWarnPercent = tankWarningThresholdPercent;
+}
 
-    // Load Offroad & Startup
-    offroadIntervalMin = preferences.getInt("off_int", OFFROAD_INTERVAL_MIN_DEFAULT);
-    startupDelayMeters = preferences.getFloat("start_dly_m", STARTUP_DELAY_METERS_DEFAULT);
+void Oiler::applyConfigRecord() {
+    const ConfigData& cfg = configRecord.data();
+    for(int i=0; i<NUM_RANGES; i++) {
+        ranges[i].intervalKm = cfg.rangeKm[i];
+        ranges[i].pulses = cfg.rangePulses[i];
+    }
+    tempConfig.basePulse25 = cfg.tcPulse;
+    tempConfig.basePause25 = cfg.tcPause;
+    tempConfig.oilType = (OilType)cfg.tcOil;
+    ledBrightnessDim = cfg.ledDim;
+    ledBrightnessHigh = cfg.ledHigh;
+    nightModeEnabled = cfg.nightEnabled != 0;
+    nightStartHour = cfg.nightStart;
+    nightEndHour = cfg.nightEnd;
+    nightBrightness = cfg.nightBri;
+    nightBrightnessHigh = cfg.nightBriHigh;
+    rainMode = cfg.rainMode != 0;
+    emergencyMode = cfg.emergencyMode != 0;
+    // SAFETY: Previously we forced this OFF. Now we allow persistence for long trips with broken GPS.
+    emergencyModeForced = cfg.emergencyForced != 0;
+    offroadIntervalMin = cfg.offroadIntervalMin;
+    startupDelayMeters = cfg.startupDelayMeters;
+    flushConfigEvents = cfg.flushEvents;
+    flushConfigPulses = cfg.flushPulses;
+    flushConfigIntervalSec = cfg.flushIntervalSec;
+    tankMonitorEnabled = cfg.tankEnabled != 0;
+    tankCapacityMl = cfg.tankCapacityMl;
+    dropsPerMl = cfg.dropsPerMl;
+    dropsPerPulse = cfg.dropsPerPulse;
+    tankWarningThresholdPercent = cfg.tankWarnPercent;
+}
 
-    // Load Chain Flush Mode
-    flushConfigEvents = preferences.getInt("tb_evt", FLUSH_DEFAULT_EVENTS);
-    flushConfigPulses = preferences.getInt("tb_pls", FLUSH_DEFAULT_PULSES);
-    flushConfigIntervalSec = preferences.getInt("tb_int", FLUSH_DEFAULT_INTERVAL_SEC);
+void Oiler::loadConfig() {
+    // Load configuration from Flash (NVS): one record read + CRC check.
+    // The constructor defaults stay for anything not saved yet.
+    fillConfigRecord();
+    ConfigLoadResult result = configRecord.load(preferences);
+    applyConfigRecord();
+    if (result != CONFIG_LOADED) {
+        // First boot after an update (or ever): store the record, next boot is a single read
+        Serial.printf("Config record %s\n", result == CONFIG_MIGRATED ? "migrated from single keys" :
+                      result == CONFIG_UPGRADED ? "upgraded" : "created");
+        configRecord.save(preferences);
+    }
 
-    // Load Stats
-    totalDistance = preferences.getDouble("totalDist", 0.0);
-    pumpCycles = preferences.getUInt("pumpCount", 0);
-    
     // Load Time Stats History
     size_t len = preferences.getBytesLength("statsHist");
     if (len == sizeof(StatsHistory)) {
         preferences.getBytes("statsHist", &history, sizeof(StatsHistory));
     }
-    // Load current interval time
-    for(int i=0; i<NUM_RANGES; i++) {
-        currentIntervalTime[i] = preferences.getDouble(("cit" + String(i)).c_str(), 0.0);
-    }
 
-    // Load Tank Monitor
-    tankMonitorEnabled = preferences.getBool("tank_en", true);
-    tankCapacityMl = preferences.getFloat("tank_cap", 100.0);
-    currentTankLevelMl = preferences.getFloat("tank_lvl", 100.0);
-    dropsPerMl = preferences.getInt("drop_ml", 50);
-    dropsPerPulse = preferences.getInt("drop_pls", 1);
-    tankWarningThresholdPercent = preferences.getInt("tank_warn", 10);
-
-    // Load Emergency Mode forced setting
-    // SAFETY: Previously we forced this OFF. Now we allow persistence for long trips with broken GPS.
-    emergencyModeForced = preferences.getBool("emerg_force", false); 
+    // Odometer, progress, interval times & tank level
+    loadLiveState();
 
     // If forced, activate immediately
     if (emergencyModeForced) {
@@ -641,6 +633,7 @@ void Oiler::loadConfig() {
 
     validateConfig();
     rebuildLUT(); // Re-calculate LUT after loading config
+    refreshLedStatus();
 }
 
 void Oiler::validateConfig() {
@@ -665,79 +658,86 @@ void Oiler::validateConfig() {
 }
 
 void Oiler::saveConfig() {
+    updateTankLed(); // Tank settings or fill level may have changed (web UI)
+
+    // All settings in one record (skipped by the persistence service if unchanged)
+    fillConfigRecord();
+    configRecord.save(preferences);
+
+    // Save Time Stats History
+    preferences.putBytes("statsHist", &history, sizeof(StatsHistory));
+    // Save Stats, current interval time & tank level
+    saveLiveState();
+    
+    rebuildLUT(); // Ensure LUT is up to date when saving (in case ranges changed)
+}
+
+void Oiler::getLiveState(ProgressJournal::Record& r) {
+    memset(&r, 0, sizeof(r));
+    r.pumpCycles = pumpCycles;
+    r.totalDistance = totalDistance;
+    for(int i=0; i<NUM_RANGES; i++) {
+        r.currentIntervalTime[i] = currentIntervalTime[i];
+    }
+    r.progress = currentProgress;
+    r.tankLevelMl = currentTankLevelMl;
+}
+
+void Oiler::loadLiveState() {
+    ProgressJournal::Record r;
+    if (RtcShadow::restore(r)) {
+        // Warm restart (watchdog, /restart, OTA): the RTC copy is newer than any checkpoint
+        Serial.println("Live state restored from RTC memory");
+        progressChanged = true; // Goes to flash on the normal save schedule
+    } else if (!journal.load(r)) {
+        // No checkpoint yet (or no partition): the NVS keys of older firmware / the fallback
+        currentProgress = preferences.getFloat("progress", 0.0);
+        totalDistance = preferences.getDouble("totalDist", 0.0);
+        pumpCycles = preferences.getUInt("pumpCount", 0);
+        for(int i=0; i<NUM_RANGES; i++) {
+            currentIntervalTime[i] = preferences.getDouble(("cit" + String(i)).c_str(), 0.0);
+        }
+        currentTankLevelMl = preferences.getFloat("tank_lvl", 100.0);
+        return;
+    }
+    currentProgress = r.progress;
+    totalDistance = r.totalDistance;
+    pumpCycles = r.pumpCycles;
     for(int i=0; i<NUM_RANGES; i++) {
-        String keyBase = "r" + String(i);
-        preferences.putFloat((keyBase + "_km").c_str(), ranges[i].intervalKm);
-        preferences.putInt((keyBase + "_p").c_str(), ranges[i].pulses);
+        currentIntervalTime[i] = r.currentIntervalTime[i];
     }
+    currentTankLevelMl = r.tankLevelMl;
+}
 
-    // Save Temperature Compensation Settings
-    preferences.putFloat("tc_pulse", tempConfig.basePulse25);
-    preferences.putFloat("tc_pause", tempConfig.basePause25);
-    preferences.putInt("tc_oil", (int)tempConfig.oilType);
+void Oiler::saveLiveState() {
+    ProgressJournal::Record r;
+    getLiveState(r);
+    RtcShadow::save(r);
 
-    preferences.putUChar("led_dim", ledBrightnessDim);
-    preferences.putUChar("led_high", ledBrightnessHigh);
-    
-    preferences.putBool("night_en", nightModeEnabled);
-    preferences.putInt("night_start", nightStartHour);
-    preferences.putInt("night_end", nightEndHour);
-    preferences.putUChar("night_bri", nightBrightness);
-    preferences.putUChar("night_bri_h", nightBrightnessHigh);
-    
-    // Save Rain Mode
-    preferences.putBool("rain_mode", rainMode);
-    preferences.putBool("emerg_mode", emergencyMode);
-    preferences.putBool("emerg_force", emergencyModeForced);
-
-    // Save Offroad & Startup
-    preferences.putInt("off_int", offroadIntervalMin);
-    preferences.putFloat("start_dly_m", startupDelayMeters);
-
-    // Save Chain Flush Mode
-    preferences.putInt("tb_evt", flushConfigEvents);
-    preferences.putInt("tb_pls", flushConfigPulses);
-    preferences.putInt("tb_int", flushConfigIntervalSec);
-
-    // Save Tank Monitor
-    preferences.putBool("tank_en", tankMonitorEnabled);
-    preferences.putFloat("tank_cap", tankCapacityMl);
-    preferences.putFloat("tank_lvl", currentTankLevelMl);
-    preferences.putInt("drop_ml", dropsPerMl);
-    preferences.putInt("drop_pls", dropsPerPulse);
-    preferences.putInt("tank_warn", tankWarningThresholdPercent);
+    if (journal.isAvailable()) {
+        // One small sequential write instead of 9 NVS keys
+        if (journal.append(r)) return;
+        Serial.println("[ERROR] Journal write failed, saving to NVS");
+    }
 
-    // Save Stats
+    preferences.putFloat("progress", currentProgress);
     preferences.putDouble("totalDist", totalDistance);
     preferences.putUInt("pumpCount", pumpCycles);
-    
-    // Save Time Stats History
-    preferences.putBytes("statsHist", &history, sizeof(StatsHistory));
-    // Save current interval time
     for(int i=0; i<NUM_RANGES; i++) {
         preferences.putDouble(("cit" + String(i)).c_str(), currentIntervalTime[i]);
     }
-    
-    rebuildLUT(); // Ensure LUT is up to date when saving (in case ranges changed)
+    preferences.putFloat("tank_lvl", currentTankLevelMl);
 }
 
 void Oiler::saveProgress() {
     if (progressChanged) {
-        preferences.putFloat("progress", currentProgress);
-        // Save Stats
-        preferences.putDouble("totalDist", totalDistance);
-        preferences.putUInt("pumpCount", pumpCycles);
-        
-        // Save Time Stats History
+        // Save Time Stats History (only written when an oiling added an entry)
         preferences.putBytes("statsHist", &history, sizeof(StatsHistory));
-        for(int i=0; i<NUM_RANGES; i++) {
-            preferences.putDouble(("cit" + String(i)).c_str(), currentIntervalTime[i]);
-        }
-        
-        // Save Tank Level
-        preferences.putFloat("tank_lvl", currentTankLevelMl);
+        // Save Progress, Stats & Tank Level
+        saveLiveState();
 
         progressChanged = false;
+        persistence.flush(); // Checkpoint: commit now, don't wait for the deferred commit
 #ifdef GPS_DEBUG
         webConsole.log("Stats Saved");
         Serial.println("Progress & Stats saved.");
@@ -788,6 +788,15 @@ int Oiler::calculateLocalHour(int utcHour, int day, int month, int year) {
 }
 
 void Oiler::update(float rawSpeedKmh, double lat, double lon, bool gpsValid) {
+    processUpdate(rawSpeedKmh, lat, lon, gpsValid);
+
+    // RTC copy of the live state, no flash wear
+    ProgressJournal::Record r;
+    getLiveState(r);
+    RtcShadow::save(r);
+}
+
+void Oiler::processUpdate(float rawSpeedKmh, double lat, double lon, bool gpsValid) {
     unsigned long now = millis();
 
     // Force GPS invalid if Emergency Mode is manually forced
@@ -834,8 +843,9 @@ void Oiler::update(float rawSpeedKmh, double lat, double lon, bool gpsValid) {
         }
     }
 
-    // Regular saving
-    if (now - lastSaveTime > SAVE_INTERVAL_MS) {
+    // Regular saving (the journal is cheap enough to checkpoint more often)
+    unsigned long saveInterval = journal.isAvailable() ? JOURNAL_SAVE_INTERVAL_MS : SAVE_INTERVAL_MS;
+    if (now - lastSaveTime > saveInterval) {
         saveProgress();
         lastSaveTime = now;
     }
@@ -847,6 +857,7 @@ void Oiler::update(float rawSpeedKmh, double lat, double lon, bool gpsValid) {
 
     if (!gpsValid) {
         hasFix = false;
+        updateFixLed();
 
         if (lastEmergUpdate == 0) {
             lastEmergUpdate = now;
@@ -871,6 +882,7 @@ void Oiler::update(float rawSpeedKmh, double lat, double lon, bool gpsValid) {
             if (!emergencyMode) {
                 // Just entered Emergency Mode
                 emergencyMode = true;
+                updateFixLed();
                 lastSimStep = now; // Initialize timer
                 
                 // Auto-Disable Rain Mode
@@ -911,6 +923,7 @@ void Oiler::update(float rawSpeedKmh, double lat, double lon, bool gpsValid) {
         } else {
             // Waiting for timeout...
             emergencyMode = false;
+            updateFixLed();
             lastSimStep = 0; // Reset sim timer
         }
         return;
@@ -924,12 +937,16 @@ void Oiler::update(float rawSpeedKmh, double lat, double lon, bool gpsValid) {
         lastEmergUpdate = 0;
         emergencyOilCount = 0;
         emergencyMode = false;
+        updateFixLed();
         return;
     }
 
     // Reset Emergency Timer if we have valid GPS
     lastEmergUpdate = 0;
-    emergencyMode = false; // Disable Emergency Mode automatically
+    if (emergencyMode) {
+        emergencyMode = false; // Disable Emergency Mode automatically
+        updateFixLed();
+    }
 
     // Calculate distance (Haversine or TinyGPS function)
     double distKm = TinyGPSPlus::distanceBetween(lastLat, lastLon, lat, lon) / 1000.0;
@@ -1092,6 +1109,7 @@ void Oiler::triggerOil(int pulses) {
         float mlConsumed = (float)(pulses * dropsPerPulse) / (float)dropsPerMl;
         currentTankLevelMl -= mlConsumed;
         if (currentTankLevelMl < 0) currentTankLevelMl = 0;
+        updateTankLed();
         
 #ifdef GPS_DEBUG
         Serial.printf("Oil consumed: %.2f ml, Remaining: %.2f ml\n", mlConsumed, currentTankLevelMl);
@@ -1104,9 +1122,13 @@ void Oiler::triggerOil(int pulses) {
     oilingPulsesRemaining = pulses;
     pulseState = false; // Will start with HIGH in handleOiling
     lastPulseTime = millis() - 1000; // Force immediate start
+    pulsePauseValid = false;
     
     // LED Indication
     ledOilingEndTimestamp = millis() + 3000;
+    setLedBit(LED_ST_OILING, true);
+
+    if (pumpWakeCallback) pumpWakeCallback(); // Start the first pulse now, not at the next idle poll
 }
 
 void Oiler::processPump() {
@@ -1114,27 +1136,31 @@ void Oiler::processPump() {
 
     // IMU Safety Cutoff (Latch)
     if (crashTripped) {
-        if (PUMP_USE_PWM) ledcWrite(PUMP_PWM_CHANNEL, 0);
-        digitalWrite(pumpPin, PUMP_OFF);
-        isOiling = false;
-        bleedingMode = false;
-        pumpState = PUMP_IDLE;
+        pump.stop();
+        if (isOiling || bleedingMode) {
+            isOiling = false;
+            bleedingMode = false;
+            setLedBit(LED_ST_BLEEDING, false);
+            updateOilingLed();
+        }
         return;
     }
 
-    // 1. Update State Machine
-    updatePumpPulse();
+    // 1. Pulse completed by the driver?
+    if (pump.takeFinished()) {
+        handlePulseFinished();
+    }
 
     // If pump is busy, we don't start a new pulse
-    if (pumpState != PUMP_IDLE) {
+    if (pump.isBusy()) {
         // Check Safety Cutoff (Pump stuck ON?)
         if ((now - pumpStateStartTime) > PUMP_SAFETY_CUTOFF_MS) {
              Serial.println("[CRITICAL] Safety Cutoff triggered! Pump stuck.");
-             digitalWrite(pumpPin, PUMP_OFF);
-             ledcWrite(PUMP_PWM_CHANNEL, 0);
-             pumpState = PUMP_IDLE;
+             pump.stop();
              isOiling = false;
              bleedingMode = false;
+             setLedBit(LED_ST_BLEEDING, false);
+             updateOilingLed();
         }
         return; 
     }
@@ -1143,6 +1169,7 @@ void Oiler::processPump() {
     if (bleedingMode) {
         if (now - bleedingStartTime > currentBleedingDuration) {
             bleedingMode = false;
+            setLedBit(LED_ST_BLEEDING, false);
             digitalWrite(pumpPin, PUMP_OFF);
 #ifdef GPS_DEBUG
             Serial.printf("Bleeding Finished. Consumed: %.2f ml\n", bleedingSessionConsumed);
@@ -1190,100 +1217,75 @@ void Oiler::processPump() {
     }
 }
 
+uint32_t Oiler::getPumpDueUs() {
+    const uint32_t idleUs = SCHED_PUMP_IDLE_MS * 1000UL;
+
+    // Pulse running: the driver's finish callback wakes us, poll only for the safety cutoff
+    if (crashTripped || pump.isBusy()) return idleUs;
+
+    // Idle between pulses: sleep until the pause is over
+    if (bleedingMode || isOiling) {
+        unsigned long effectivePause = bleedingMode ? 300 : dynamicPauseMs;
+        unsigned long elapsed = millis() - lastPulseTime;
+        if (elapsed < effectivePause) return (effectivePause - elapsed) * 1000UL;
+    }
+    return idleUs; // Nothing pending (or pulse delayed by lean angle): poll
+}
+
 void Oiler::startPulse(unsigned long durationMs) {
     pumpTargetDuration = durationMs;
     pumpStateStartTime = millis();
-    
-    if (PUMP_USE_PWM) {
-        pumpState = PUMP_RAMP_UP;
-        pumpCurrentDuty = 130; // Start at ~50% to prevent whining
-        pumpLastStepTime = micros();
-        ledcWrite(PUMP_PWM_CHANNEL, pumpCurrentDuty);
-    } else {
-        // Fallback: Hard Switching
-        digitalWrite(pumpPin, PUMP_ON);
-        pumpState = PUMP_HOLD;
+    pulsePauseRequestedMs = bleedingMode ? 300 : dynamicPauseMs;
+    int64_t prevEndUs = pump.getLastEndUs();
+    if (!pump.start(durationMs)) {
+        // Driver refused (no timer): skip this pulse and wait a full pause, never retry in a tight loop
+        Serial.println("[ERROR] Pump pulse could not be started!");
+        lastPulseTime = millis();
+        pulsePauseValid = false;
+        if (!bleedingMode) countOilingPulse(); // Nothing pumped, no consumption; just keep the run finite
+        return;
     }
+    pulsePauseActualUs = (uint32_t)(pump.getLastStartUs() - prevEndUs);
 }
 
-void Oiler::updatePumpPulse() {
-    if (pumpState == PUMP_IDLE) return;
-
-    unsigned long now = millis();
-    unsigned long nowMicros = micros();
-
-    if (!PUMP_USE_PWM) {
-        // Simple ON/OFF logic
-        if (now - pumpStateStartTime >= pumpTargetDuration) {
-            digitalWrite(pumpPin, PUMP_OFF);
-            pumpState = PUMP_IDLE;
-            handlePulseFinished(); 
-        }
-        return;
+void Oiler::countOilingPulse() {
+    oilingPulsesRemaining--;
+    if (oilingPulsesRemaining == 0) {
+        isOiling = false;
+        updateOilingLed();
+#ifdef GPS_DEBUG
+        Serial.println("OILING DONE");
+        webConsole.log("OILING DONE");
+#endif
     }
+}
 
-    // PWM Logic
-    switch (pumpState) {
-        case PUMP_RAMP_UP: {
-            unsigned long stepDelay = (PUMP_RAMP_UP_MS * 1000) / 255;
-            if (nowMicros - pumpLastStepTime >= (stepDelay * 15)) {
-                pumpCurrentDuty += 15;
-                if (pumpCurrentDuty >= 255) {
-                    pumpCurrentDuty = 255;
-                    pumpState = PUMP_HOLD;
-                    // Reset start time for HOLD phase to ensure accurate duration
-                    pumpStateStartTime = millis(); 
-                }
-                ledcWrite(PUMP_PWM_CHANNEL, pumpCurrentDuty);
-                pumpLastStepTime = nowMicros;
-            }
-            break;
-        }
-        case PUMP_HOLD: {
-            unsigned long holdTime = 0;
-            if (pumpTargetDuration > PUMP_RAMP_UP_MS) {
-                holdTime = pumpTargetDuration - PUMP_RAMP_UP_MS;
-            }
-            
-            if (now - pumpStateStartTime >= holdTime) {
-                pumpState = PUMP_RAMP_DOWN;
-                pumpCurrentDuty = 255;
-                pumpLastStepTime = micros();
-            }
-            break;
-        }
-        case PUMP_RAMP_DOWN: {
-            unsigned long stepDelay = (PUMP_RAMP_DOWN_MS * 1000) / 255;
-            if (nowMicros - pumpLastStepTime >= (stepDelay * 15)) {
-                pumpCurrentDuty -= 15;
-                if (pumpCurrentDuty <= 130) { // Stop at ~50% to prevent whining
-                    pumpCurrentDuty = 0;
-                    ledcWrite(PUMP_PWM_CHANNEL, 0);
-                    digitalWrite(pumpPin, PUMP_OFF);
-                    pumpState = PUMP_IDLE;
-                    handlePulseFinished();
-                } else {
-                    ledcWrite(PUMP_PWM_CHANNEL, pumpCurrentDuty);
-                }
-                pumpLastStepTime = nowMicros;
-            }
-            break;
-        }
-    }
+void Oiler::recordPulseStats() {
+    const uint32_t rampUpUs = PUMP_USE_PWM ? PUMP_RAMP_UP_MS * 1000UL : 0;
+    const uint32_t rampDownUs = PUMP_USE_PWM ? PUMP_RAMP_DOWN_MS * 1000UL : 0;
+    uint32_t pulseUs = pumpTargetDuration * 1000UL;
+
+    PulseStats::Sample s;
+    s.seq = 0;
+    s.requestedUs[PulseStats::RAMP_UP] = rampUpUs;
+    s.actualUs[PulseStats::RAMP_UP] = pump.getLastRampUpUs();
+    s.requestedUs[PulseStats::HOLD] = (pulseUs > rampUpUs) ? pulseUs - rampUpUs : 0;
+    s.actualUs[PulseStats::HOLD] = pump.getLastHoldUs();
+    s.requestedUs[PulseStats::RAMP_DOWN] = rampDownUs;
+    s.actualUs[PulseStats::RAMP_DOWN] = pump.getLastRampDownUs();
+    s.hasPause = pulsePauseValid;
+    s.requestedUs[PulseStats::PAUSE] = pulsePauseRequestedMs * 1000UL;
+    s.actualUs[PulseStats::PAUSE] = pulsePauseActualUs;
+    pulseStats.record(s);
 }
 
 void Oiler::handlePulseFinished() {
-    lastPulseTime = millis();
+    lastPulseTime = pump.getLastEndMs(); // Pause counts from the real end of the pulse
+    recordPulseStats();
+    pulsePauseValid = true; // The next pulse of this run measures its pause
     
     if (!bleedingMode) {
-        oilingPulsesRemaining--;
-        if (oilingPulsesRemaining == 0) {
-            isOiling = false;
-#ifdef GPS_DEBUG
-            Serial.println("OILING DONE");
-            webConsole.log("OILING DONE");
-#endif
-        }
+        countOilingPulse();
     } else {
         // Bleeding Mode: Count every pulse as stats & consumption
         pumpCycles++;
@@ -1294,6 +1296,7 @@ void Oiler::handlePulseFinished() {
             currentTankLevelMl -= mlConsumed;
             bleedingSessionConsumed += mlConsumed; // Track session total
             if (currentTankLevelMl < 0) currentTankLevelMl = 0;
+            updateTankLed();
         }
     }
 }
@@ -1308,6 +1311,7 @@ void Oiler::setEmergencyModeForced(bool forced) {
         emergencyMode = true;
         emergencyModeStartTime = millis();
     }
+    updateFixLed();
 }
 
 void Oiler::setRainMode(bool mode) {
@@ -1326,9 +1330,11 @@ void Oiler::setRainMode(bool mode) {
     }
     
     rainMode = mode;
+    setLedBit(LED_ST_RAIN, rainMode);
     // If Rain Mode is activated, disable forced Emergency Mode
     if (rainMode) {
         emergencyModeForced = false;
+        updateFixLed();
     }
     saveConfig();
 }
@@ -1347,6 +1353,7 @@ void Oiler::setFlushMode(bool mode) {
 #endif
     }
     flushMode = mode;
+    setLedBit(LED_ST_FLUSH, flushMode);
 }
 
 void Oiler::setOffroadMode(bool mode) {
@@ -1361,6 +1368,7 @@ void Oiler::setOffroadMode(bool mode) {
 #endif
     }
     offroadMode = mode;
+    setLedBit(LED_ST_OFFROAD, offroadMode);
 }
 
 void Oiler::startBleeding() {
@@ -1392,6 +1400,7 @@ void Oiler::startBleeding() {
         } else {
             // Start new bleeding session
             bleedingMode = true;
+            setLedBit(LED_ST_BLEEDING, true);
             bleedingStartTime = now;
             currentBleedingDuration = BLEEDING_DURATION_MS;
             bleedingSessionConsumed = 0.0; // Reset counter
@@ -1404,6 +1413,8 @@ void Oiler::startBleeding() {
             // Init Pump State for immediate start
             pulseState = false; 
             lastPulseTime = now - 1000; // Force start
+            pulsePauseValid = false;
+            if (pumpWakeCallback) pumpWakeCallback();
 
             saveConfig(); // Save immediately
         }
@@ -1484,19 +1495,49 @@ void Oiler::resetTankToFull() {
 void Oiler::setWifiActive(bool active) {
     if (active && !wifiActive) {
         wifiActivationTime = millis();
+        ledWifiNewEndTime = wifiActivationTime + LED_WIFI_SHOW_DURATION;
+        setLedBit(LED_ST_WIFI_NEW, true); // Cleared by updateLED at the deadline
     }
     wifiActive = active;
+    setLedBit(LED_ST_WIFI, wifiActive);
+    if (!wifiActive) setLedBit(LED_ST_WIFI_NEW, false);
 }
 
 void Oiler::setUpdateMode(bool mode) {
     updateMode = mode;
+    setLedBit(LED_ST_UPDATE, updateMode);
 }
 
-// --- NEW: Temperature Compensation Logic ---
-void Oiler::updateTemperature() {
-    sensors.requestTemperatures(); 
-    float tempC = sensors.getTempCByIndex(0);
+void Oiler::serviceTemperature() {
+    unsigned long now = millis();
+
+    if (!tempConverting) {
+        if (now - lastTempUpdate > TEMP_UPDATE_INTERVAL_MS) {
+            if (!tempAddressValid) tempAddressValid = sensors.getAddress(tempAddress, 0); // Sensor plugged in later?
+            sensors.requestTemperatures(); // Returns immediately, sensor converts on its own
+            tempRequestTime = now;
+            tempConverting = true;
+        }
+        return;
+    }
 
+    // Parasite powered sensors can't signal "done", the timeout covers them
+    unsigned long elapsed = now - tempRequestTime;
+    if (!sensors.isConversionComplete() && elapsed < tempConversionTimeoutMs) return;
+
+    tempConverting = false;
+    lastTempUpdate = now;
+    tempConversionMs = elapsed;
+    if (elapsed > tempConversionMaxMs) tempConversionMaxMs = elapsed;
+
+    float tempC = tempAddressValid ? sensors.getTempC(tempAddress) : DEVICE_DISCONNECTED_C;
+    if (tempC == DEVICE_DISCONNECTED_C) tempAddressValid = false;
+    updateTemperature(tempC);
+    if (pumpWakeCallback) pumpWakeCallback(); // Pause may have changed, re-plan the running one
+}
+
+// --- NEW: Temperature Compensation Logic ---
+void Oiler::updateTemperature(float tempC) {
     // Check for error (-127 is error)
     if (tempC == DEVICE_DISCONNECTED_C) {
         // Sensor Error: Fallback to 25°C defaults
@@ -1513,37 +1554,11 @@ void Oiler::updateTemperature() {
     lastTemp = tempC;
     currentTempC = tempC;
 
-    // 1. Calculate Viscosity using Arrhenius Equation
-    // Constants derived from ISO VG 85 Oil (84.2 mm²/s @ 40°C, 11.2 mm²/s @ 100°C)
-    // Formula: ln(v) = A + B/T
-    const float A = -8.122;
-    const float B = 3931.8;
-    
-    float tempK = currentTempC + 273.15;
-    float viscosityCurrent = exp(A + (B / tempK));
-    
-    // Reference Viscosity at 25°C
-    float tempRefK = 25.0 + 273.15;
-    float viscosityRef = exp(A + (B / tempRefK)); // ~158.4 mm²/s
-
-    // 2. Determine Compensation Aggressiveness based on Oil Type Setting
-    // The pump pulse doesn't need to scale 1:1 with viscosity.
-    // We use an exponent to tune how "hard" the system reacts to viscosity changes.
-    // Updated based on real-world calibration at 10°C: Pump is very efficient, needs less compensation.
-    float compensationExponent = 0.25; // Default Normal
-    
-    switch (tempConfig.oilType) {
-        case OIL_THIN:   compensationExponent = 0.15; break; // Gentle compensation (Was 0.3)
-        case OIL_NORMAL: compensationExponent = 0.25; break; // Normal compensation (Was 0.5)
-        case OIL_THICK:  compensationExponent = 0.35; break; // Aggressive compensation (Was 0.7)
-    }
-
-    // 3. Calculate Factor
-    // Ratio > 1.0 means oil is thicker than at 25°C
-    float viscosityRatio = viscosityCurrent / viscosityRef;
-    float factor = pow(viscosityRatio, compensationExponent);
+    // 1. Viscosity compensation factor (Arrhenius model per oil type, precomputed, see ViscosityTable.h)
+    // Factor > 1.0 means oil is thicker than at 25°C
+    float factor = ViscosityTable::getFactor((int)tempConfig.oilType, currentTempC);
 
-    // 4. Apply Factor
+    // 2. Apply Factor
     unsigned long newPulse = (unsigned long)(tempConfig.basePulse25 * factor);
     unsigned long newPause = (unsigned long)(tempConfig.basePause25 * factor);
 
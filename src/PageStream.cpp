@@ -0,0 +1,44 @@
+#include "PageStream.h"
+
+PageStream::PageStream(WebServer& server) : _server(server) {
+    _len = 0;
+    _bytes = 0;
+}
+
+void PageStream::begin(int code, const char* contentType) {
+    _len = 0;
+    _bytes = 0;
+    _server.setContentLength(CONTENT_LENGTH_UNKNOWN); // -> Transfer-Encoding: chunked
+    _server.send(code, contentType, "");
+}
+
+void PageStream::sendBuffer() {
+    if (_len == 0) return;
+    _server.sendContent(_buf, _len);
+    _len = 0;
+}
+
+size_t PageStream::write(uint8_t c) {
+    if (_len >= sizeof(_buf)) sendBuffer();
+    _buf[_len++] = c;
+    _bytes++;
+    return 1;
+}
+
+size_t PageStream::write(const uint8_t* buffer, size_t size) {
+    if (size >= sizeof(_buf) / 2) { // Page literal: one chunk straight from flash
+        sendBuffer();
+        _server.sendContent((const char*)buffer, size);
+    } else {
+        if (_len + size > sizeof(_buf)) sendBuffer();
+        memcpy(_buf + _len, buffer, size);
+        _len += size;
+    }
+    _bytes += size;
+    return size;
+}
+
+void PageStream::end() {
+    sendBuffer();
+    _server.sendContent(""); // Zero-length chunk ends the response
+}
@@ -0,0 +1,62 @@
+#include "PageTemplate.h"
+#include <string.h>
+
+PageTemplate::PageTemplate(const char* html, const char* const* keys, int keyCount) {
+    _html = html;
+    _keys = keys;
+    _keyCount = keyCount;
+    _parts = NULL;
+    _partCount = 0;
+}
+
+int PageTemplate::findKey(const char* name, size_t len) const {
+    for (int i = 0; i < _keyCount; i++) {
+        if (strlen(_keys[i]) == len && strncmp(_keys[i], name, len) == 0) return i;
+    }
+    return -1;
+}
+
+// Counts only with parts == NULL
+int PageTemplate::scan(Part* parts) const {
+    int n = 0;
+    uint32_t start = 0;
+    for (uint32_t i = 0; _html[i] != 0; i++) {
+        if (_html[i] != '%') continue;
+        uint32_t end = i + 1;
+        while ((_html[end] >= 'A' && _html[end] <= 'Z') || (_html[end] >= '0' && _html[end] <= '9') || _html[end] == '_') end++;
+        if (_html[end] != '%') continue;
+        int key = findKey(_html + i + 1, end - i - 1);
+        if (key < 0) continue; // "%3D%" in a URL etc.
+        if (parts) {
+            parts[n].offset = start;
+            parts[n].length = i - start;
+            parts[n].key = key;
+        }
+        n++;
+        start = end + 1;
+        i = end;
+    }
+    if (parts) {
+        parts[n].offset = start;
+        parts[n].length = strlen(_html + start);
+        parts[n].key = -1;
+    }
+    return n + 1;
+}
+
+bool PageTemplate::begin() {
+    if (_parts != NULL) return true;
+    int n = scan(NULL);
+    _parts = new Part[n];
+    if (_parts == NULL) return false;
+    _partCount = scan(_parts);
+    return true;
+}
+
+void PageTemplate::render(Print& out, Filler fill) const {
+    for (int i = 0; i < _partCount; i++) {
+        const Part& p = _parts[i];
+        if (p.length > 0) out.write((const uint8_t*)_html + p.offset, p.length);
+        if (p.key >= 0) fill(out, p.key);
+    }
+}
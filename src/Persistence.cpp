@@ -0,0 +1,243 @@
+#include "Persistence.h"
+#include "Crc32.h"
+#include <nvs.h>
+#include <string.h>
+
+Persistence persistence;
+
+static const uint32_t PERSIST_IDLE_POLL_US = 500000;
+
+Persistence::Persistence() {
+    _count = 0;
+    _dirty = false;
+    _dirtySince = 0;
+    _writes = 0;
+    _skipped = 0;
+    _commits = 0;
+}
+
+Persistence::Entry* Persistence::find(const char* ns, const char* key) {
+    for (int i = 0; i < _count; i++) {
+        Entry& e = _entries[i];
+        if (strcmp(e.key, key) == 0 && strcmp(e.ns, ns) == 0) return &e;
+    }
+    return NULL;
+}
+
+Persistence::Entry* Persistence::add(const char* ns, const char* key, Type type) {
+    if (_count >= PERSIST_MAX_ENTRIES || strlen(key) >= PERSIST_KEY_LEN) return NULL;
+    Entry& e = _entries[_count++];
+    e.ns = ns;
+    strncpy(e.key, key, PERSIST_KEY_LEN);
+    e.type = type;
+    e.present = false;
+    e.dirty = false;
+    e.len = 0;
+    e.blob = NULL;
+    e.crc = 0;
+    return &e;
+}
+
+// Preferences compatible encodings
+static esp_err_t nvsRead(nvs_handle_t handle, const char* key, Persistence::Type type, void* value, size_t len) {
+    switch (type) {
+        case Persistence::T_U8: return nvs_get_u8(handle, key, (uint8_t*)value);
+        case Persistence::T_I32: return nvs_get_i32(handle, key, (int32_t*)value);
+        case Persistence::T_U32: return nvs_get_u32(handle, key, (uint32_t*)value);
+        default: {
+            size_t stored = 0;
+            esp_err_t err = nvs_get_blob(handle, key, NULL, &stored);
+            if (err != ESP_OK) return err;
+            if (stored != len) return ESP_ERR_INVALID_SIZE;
+            return nvs_get_blob(handle, key, value, &stored);
+        }
+    }
+}
+
+static esp_err_t nvsWrite(nvs_handle_t handle, const char* key, Persistence::Type type, const void* value, size_t len) {
+    switch (type) {
+        case Persistence::T_U8: return nvs_set_u8(handle, key, *(const uint8_t*)value);
+        case Persistence::T_I32: return nvs_set_i32(handle, key, *(const int32_t*)value);
+        case Persistence::T_U32: return nvs_set_u32(handle, key, *(const uint32_t*)value);
+        default: return nvs_set_blob(handle, key, value, len);
+    }
+}
+
+static bool readDirect(const char* ns, const char* key, Persistence::Type type, void* value, size_t len) {
+    nvs_handle_t handle;
+    if (nvs_open(ns, NVS_READONLY, &handle) != ESP_OK) return false; // Namespace not created yet
+    esp_err_t err = nvsRead(handle, key, type, value, len);
+    nvs_close(handle);
+    return err == ESP_OK;
+}
+
+// Fills the cache from NVS. Large blobs go to buf (if given) and only their CRC is kept.
+bool Persistence::load(Entry& e, void* buf, size_t len) {
+    e.present = false;
+    e.blob = NULL;
+    bool large = len > sizeof(e.value);
+    if (large && buf == NULL) return false;
+    if (!readDirect(e.ns, e.key, e.type, large ? buf : e.value, len)) return false;
+    if (large) e.crc = crc32(buf, len);
+    e.len = len;
+    e.present = true;
+    return true;
+}
+
+bool Persistence::matches(const Entry& e, const void* value, size_t len) const {
+    if (!e.present || e.len != len) return false;
+    if (len <= sizeof(e.value)) return memcmp(e.value, value, len) == 0;
+    return e.crc == crc32(value, len);
+}
+
+void Persistence::store(Entry& e, const void* value, size_t len) {
+    e.len = len;
+    e.present = true;
+    if (len <= sizeof(e.value)) {
+        memcpy(e.value, value, len);
+        e.blob = NULL;
+    } else {
+        e.blob = value;
+        e.crc = crc32(value, len);
+    }
+}
+
+bool Persistence::get(const char* ns, const char* key, Type type, void* value, size_t len) {
+    Entry* e = find(ns, key);
+    if (e == NULL) {
+        e = add(ns, key, type);
+        if (e == NULL) return readDirect(ns, key, type, value, len); // Cache full
+        if (!load(*e, value, len)) return false;
+        if (len > sizeof(e->value)) return true; // Already in the caller's buffer
+    }
+    if (e->type != type) { // Re-typed key: start over
+        e->type = type;
+        e->dirty = false;
+        if (!load(*e, value, len)) return false;
+    }
+
+    if (!e->present || e->len != len) return false;
+    if (len <= sizeof(e->value)) {
+        memcpy(value, e->value, len);
+        return true;
+    }
+    if (e->blob == NULL) return load(*e, value, len); // Only the CRC is cached
+    if (e->blob != value) memcpy(value, e->blob, len);
+    return true;
+}
+
+size_t Persistence::getLength(const char* ns, const char* key) {
+    Entry* e = find(ns, key);
+    if (e != NULL && e->type == T_BLOB && e->present) return e->len;
+
+    nvs_handle_t handle;
+    if (nvs_open(ns, NVS_READONLY, &handle) != ESP_OK) return 0;
+    size_t len = 0;
+    if (nvs_get_blob(handle, key, NULL, &len) != ESP_OK) len = 0;
+    nvs_close(handle);
+    return len;
+}
+
+void Persistence::put(const char* ns, const char* key, Type type, const void* value, size_t len) {
+    Entry* e = find(ns, key);
+    if (e == NULL) {
+        e = add(ns, key, type);
+        if (e == NULL) { // Cache full: write through
+            writeDirect(ns, key, type, value, len);
+            return;
+        }
+        load(*e, NULL, len); // Unknown large blobs count as changed
+    } else if (e->type != type) {
+        e->type = type;
+        e->present = false;
+    }
+
+    if (matches(*e, value, len)) {
+        if (len > sizeof(e->value)) e->blob = value; // Keep the pointer fresh
+        _skipped++;
+        return;
+    }
+    store(*e, value, len);
+    if (!e->dirty) {
+        e->dirty = true;
+        if (!_dirty) {
+            _dirty = true;
+            _dirtySince = millis();
+        }
+    }
+}
+
+void Persistence::clear(const char* ns) {
+    // Drop the cached keys of this namespace
+    int kept = 0;
+    for (int i = 0; i < _count; i++) {
+        if (strcmp(_entries[i].ns, ns) == 0) continue;
+        if (kept != i) _entries[kept] = _entries[i];
+        kept++;
+    }
+    _count = kept;
+
+    nvs_handle_t handle;
+    if (nvs_open(ns, NVS_READWRITE, &handle) != ESP_OK) return;
+    nvs_erase_all(handle);
+    nvs_commit(handle);
+    nvs_close(handle);
+    _commits++;
+}
+
+bool Persistence::writeDirect(const char* ns, const char* key, Type type, const void* value, size_t len) {
+    nvs_handle_t handle;
+    if (nvs_open(ns, NVS_READWRITE, &handle) != ESP_OK) return false;
+    esp_err_t err = nvsWrite(handle, key, type, value, len);
+    if (err == ESP_OK) err = nvs_commit(handle);
+    nvs_close(handle);
+    _writes++;
+    _commits++;
+    return err == ESP_OK;
+}
+
+// One open/commit/close per namespace with dirty keys
+void Persistence::commit() {
+    for (int i = 0; i < _count; i++) {
+        if (!_entries[i].dirty) continue;
+        const char* ns = _entries[i].ns;
+
+        nvs_handle_t handle;
+        bool open = nvs_open(ns, NVS_READWRITE, &handle) == ESP_OK;
+        for (int j = i; j < _count; j++) {
+            Entry& e = _entries[j];
+            if (!e.dirty || strcmp(e.ns, ns) != 0) continue;
+            e.dirty = false;
+            if (!open) continue;
+
+            const void* data = (e.len <= sizeof(e.value)) ? (const void*)e.value : e.blob;
+            if (nvsWrite(handle, e.key, e.type, data, e.len) != ESP_OK) {
+                Serial.printf("[PERSIST] Write failed: %s/%s\n", ns, e.key);
+                e.present = false; // Compare against nothing, retried on the next put
+                continue;
+            }
+            if (e.blob != NULL) e.crc = crc32(data, e.len); // Buffer may have changed since put()
+            _writes++;
+        }
+        if (open) {
+            nvs_commit(handle);
+            nvs_close(handle);
+            _commits++;
+        } else {
+            Serial.printf("[PERSIST] Cannot open namespace %s\n", ns);
+        }
+    }
+    _dirty = false;
+}
+
+uint32_t Persistence::service() {
+    if (!_dirty) return PERSIST_IDLE_POLL_US;
+    unsigned long age = millis() - _dirtySince;
+    if (age < PERSIST_COMMIT_DELAY_MS) return (PERSIST_COMMIT_DELAY_MS - age) * 1000UL;
+    commit();
+    return PERSIST_IDLE_POLL_US;
+}
+
+void Persistence::flush() {
+    if (_dirty) commit();
+}
@@ -0,0 +1,135 @@
+#include "ProgressJournal.h"
+#include "Crc32.h"
+#include <stddef.h>
+#include <string.h>
+
+ProgressJournal::ProgressJournal() {
+    _part = NULL;
+    _sectors = 0;
+    _slotsPerSector = 0;
+    _hasLast = false;
+    memset(&_last, 0, sizeof(_last));
+    _sector = 0;
+    _slot = 0;
+    _appends = 0;
+    _erases = 0;
+}
+
+uint32_t ProgressJournal::recordCrc(const Record& r) {
+    return crc32(&r, offsetof(Record, crc));
+}
+
+bool ProgressJournal::readRecord(uint32_t sector, uint32_t slot, Record& out) const {
+    size_t offset = sector * JOURNAL_SECTOR_SIZE + slot * sizeof(Record);
+    if (esp_partition_read(_part, offset, &out, sizeof(Record)) != ESP_OK) return false;
+    return out.magic == JOURNAL_MAGIC && out.crc == recordCrc(out);
+}
+
+bool ProgressJournal::isErased(uint32_t sector, uint32_t slot) const {
+    uint8_t buf[sizeof(Record)];
+    size_t offset = sector * JOURNAL_SECTOR_SIZE + slot * sizeof(Record);
+    if (esp_partition_read(_part, offset, buf, sizeof(buf)) != ESP_OK) return false;
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        if (buf[i] != 0xFF) return false;
+    }
+    return true;
+}
+
+bool ProgressJournal::begin() {
+    _part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, JOURNAL_PARTITION_LABEL);
+    if (_part == NULL) return false;
+    _sectors = _part->size / JOURNAL_SECTOR_SIZE;
+    _slotsPerSector = JOURNAL_SECTOR_SIZE / sizeof(Record);
+    if (_sectors < 2) { // Round robin needs a spare sector
+        _part = NULL;
+        return false;
+    }
+
+    // The sector whose first record has the highest seq holds the newest record
+    Record r;
+    int newest = -1;
+    uint32_t newestSeq = 0;
+    for (uint32_t s = 0; s < _sectors; s++) {
+        if (readRecord(s, 0, r) && (newest < 0 || r.seq > newestSeq)) {
+            newest = s;
+            newestSeq = r.seq;
+        }
+    }
+
+    _hasLast = false;
+    if (newest < 0) {
+        // Empty (or garbage): start with an erase of sector 0
+        _sector = _sectors - 1;
+        _slot = _slotsPerSector;
+        return true;
+    }
+
+    // Walk that sector up to the first gap / torn write
+    _sector = newest;
+    _slot = 0;
+    while (_slot < _slotsPerSector && readRecord(_sector, _slot, r)) {
+        if (_hasLast && r.seq != _last.seq + 1) break;
+        _last = r;
+        _hasLast = true;
+        _slot++;
+    }
+    // A torn record can't be overwritten in place: continue in the next sector
+    if (_slot < _slotsPerSector && !isErased(_sector, _slot)) _slot = _slotsPerSector;
+    return true;
+}
+
+bool ProgressJournal::load(Record& out) const {
+    if (!_hasLast) return false;
+    out = _last;
+    return true;
+}
+
+bool ProgressJournal::startSector(uint32_t sector) {
+    _erases++;
+    if (esp_partition_erase_range(_part, sector * JOURNAL_SECTOR_SIZE, JOURNAL_SECTOR_SIZE) != ESP_OK) return false;
+    _sector = sector;
+    _slot = 0;
+    return true;
+}
+
+bool ProgressJournal::append(const Record& record) {
+    if (_part == NULL) return false;
+
+    // Nothing new since the last checkpoint
+    const size_t payloadStart = offsetof(Record, pumpCycles);
+    const size_t payloadLen = offsetof(Record, magic) - payloadStart;
+    if (_hasLast && memcmp((const uint8_t*)&record + payloadStart, (const uint8_t*)&_last + payloadStart, payloadLen) == 0) {
+        return true;
+    }
+
+    if (_slot >= _slotsPerSector) {
+        // Sector full: reuse the oldest one
+        if (!startSector((_sector + 1) % _sectors)) return false;
+    }
+
+    Record r = record;
+    r.seq = _hasLast ? _last.seq + 1 : 1;
+    r.magic = JOURNAL_MAGIC;
+    r.crc = recordCrc(r);
+    size_t offset = _sector * JOURNAL_SECTOR_SIZE + _slot * sizeof(Record);
+    _slot++; // Used even if the write fails
+    if (esp_partition_write(_part, offset, &r, sizeof(r)) != ESP_OK) return false;
+
+    _last = r;
+    _hasLast = true;
+    _appends++;
+    return true;
+}
+
+void ProgressJournal::erase() {
+    if (_part == NULL) return;
+    esp_partition_erase_range(_part, 0, _sectors * JOURNAL_SECTOR_SIZE);
+    _erases += _sectors;
+    _hasLast = false;
+    _sector = 0;
+    _slot = 0;
+}
+
+uint32_t ProgressJournal::getRecordCount() const {
+    return _sectors * _slotsPerSector;
+}
@@ -0,0 +1,72 @@
+#include "PulseStats.h"
+#include <string.h>
+
+// Upper bin edges (deviation in us), the last bin is open
+static const int32_t BIN_EDGES[PULSE_STATS_BINS - 1] = {
+    -1000, -100, 100, 500, 1000, 2000, 5000, 10000, 20000
+};
+
+static const char* const BIN_LABELS[PULSE_STATS_BINS] = {
+    "< -1 ms", "-1 .. -0.1 ms", "+-0.1 ms", "0.1 .. 0.5 ms", "0.5 .. 1 ms",
+    "1 .. 2 ms", "2 .. 5 ms", "5 .. 10 ms", "10 .. 20 ms", "> 20 ms"
+};
+
+static const char* const METRIC_NAMES[PulseStats::METRIC_COUNT] = {
+    "Ramp Up", "Hold", "Ramp Down", "Pause"
+};
+
+PulseStats::PulseStats() {
+    reset();
+}
+
+void PulseStats::reset() {
+    memset(_metrics, 0, sizeof(_metrics));
+    memset(_recent, 0, sizeof(_recent));
+    _lastSeq = 0;
+}
+
+void PulseStats::add(int metric, uint32_t requestedUs, uint32_t actualUs) {
+    Histogram& h = _metrics[metric];
+    int32_t dev = (int32_t)(actualUs - requestedUs);
+
+    int bin = 0;
+    while (bin < PULSE_STATS_BINS - 1 && dev >= BIN_EDGES[bin]) bin++;
+    h.bins[bin]++;
+
+    if (h.count == 0 || dev < h.minDevUs) h.minDevUs = dev;
+    if (h.count == 0 || dev > h.maxDevUs) h.maxDevUs = dev;
+    h.sumDevUs += dev;
+    h.count++;
+}
+
+void PulseStats::record(const Sample& sample) {
+    for (int m = 0; m < METRIC_COUNT; m++) {
+        if (m == PAUSE && !sample.hasPause) continue;
+        add(m, sample.requestedUs[m], sample.actualUs[m]);
+    }
+
+    uint32_t seq = _lastSeq + 1;
+    Sample& slot = _recent[seq & (PULSE_STATS_RECENT - 1)];
+    slot = sample;
+    slot.seq = seq;
+    _lastSeq = seq;
+}
+
+bool PulseStats::getRecent(uint32_t seq, Sample& out) const {
+    if (seq == 0 || seq > _lastSeq || _lastSeq - seq >= PULSE_STATS_RECENT) return false;
+    out = _recent[seq & (PULSE_STATS_RECENT - 1)];
+    return out.seq == seq;
+}
+
+int32_t PulseStats::getAvgDevUs(int metric) const {
+    const Histogram& h = _metrics[metric];
+    return h.count ? (int32_t)(h.sumDevUs / (int64_t)h.count) : 0;
+}
+
+const char* PulseStats::getMetricName(int metric) {
+    return (metric >= 0 && metric < METRIC_COUNT) ? METRIC_NAMES[metric] : "?";
+}
+
+const char* PulseStats::getBinLabel(int bin) {
+    return (bin >= 0 && bin < PULSE_STATS_BINS) ? BIN_LABELS[bin] : "?";
+}
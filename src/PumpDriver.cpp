@@ -0,0 +1,142 @@
+#include "PumpDriver.h"
+
+// Arduino LEDC channels 0-7 are the high speed group, 8-15 the low speed group
+static const ledc_mode_t PUMP_LEDC_MODE = (PUMP_PWM_CHANNEL < 8) ? LEDC_HIGH_SPEED_MODE : LEDC_LOW_SPEED_MODE;
+static const ledc_channel_t PUMP_LEDC_CHANNEL = (ledc_channel_t)(PUMP_PWM_CHANNEL % 8);
+
+static const uint32_t PUMP_DUTY_START = 130; // Start/stop at ~50% to prevent whining
+static const uint32_t PUMP_DUTY_FULL = 255;
+
+PumpDriver::PumpDriver() {
+    _pin = -1;
+    _timer = NULL;
+    _finishCallback = NULL;
+    _phase = PUMP_IDLE;
+    _finished = false;
+    _startUs = 0;
+    _rampDownUs = 0;
+    _rampUpEndUs = 0;
+    _lastEndUs = 0;
+    _lastEndMs = 0;
+    _lastPulseUs = 0;
+    _lastTotalUs = 0;
+    _lastRampUpUs = 0;
+    _lastHoldUs = 0;
+    _lastRampDownUs = 0;
+}
+
+void PumpDriver::begin(int pin) {
+    _pin = pin;
+
+    esp_timer_create_args_t args;
+    args.callback = &PumpDriver::onTimer;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "pump";
+    args.skip_unhandled_events = false;
+    if (esp_timer_create(&args, &_timer) != ESP_OK) {
+        Serial.println("[CRITICAL] Pump timer could not be created!");
+    }
+
+    if (PUMP_USE_PWM) {
+        ledc_fade_func_install(0);
+        ledc_cbs_t callbacks;
+        callbacks.fade_cb = &PumpDriver::onFadeEnd;
+        ledc_cb_register(PUMP_LEDC_MODE, PUMP_LEDC_CHANNEL, &callbacks, this);
+    }
+}
+
+bool PumpDriver::start(unsigned long pulseMs) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_phase != PUMP_IDLE || _timer == NULL) return false;
+
+    _finished = false;
+    _rampUpEndUs = 0;
+    _startUs = esp_timer_get_time();
+
+    if (PUMP_USE_PWM) {
+        ledc_set_duty_and_update(PUMP_LEDC_MODE, PUMP_LEDC_CHANNEL, PUMP_DUTY_START, 0);
+        ledc_set_fade_time_and_start(PUMP_LEDC_MODE, PUMP_LEDC_CHANNEL, PUMP_DUTY_FULL, PUMP_RAMP_UP_MS, LEDC_FADE_NO_WAIT);
+        _phase = PUMP_RAMP_UP;
+    } else {
+        // Fallback: Hard Switching
+        digitalWrite(_pin, PUMP_ON);
+        _phase = PUMP_HOLD;
+    }
+    esp_timer_start_once(_timer, (uint64_t)pulseMs * 1000);
+    return true;
+}
+
+void PumpDriver::stop() {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_timer != NULL) esp_timer_stop(_timer);
+    outputOff();
+    _phase = PUMP_IDLE;
+    _finished = false;
+}
+
+PumpState PumpDriver::getPhase() const {
+    PumpState phase = _phase;
+    if (phase == PUMP_RAMP_UP && _rampUpEndUs != 0) return PUMP_HOLD; // Fade done, the hardware holds full duty
+    return phase;
+}
+
+bool PumpDriver::takeFinished() {
+    if (!_finished) return false;
+    _finished = false;
+    return true;
+}
+
+void PumpDriver::onTimer(void* arg) {
+    static_cast<PumpDriver*>(arg)->advance();
+}
+
+// LEDC fade interrupt: only timestamps the end of the ramp up
+bool IRAM_ATTR PumpDriver::onFadeEnd(const ledc_cb_param_t* /*param*/, void* arg) {
+    PumpDriver* self = static_cast<PumpDriver*>(arg);
+    if (self->_phase == PUMP_RAMP_UP && self->_rampUpEndUs == 0) {
+        self->_rampUpEndUs = esp_timer_get_time();
+    }
+    return false; // No task woken
+}
+
+// Timer task: end of hold -> ramp down -> off
+void PumpDriver::advance() {
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_phase == PUMP_IDLE) return; // stop() was faster
+
+        int64_t now = esp_timer_get_time();
+        if (PUMP_USE_PWM && _phase != PUMP_RAMP_DOWN) {
+            _rampDownUs = now;
+            ledc_set_fade_time_and_start(PUMP_LEDC_MODE, PUMP_LEDC_CHANNEL, PUMP_DUTY_START, PUMP_RAMP_DOWN_MS, LEDC_FADE_NO_WAIT);
+            _phase = PUMP_RAMP_DOWN;
+            esp_timer_start_once(_timer, (uint64_t)PUMP_RAMP_DOWN_MS * 1000);
+            return;
+        }
+        if (!PUMP_USE_PWM) _rampDownUs = now;
+
+        outputOff();
+        _lastPulseUs = (uint32_t)(_rampDownUs - _startUs);
+        _lastTotalUs = (uint32_t)(now - _startUs);
+        int64_t rampUpEnd = _rampUpEndUs;
+        if (rampUpEnd != 0 && rampUpEnd <= _rampDownUs) {
+            _lastRampUpUs = (uint32_t)(rampUpEnd - _startUs);
+            _lastHoldUs = (uint32_t)(_rampDownUs - rampUpEnd);
+        } else {
+            _lastRampUpUs = 0; // Not seen (or no PWM): whole pulse counts as hold
+            _lastHoldUs = _lastPulseUs;
+        }
+        _lastRampDownUs = (uint32_t)(now - _rampDownUs);
+        _lastEndUs = now;
+        _lastEndMs = millis();
+        _phase = PUMP_IDLE;
+        _finished = true;
+    }
+    if (_finishCallback) _finishCallback();
+}
+
+void PumpDriver::outputOff() {
+    if (PUMP_USE_PWM) ledc_stop(PUMP_LEDC_MODE, PUMP_LEDC_CHANNEL, (PUMP_OFF == HIGH) ? 1 : 0);
+    digitalWrite(_pin, PUMP_OFF);
+}
@@ -0,0 +1,42 @@
+#include "RtcShadow.h"
+#include "Crc32.h"
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <stddef.h>
+
+#define RTC_SHADOW_MAGIC 0x57444853 // "SHDW"
+
+struct ShadowData {
+    uint32_t magic;
+    uint32_t size; // sizeof(Record): a firmware with another layout ignores the copy
+    ProgressJournal::Record state;
+    uint32_t crc;
+};
+
+// Not cleared by the startup code (random content after power on)
+RTC_NOINIT_ATTR static ShadowData shadow;
+
+static uint32_t shadowCrc() {
+    return crc32(&shadow, offsetof(ShadowData, crc));
+}
+
+void RtcShadow::save(const ProgressJournal::Record& state) {
+    shadow.magic = RTC_SHADOW_MAGIC;
+    shadow.size = sizeof(ProgressJournal::Record);
+    shadow.state = state;
+    shadow.crc = shadowCrc();
+}
+
+bool RtcShadow::restore(ProgressJournal::Record& state) {
+    esp_reset_reason_t reason = esp_reset_reason();
+    if (reason == ESP_RST_POWERON || reason == ESP_RST_BROWNOUT || reason == ESP_RST_UNKNOWN) return false;
+    if (shadow.magic != RTC_SHADOW_MAGIC || shadow.size != sizeof(ProgressJournal::Record)) return false;
+    if (shadow.crc != shadowCrc()) return false;
+    state = shadow.state;
+    return true;
+}
+
+void RtcShadow::invalidate() {
+    shadow.magic = 0;
+    shadow.crc = 0;
+}
@@ -0,0 +1,70 @@
+#include "Scheduler.h"
+
+Scheduler::Scheduler() {
+    _count = 0;
+    resetStats();
+}
+
+int Scheduler::add(const char* name, TaskFn fn, uint32_t firstDelayUs) {
+    if (_count >= SCHEDULER_MAX_TASKS) return -1;
+    Task& t = _tasks[_count];
+    t.name = name;
+    t.fn = fn;
+    t.due = micros() + firstDelayUs;
+    t.runs = 0;
+    t.maxRunUs = 0;
+    t.busyUs = 0;
+    return _count++;
+}
+
+void Scheduler::wake(int id) {
+    if (id < 0 || id >= _count) return;
+    _tasks[id].due = micros();
+}
+
+uint32_t Scheduler::runDue(uint32_t maxSleepUs) {
+    for (int i = 0; i < _count; i++) {
+        Task& t = _tasks[i];
+        uint32_t start = micros();
+        int32_t late = (int32_t)(start - t.due); // Wrap-safe
+        if (late < 0) continue;
+
+        if ((uint32_t)late > _maxLateUs) _maxLateUs = late;
+        uint32_t next = t.fn();
+        uint32_t end = micros();
+        uint32_t runUs = end - start;
+
+        t.due = end + next;
+        t.runs++;
+        t.busyUs += runUs;
+        if (runUs > t.maxRunUs) t.maxRunUs = runUs;
+        _busyUs += runUs;
+    }
+
+    // Time until the earliest deadline
+    uint32_t now = micros();
+    uint32_t sleepUs = maxSleepUs;
+    for (int i = 0; i < _count; i++) {
+        int32_t remaining = (int32_t)(_tasks[i].due - now);
+        if (remaining <= 0) return 0;
+        if ((uint32_t)remaining < sleepUs) sleepUs = remaining;
+    }
+    return sleepUs;
+}
+
+float Scheduler::getLoadPercent() const {
+    unsigned long elapsedMs = millis() - _statsStart;
+    if (elapsedMs == 0) return 0.0;
+    return (float)((double)_busyUs / 10.0 / (double)elapsedMs);
+}
+
+void Scheduler::resetStats() {
+    _statsStart = millis();
+    _busyUs = 0;
+    _maxLateUs = 0;
+    for (int i = 0; i < _count; i++) {
+        _tasks[i].runs = 0;
+        _tasks[i].maxRunUs = 0;
+        _tasks[i].busyUs = 0;
+    }
+}
@@ -0,0 +1,216 @@
+#include "TelemetryLog.h"
+#include <string.h>
+
+const TelemetryLog::Column TelemetryLog::COLUMNS[FIELD_COUNT] = {
+    { "Speed_GPS",    ENC_U16,     2 },
+    { "Speed_Smooth", ENC_U16,     2 },
+    { "Odo_Total",    ENC_DELTA16, 2 }, // Odometer only grows: 16 bit steps
+    { "Dist_Accum",   ENC_U16,     2 },
+    { "Target_Int",   ENC_U16,     2 },
+    { "Pump_State",   ENC_BIT,     0 },
+    { "Rain_Mode",    ENC_BIT,     0 },
+    { "Temp_C",       ENC_I16,     1 },
+    { "Sats",         ENC_U8,      0 },
+    { "HDOP",         ENC_U16,     2 },
+    { "Message",      ENC_TEXT,    0 },
+    { "Flush_Mode",   ENC_BIT,     0 },
+};
+
+static const uint32_t POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+const char* TelemetryLog::typeName(RecordType type) {
+    switch (type) {
+        case REC_DATA: return "DATA";
+        case REC_PULSE: return "PULSE";
+        case REC_SYNC: return "SYNC";
+        default: return "EVENT"; // EVENT and NOTE
+    }
+}
+
+int TelemetryLog::encodedSize(Encoding encoding) {
+    switch (encoding) {
+        case ENC_U8: return 1;
+        case ENC_U16:
+        case ENC_I16:
+        case ENC_DELTA16: return 2;
+        case ENC_U32: return 4;
+        default: return 0;
+    }
+}
+
+TelemetryLog::TelemetryLog() : TelemetryLog(COLUMNS, FIELD_COUNT) {}
+
+TelemetryLog::TelemetryLog(const Column* columns, int count) {
+    _columns = columns;
+    _count = count > TELEMETRY_MAX_COLUMNS ? TELEMETRY_MAX_COLUMNS : count;
+    _out = NULL;
+    _binary = false;
+    _synced = false;
+    _lastMs = 0;
+    memset(_base, 0, sizeof(_base));
+    _syncs = 0;
+}
+
+void TelemetryLog::begin(LogWriter* out, bool binary) {
+    _out = out;
+    _binary = binary;
+    _synced = false;
+    memset(_base, 0, sizeof(_base));
+    if (_out == NULL) return;
+
+    if (!_binary) {
+        _out->add("Type,Time_ms");
+        for (int i = 0; i < _count; i++) {
+            _out->add(',');
+            _out->add(_columns[i].name);
+        }
+        _out->endLine();
+        return;
+    }
+
+    _out->addBytes(TELEMETRY_MAGIC, 4);
+    addInt(TELEMETRY_FORMAT_VERSION, 1);
+    addInt(_count, 1);
+    for (int i = 0; i < _count; i++) {
+        addInt(_columns[i].encoding, 1);
+        addInt(_columns[i].decimals, 1);
+        _out->addBytes(_columns[i].name, strlen(_columns[i].name) + 1);
+    }
+    _out->endRecord();
+}
+
+// Same rounding as LogWriter::addFixed()
+int32_t TelemetryLog::encode(double value, uint8_t decimals) {
+    if (decimals > 6) decimals = 6;
+    if (isnan(value)) return 0;
+    bool negative = value < 0;
+    if (negative) value = -value;
+    double scaled = value * POW10[decimals] + 0.5;
+    int32_t v = scaled >= 2147483647.0 ? 2147483647 : (int32_t)scaled;
+    return negative ? -v : v;
+}
+
+static int32_t clampTo(int32_t v, int32_t lo, int32_t hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+void TelemetryLog::addInt(int32_t value, int bytes) {
+    uint8_t buf[4];
+    for (int i = 0; i < bytes; i++) buf[i] = (uint8_t)((uint32_t)value >> (8 * i));
+    _out->addBytes(buf, bytes);
+}
+
+void TelemetryLog::addMessage(const char* message) {
+    size_t len = strlen(message);
+    if (len > TELEMETRY_MAX_MESSAGE) len = TELEMETRY_MAX_MESSAGE;
+    addInt(len, 1);
+    _out->addBytes(message, len);
+}
+
+bool TelemetryLog::advance(uint32_t timeMs, const int32_t* encoded) {
+    if (!_synced || timeMs < _lastMs || timeMs - _lastMs > 0xFFFF) return false;
+    if (encoded == NULL) return true;
+    for (int i = 0; i < _count; i++) {
+        if (_columns[i].encoding != ENC_DELTA16) continue;
+        int32_t delta = encoded[i] - _base[i];
+        if (delta < 0 || delta > 0xFFFF) return false;
+    }
+    return true;
+}
+
+void TelemetryLog::writeSync(uint32_t timeMs) {
+    addInt(REC_SYNC, 1);
+    addInt(timeMs, 4);
+    for (int i = 0; i < _count; i++) {
+        if (_columns[i].encoding == ENC_DELTA16) addInt(_base[i], 4);
+    }
+    _out->endRecord();
+    _lastMs = timeMs;
+    _synced = true;
+    _syncs++;
+}
+
+void TelemetryLog::write(RecordType type, uint32_t timeMs, const double* values, const char* message) {
+    if (_out == NULL) return;
+
+    if (!_binary) {
+        _out->add(typeName(type));
+        _out->add(',');
+        _out->addUInt(timeMs);
+        for (int i = 0; i < _count; i++) {
+            _out->add(',');
+            if (_columns[i].encoding == ENC_TEXT) {
+                _out->add(message);
+            } else {
+                _out->addFixed(values[i], _columns[i].decimals);
+            }
+        }
+        _out->endLine();
+        return;
+    }
+
+    int32_t encoded[TELEMETRY_MAX_COLUMNS] = { 0 };
+    for (int i = 0; i < _count; i++) {
+        int32_t v = encode(values[i], _columns[i].decimals);
+        switch (_columns[i].encoding) {
+            case ENC_U8: v = clampTo(v, 0, 0xFF); break;
+            case ENC_U16: v = clampTo(v, 0, 0xFFFF); break;
+            case ENC_I16: v = clampTo(v, -32768, 32767); break;
+            case ENC_U32: v = clampTo(v, 0, 0x7FFFFFFF); break;
+            case ENC_BIT: v = v != 0; break;
+            default: break;
+        }
+        encoded[i] = v;
+    }
+
+    if (!advance(timeMs, encoded)) {
+        for (int i = 0; i < _count; i++) {
+            if (_columns[i].encoding == ENC_DELTA16) _base[i] = encoded[i];
+        }
+        writeSync(timeMs);
+    }
+
+    addInt(type, 1);
+    addInt(timeMs - _lastMs, 2);
+    uint8_t flags = 0;
+    int bit = 0;
+    for (int i = 0; i < _count; i++) {
+        Encoding enc = _columns[i].encoding;
+        if (enc == ENC_BIT) {
+            if (encoded[i]) flags |= 1 << bit;
+            bit++;
+        } else if (enc == ENC_DELTA16) {
+            addInt(encoded[i] - _base[i], 2);
+            _base[i] = encoded[i];
+        } else if (enc != ENC_TEXT) {
+            addInt(encoded[i], encodedSize(enc));
+        }
+    }
+    if (bit > 0) addInt(flags, 1);
+    if (type != REC_DATA) addMessage(message);
+    _lastMs = timeMs;
+    _out->endRecord();
+}
+
+void TelemetryLog::note(uint32_t timeMs, const char* message) {
+    if (_out == NULL) return;
+
+    if (!_binary) {
+        _out->add(typeName(REC_NOTE));
+        _out->add(',');
+        _out->addUInt(timeMs);
+        for (int i = 0; i < _count; i++) {
+            _out->add(',');
+            if (_columns[i].encoding == ENC_TEXT) _out->add(message);
+        }
+        _out->endLine();
+        return;
+    }
+
+    if (!advance(timeMs, NULL)) writeSync(timeMs);
+    addInt(REC_NOTE, 1);
+    addInt(timeMs - _lastMs, 2);
+    addMessage(message);
+    _lastMs = timeMs;
+    _out->endRecord();
+}
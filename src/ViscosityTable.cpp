@@ -0,0 +1,62 @@
+#include "ViscosityTable.h"
+
+// Compile time generation (C++11 constexpr: single expressions, recursion instead of loops)
+namespace {
+    constexpr double VISC_B = 3931.8;    // Arrhenius slope of the VG 85 model (A cancels out in the ratio)
+    constexpr double KELVIN = 273.15;
+    constexpr double REF_C = 25.0;
+
+    // Taylor series, |x| stays below ~1.1 for all table entries
+    constexpr double expSeries(double x, double term, int n) {
+        return (n > 24) ? term : term + expSeries(x, term * x / n, n + 1);
+    }
+    constexpr double cexp(double x) {
+        return expSeries(x, 1.0, 1);
+    }
+
+    constexpr double tempAt(int index) {
+        return VISC_TABLE_MIN_C + (double)index / VISC_TABLE_STEPS_PER_C;
+    }
+
+    // (v(T)/v(25 C))^exponent = exp(exponent * B * (1/T - 1/T25))
+    constexpr uint16_t factorAt(double exponent, int index) {
+        return (uint16_t)(cexp(exponent * VISC_B * (1.0 / (tempAt(index) + KELVIN) - 1.0 / (REF_C + KELVIN)))
+                          * VISC_FACTOR_SCALE + 0.5);
+    }
+
+    template<int... I> struct Indices {};
+    template<int N, int... I> struct MakeIndices : MakeIndices<N - 1, N - 1, I...> {};
+    template<int... I> struct MakeIndices<0, I...> { typedef Indices<I...> type; };
+
+    template<int... I>
+    constexpr ViscosityTable::Table makeTable(double exponent, Indices<I...>) {
+        return ViscosityTable::Table{{ factorAt(exponent, I)... }};
+    }
+
+    constexpr ViscosityTable::Table makeTable(double exponent) {
+        return makeTable(exponent, MakeIndices<VISC_TABLE_SIZE>::type());
+    }
+}
+
+// Compensation exponents, tuned by real-world calibration at 10 C (pump is very efficient)
+const ViscosityTable::Table ViscosityTable::tables[VISC_TABLE_OIL_TYPES] = {
+    makeTable(0.15), // OIL_THIN: gentle compensation (was 0.3)
+    makeTable(0.25), // OIL_NORMAL (was 0.5)
+    makeTable(0.35)  // OIL_THICK: aggressive compensation (was 0.7)
+};
+
+static_assert(VISC_TABLE_SIZE == 221, "0.5 C steps from -30 to +80 C");
+
+float ViscosityTable::getFactor(int oilType, float tempC) {
+    if (oilType < 0 || oilType >= VISC_TABLE_OIL_TYPES) oilType = 1; // OIL_NORMAL
+    const uint16_t* f = tables[oilType].factor;
+
+    float pos = (tempC - VISC_TABLE_MIN_C) * VISC_TABLE_STEPS_PER_C;
+    if (pos <= 0.0f) return (float)f[0] / VISC_FACTOR_SCALE;
+    if (pos >= VISC_TABLE_SIZE - 1) return (float)f[VISC_TABLE_SIZE - 1] / VISC_FACTOR_SCALE;
+
+    // Linear interpolation between the two neighbouring entries
+    int i = (int)pos;
+    float frac = pos - i;
+    return ((float)f[i] + ((float)f[i + 1] - (float)f[i]) * frac) / VISC_FACTOR_SCALE;
+}
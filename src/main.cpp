@@ -4,12 +4,24 @@
 #include <DNSServer.h>
 #include <TinyGPS++.h>
 #include <esp_task_wdt.h>
+#include <freertos/event_groups.h>
 #include <Update.h>
-#include <Preferences.h>
 #include "config.h"
 #include "Oiler.h"
 #include "AuxManager.h"
+#include "GpsIngest.h"
+#include "Scheduler.h"
+#include "Persistence.h"
+#include "BootTimeline.h"
+#include "LogWriter.h"
+#include "TelemetryLog.h"
+#include "HighRateLog.h"
+#include "LogStore.h"
 #include "html_pages.h"
+#include "html_pages_gz.h"
+#include "PageTemplate.h"
+#include "PageStream.h"
+#include "JsonWriter.h"
 #include "WebConsole.h"
 
 #ifdef SD_LOGGING_ACTIVE
@@ -22,18 +34,33 @@
 #define WDT_TIMEOUT 8
 
 // Global Objects
-TinyGPSPlus gps;
 HardwareSerial gpsSerial(2); // UART2
+TaskHandle_t gpsTaskHandle = NULL;
 WebServer server(80);
 DNSServer dnsServer;
 Oiler oiler;
 AuxManager auxManager;
+GpsIngest gpsIngest;
+Scheduler scheduler;
+TaskHandle_t loopTaskHandle = NULL;
+int gpsSchedTask = -1;
+int pumpSchedTask = -1;
 
 #ifdef SD_LOGGING_ACTIVE
-    File logFile;
-    String currentLogFileName = "";
-    unsigned long lastLogTime = 0;
+    // Ring of pre-allocated segments, LOG_STORE_BUDGET_MB in total
+    LogStore logStore(LOG_STORE_DIR, LOG_FILE_EXT, LOG_STORE_SEGMENT_KB * 1024UL,
+                      LOG_STORE_BUDGET_MB * 1024UL / LOG_STORE_SEGMENT_KB);
     bool sdInitialized = false;
+    LogWriter logWriter; // Buffered writes into logStore
+    TelemetryLog telemetryLog; // Rows as CSV or binary records (LOG_BINARY)
+#ifdef HIGHRATE_LOG_ACTIVE
+    HighRateLog highRateLog;   // Loop -> writer task
+    LogStore hrStore(HIGHRATE_STORE_DIR, ".bin", HIGHRATE_STORE_SEGMENT_KB * 1024UL,
+                     HIGHRATE_STORE_BUDGET_MB * 1024UL / HIGHRATE_STORE_SEGMENT_KB); // Writer task (+ spare task)
+    LogWriter hrWriter;
+    TelemetryLog hrTelemetry(HighRateLog::COLUMNS, HighRateLog::FIELD_COUNT);
+    TaskHandle_t hrTaskHandle = NULL;
+#endif
 #endif
 
 // WiFi Timer Variables
@@ -47,13 +74,14 @@ volatile bool shouldFactoryReset = false;
 unsigned long restartTimer = 0;
 
 String getZurichTime() {
-    if (!gps.time.isValid() || !gps.date.isValid()) return "--:--";
+    const GpsFix& fix = gpsIngest.getLastFix();
+    if (!fix.timeValid || !fix.dateValid) return "--:--";
     
-    int year = gps.date.year();
-    int month = gps.date.month();
-    int day = gps.date.day();
-    int hour = gps.time.hour();
-    int minute = gps.time.minute();
+    int year = fix.year;
+    int month = fix.month;
+    int day = fix.day;
+    int hour = fix.hour;
+    int minute = fix.minute;
     
     // Use Oiler's centralized logic
     int localHour = oiler.calculateLocalHour(hour, day, month, year);
@@ -71,16 +99,54 @@ void resetWifiTimer() {
     wifiStartTime = millis();
 }
 
+// --- Web Pages ---
+// Templates from html_pages.h, placeholders are found once (beginPages) and
+// the page is streamed: literals from flash, values printed in between.
+void sendPage(const PageTemplate& page, PageTemplate::Filler fill) {
+    PageStream out(server);
+    out.begin(200, "text/html");
+    page.render(out, fill);
+    out.end();
+}
+
+float tankPercent() {
+    return (oiler.tankCapacityMl > 0) ? (oiler.currentTankLevelMl / oiler.tankCapacityMl) * 100.0 : 0.0;
+}
+
+// Static pages are gzipped at build time (tools/compress_pages.py). The
+// ETag changes with every page change, so the browser revalidates and gets
+// a 304 without a body. false: the client doesn't take gzip, send the plain page.
+bool sendGzip(const char* contentType, const uint8_t* data, size_t len, const char* cacheControl = "no-cache") {
+    if (server.header("Accept-Encoding").indexOf("gzip") < 0) return false;
+    server.sendHeader("Cache-Control", cacheControl);
+    server.sendHeader("ETag", PAGES_ETAG);
+    server.sendHeader("Vary", "Accept-Encoding");
+    if (server.header("If-None-Match") == PAGES_ETAG) {
+        server.send(304);
+        return true;
+    }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, contentType, (const char*)data, len);
+    return true;
+}
+
 void handleCss() {
+    if (sendGzip("text/css", htmlCssGz, sizeof(htmlCssGz), "public, max-age=86400")) return;
     server.sendHeader("Cache-Control", "public, max-age=86400");
     server.send(200, "text/css", htmlCss);
 }
 
+const char* const helpKeys[] = { "VERSION" };
+PageTemplate helpPage(htmlHelp, helpKeys, 1);
+
+void fillHelp(Print& out, int /*key*/) { // Single placeholder
+    out.print(FIRMWARE_VERSION);
+}
+
 void handleHelp() {
     resetWifiTimer();
-    String html = htmlHelp;
-    html.replace("%VERSION%", FIRMWARE_VERSION);
-    server.send(200, "text/html", html);
+    if (sendGzip("text/html", htmlHelpGz, sizeof(htmlHelpGz))) return;
+    sendPage(helpPage, fillHelp);
 }
 
 void handleResetStats() {
@@ -125,6 +191,7 @@ void handleToggleEmerg() {
 
 void handleUpdate() {
     resetWifiTimer();
+    if (sendGzip("text/html", htmlUpdateGz, sizeof(htmlUpdateGz))) return;
     server.send(200, "text/html", htmlUpdate);
 }
 
@@ -136,6 +203,10 @@ void handleUpdateResult() {
         oiler.setUpdateMode(false);
     } else {
         server.send(200, "text/html", "<html><head><meta http-equiv='refresh' content='10;url=/'></head><body><h2>Update Success!</h2><p>Rebooting system...</p></body></html>");
+        persistence.flush();
+#ifdef SD_LOGGING_ACTIVE
+        logWriter.flush();
+#endif
         delay(1000);
         ESP.restart();
     }
@@ -169,215 +240,332 @@ void handleUpdateProcess() {
 }
 
 #ifdef SD_LOGGING_ACTIVE
-void initSD() {
+// Runs in an init task: SD/SPI only, sdInitialized is set by the loop (onInitDone)
+bool initSD() {
     SPI.begin(SD_CLK_PIN, SD_MISO_PIN, SD_MOSI_PIN, SD_CS_PIN);
     if (!SD.begin(SD_CS_PIN)) {
         Serial.println("SD Card Mount Failed");
-        return;
+        return false;
     }
     
     uint8_t cardType = SD.cardType();
     if (cardType == CARD_NONE) {
         Serial.println("No SD card attached");
-        return;
+        return false;
     }
 
-    // Find next available log file
-    int logIndex = 0;
-    do {
-        logIndex++;
-        currentLogFileName = String(LOG_FILE_PREFIX) + String(logIndex) + ".csv";
-    } while (SD.exists(currentLogFileName));
+    // Next segment of the store: one index read, the segment headers are only
+    // read if it is missing. Zero fills new segments on the first boots.
+    if (!logStore.begin(SD)) {
+        Serial.println("Failed to open log file for writing");
+        return false;
+    }
+    Serial.printf("Logging to: %s (log %u)\n", logStore.getSegmentPath().c_str(), logStore.getLog());
+#ifdef HIGHRATE_LOG_ACTIVE
+    hrStore.begin(SD, logStore.getLog()); // Same number as the main log
+#endif
+    return true; // Header + rows are written by the loop (sdOnline)
+}
 
-    Serial.print("Logging to: ");
-    Serial.println(currentLogFileName);
+// Column header (CSV) or schema (binary) + config dump, once the card is online
+void writeLogHeader() {
+#ifdef LOG_BINARY
+    telemetryLog.begin(&logWriter, true);
+#else
+    telemetryLog.begin(&logWriter, false);
+#endif
 
-    logFile = SD.open(currentLogFileName, FILE_WRITE);
-    if (logFile) {
-        // Write Header
-        logFile.println("Type,Time_ms,Speed_GPS,Speed_Smooth,Odo_Total,Dist_Accum,Target_Int,Pump_State,Rain_Mode,Temp_C,Sats,HDOP,Message,Flush_Mode");
-        
-        // Dump Config
-        logFile.println("EVENT,0,,,,,,,,,,CONFIG DUMP START");
-        logFile.printf("EVENT,0,,,,,,,,,,Rain Multiplier: %d\n", (oiler.isRainMode() ? 2 : 1));
-        for(int i=0; i<5; i++) {
-            SpeedRange* r = oiler.getRangeConfig(i);
-            if(r) {
-                logFile.printf("EVENT,0,,,,,,,,,,Range %d: >%.1f km/h -> %.1f km\n", 
-                    i, r->minSpeed, r->intervalKm);
-            }
+    char msg[64];
+    telemetryLog.note(0, "CONFIG DUMP START");
+    snprintf(msg, sizeof(msg), "Rain Multiplier: %d", (oiler.isRainMode() ? 2 : 1));
+    telemetryLog.note(0, msg);
+    for(int i=0; i<5; i++) {
+        SpeedRange* r = oiler.getRangeConfig(i);
+        if(r) {
+            snprintf(msg, sizeof(msg), "Range %d: >%.1f km/h -> %.1f km", i, r->minSpeed, r->intervalKm);
+            telemetryLog.note(0, msg);
         }
-        
-        // Log Boot Reason
-        esp_reset_reason_t reason = esp_reset_reason();
-        logFile.printf("EVENT,%lu,,,,,,,,,,Boot Reason: %d\n", millis(), reason);
-        
-        logFile.close();
-        sdInitialized = true;
-    } else {
-        Serial.println("Failed to open log file for writing");
     }
+
+    // Log Boot Reason
+    snprintf(msg, sizeof(msg), "Boot Reason: %d", (int)esp_reset_reason());
+    telemetryLog.note(millis(), msg);
 }
 
-void writeLogLine(String type, String message = "") {
+// A new segment starts in the middle of a row: repeat the column line / schema
+// there, so the log can still be read once its first part is recycled
+void repeatLogHeader(LogStore& store, LogWriter& writer, TelemetryLog& log) {
+    if (!store.takeSegmentStarted()) return;
+    uint32_t start = store.getOffset() + writer.getBuffered();
+    log.begin(&writer, log.isBinary()); // The next record is a SYNC
+    store.setHeaderCopy(start, store.getOffset() + writer.getBuffered() - start);
+}
+
+void writeLogLine(TelemetryLog::RecordType type, const String& message = "") {
     if (!sdInitialized) return;
+    repeatLogHeader(logStore, logWriter, telemetryLog);
+
+    const GpsFix& fix = gpsIngest.getLastFix();
+    double values[TelemetryLog::FIELD_COUNT];
+    values[TelemetryLog::SPEED_GPS] = fix.speedKmh;
+    values[TelemetryLog::SPEED_SMOOTH] = oiler.getSmoothedSpeed();
+    values[TelemetryLog::ODO_TOTAL] = oiler.getOdometer();
+    values[TelemetryLog::DIST_ACCUM] = oiler.getCurrentDistAccumulator();
+    values[TelemetryLog::TARGET_INT] = oiler.getCurrentTargetDistance();
+    values[TelemetryLog::PUMP_STATE] = oiler.isPumpRunning();
+    values[TelemetryLog::RAIN_MODE] = oiler.isRainMode();
+    values[TelemetryLog::TEMP_C] = oiler.getCurrentTempC();
+    values[TelemetryLog::SATS] = fix.sats;
+    values[TelemetryLog::HDOP] = fix.hdop;
+    values[TelemetryLog::MESSAGE] = 0;
+    values[TelemetryLog::FLUSH_MODE] = oiler.isFlushMode();
+
+    // Seek point for host/logextract (binary: the row starts with a SYNC)
+    static uint32_t lastIndexMs = 0;
+    uint32_t now = millis();
+    bool event = type == TelemetryLog::REC_EVENT || type == TelemetryLog::REC_PULSE;
+    if (event || lastIndexMs == 0 || now - lastIndexMs >= LOG_INDEX_INTERVAL_MS) {
+        logStore.addIndex(now, logStore.getOffset() + logWriter.getBuffered(), event);
+        telemetryLog.markSync();
+        if (!event) lastIndexMs = now;
+    }
+    telemetryLog.write(type, now, values, message.c_str());
+}
+
+// Zero fills the segments used up by rotations, so a full segment never waits
+// for a new one to be created (LogStore::prepareSpares)
+void logSpareTask(void* param) {
+    for (;;) {
+        bool busy = logStore.prepareSpares();
+#ifdef HIGHRATE_LOG_ACTIVE
+        if (hrStore.prepareSpares()) busy = true;
+#endif
+        vTaskDelay(busy ? 1 : pdMS_TO_TICKS(LOG_SPARE_POLL_MS));
+    }
+}
+
+#ifdef HIGHRATE_LOG_ACTIVE
+// --- High-Rate Log ---
+// The loop only copies a sample into RAM (taskHighRate), the writer task
+// encodes full buffers into hr_X.bin on the other core.
+void highRateWriterTask(void* param) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(HIGHRATE_WRITER_POLL_MS));
+        bool partial = false;
+        uint32_t n, t;
+        while (highRateLog.peekTime(t)) { // One seek point per buffer
+            repeatLogHeader(hrStore, hrWriter, hrTelemetry);
+            hrStore.addIndex(t, hrStore.getOffset() + hrWriter.getBuffered(), false);
+            hrTelemetry.markSync();
+            n = highRateLog.writeNext(hrTelemetry);
+            if (n < HIGHRATE_BUFFER_SAMPLES) partial = true;
+        }
+        if (partial) {
+            hrWriter.flush(); // Handed over early: stopped or crashed
+        } else {
+            hrWriter.service();
+        }
+    }
+}
+
+void startHighRateLog() {
+    if (!hrStore.isOpen()) return;
+    hrWriter.begin(&hrStore);
+    hrTelemetry.begin(&hrWriter, true);
+    if (xTaskCreatePinnedToCore(highRateWriterTask, "hrlog", HIGHRATE_TASK_STACK, NULL,
+                                HIGHRATE_TASK_PRIORITY, &hrTaskHandle, HIGHRATE_TASK_CORE) != pdPASS) {
+        hrTaskHandle = NULL;
+        Serial.println("High-rate log: no memory for the writer task");
+    }
+}
+
+// Partly filled buffer to the card (stopped, crash)
+void flushHighRateLog() {
+    if (hrTaskHandle == NULL) return;
+    highRateLog.handOver();
+    xTaskNotifyGive(hrTaskHandle);
+}
 
-    File f = SD.open(currentLogFileName, FILE_APPEND);
-    if (f) {
-        f.printf("%s,%lu,%.2f,%.2f,%.2f,%.2f,%.2f,%d,%d,%.1f,%d,%.2f,%s,%d\n",
-            type.c_str(),
-            millis(),
-            gps.speed.kmph(),
-            oiler.getSmoothedSpeed(),
-            oiler.getOdometer(),
-            oiler.getCurrentDistAccumulator(),
-            oiler.getCurrentTargetDistance(),
-            oiler.isPumpRunning(),
-            oiler.isRainMode(),
-            oiler.getCurrentTempC(),
-            gps.satellites.value(),
-            gps.hdop.hdop(),
-            message.c_str(),
-            oiler.isFlushMode()
-        );
-        f.close();
+uint32_t taskHighRate() {
+    static bool wasActive = false;
+    if (hrTaskHandle == NULL) return 1000000UL / HIGHRATE_LOG_HZ; // Card not ready (yet)
+
+    // Riding or pumping, a parked bike only fills the card
+    bool active = oiler.getSmoothedSpeed() >= MIN_SPEED_KMH || oiler.isPumpRunning();
+    if (active) {
+        HighRateLog::Sample s;
+        s.timeMs = millis();
+        s.speedGps = gpsIngest.getLastFix().speedKmh;
+        s.speedSmooth = oiler.getSmoothedSpeed();
+        s.roll = oiler.imu.getRoll();
+        s.pitch = oiler.imu.getPitch();
+        s.accelX = oiler.imu.getLinAccelX();
+        s.accelY = oiler.imu.getLinAccelY();
+        s.accelZ = oiler.imu.getLinAccelZ();
+        s.pumpOn = oiler.isPumpRunning();
+        highRateLog.add(s); // Drops are counted, never waits
+    } else if (wasActive) {
+        flushHighRateLog();
     }
+    wasActive = active;
+    return 1000000UL / HIGHRATE_LOG_HZ;
 }
 #endif
+#endif
 
 void handleSettings() {
     resetWifiTimer();
 #ifdef GPS_DEBUG
     Serial.println("Serving Settings Page"); 
 #endif
-    String html = htmlHeader;
-    html.replace("%TIME%", getZurichTime());
-    html.replace("%SATS%", String(gps.satellites.value()));
-    
-    String tempHeader = "--";
-    if (oiler.isTempSensorConnected()) {
-        tempHeader = String(oiler.getCurrentTempC(), 1);
-    }
-    html.replace("%TEMP%", tempHeader);
+    if (sendGzip("text/html", htmlSettingsGz, sizeof(htmlSettingsGz))) return;
+    server.send(200, "text/html", htmlSettings);
+}
 
-    double totalRecentTime = oiler.getRecentTotalTime();
+// --- JSON API ---
+// The landing and settings pages are static and fill themselves from these
+// (a few hundred bytes per refresh). Streamed like the pages, no String.
+void sendJson(void (*fill)(JsonWriter& json)) {
+    server.sendHeader("Cache-Control", "no-store");
+    PageStream out(server);
+    out.begin(200, "application/json");
+    JsonWriter json(out);
+    json.beginObject();
+    fill(json);
+    json.endObject();
+    out.end();
+}
 
-    for(int i=0; i<NUM_RANGES; i++) {
-        SpeedRange* r = oiler.getRangeConfig(i);
-        
-        // Calculate percentage
-        float pct = 0.0;
-        if (totalRecentTime > 0) {
-             pct = (oiler.getRecentTimeSeconds(i) / totalRecentTime) * 100.0;
-        }
+void fillStatus(JsonWriter& json) {
+    const GpsFix& fix = gpsIngest.getLastFix();
+    json.add("time", getZurichTime().c_str());
+    json.add("sats", fix.sats);
+    json.addFixed("speedKmh", oiler.getSmoothedSpeed(), 1);
+    if (oiler.isTempSensorConnected()) json.addFixed("tempC", oiler.getCurrentTempC(), 1);
+    else json.addNull("tempC");
+    json.addFixed("odoKm", oiler.getTotalDistance(), 1);
+    json.add("pumpCycles", oiler.getPumpCycles());
+    json.addFixed("progressPct", oiler.getCurrentProgress() * 100.0, 1);
+    json.addBool("emergency", oiler.isEmergencyModeForced());
+    json.addBool("rain", oiler.isRainMode());
+    json.addBool("flush", oiler.isFlushMode());
+    json.beginObject("tank");
+    json.addBool("enabled", oiler.tankMonitorEnabled);
+    json.addFixed("levelMl", oiler.currentTankLevelMl, 1);
+    json.addFixed("capacityMl", oiler.tankCapacityMl, 0);
+    json.addFixed("pct", tankPercent(), 0);
+    json.add("warnPct", oiler.tankWarningThresholdPercent);
+    json.endObject();
+}
 
-        html += "<tr><td>";
-        html += String((int)r->minSpeed) + "-" + String((int)r->maxSpeed) + " km/h";
-        html += "</td><td><input type='number' step='0.1' name='km" + String(i) + "' value='" + String(r->intervalKm) + "' class='km-input'>";
-        html += "</td><td style='text-align:center;color:#fff'>" + String(pct, 1) + "%";
-        html += "</td><td style='text-align:center;color:#fff'>" + String(oiler.getRecentOilingCount(i));
-        html += "</td><td><input type='number' name='p" + String(i) + "' value='" + String(r->pulses) + "' class='pulse-input'></td></tr>";
+void fillConfig(JsonWriter& json) {
+    json.beginArray("ranges");
+    for (int i = 0; i < NUM_RANGES; i++) {
+        SpeedRange* r = oiler.getRangeConfig(i);
+        json.beginObject();
+        json.add("minKmh", (int)r->minSpeed);
+        json.add("maxKmh", (int)r->maxSpeed);
+        json.addFixed("km", r->intervalKm, 2);
+        json.add("pulses", r->pulses);
+        json.endObject();
     }
-    
-    // Add Reset Link below the table
-    html += "</table><div style='text-align:left;margin-top:10px;margin-bottom:10px'><a href='/reset_time_stats' style='color:red;text-decoration:none;font-size:1.1em'>[Reset Stats]</a></div>";
-    
-    String footer = htmlFooter;
-    
-    // Remove "</table>" from the start of htmlFooter since we already closed the table above
-    if (footer.startsWith("</table>")) {
-        footer = footer.substring(8); // Remove </table>
+    json.endArray();
+
+    json.beginObject("tempComp");
+    json.add("pulseMs", (int)oiler.tempConfig.basePulse25);
+    json.add("pauseMs", (int)oiler.tempConfig.basePause25);
+    json.add("oilType", (int)oiler.tempConfig.oilType);
+    json.endObject();
+
+    json.addBool("emergencyForced", oiler.isEmergencyModeForced());
+    json.addFixed("startDelayM", oiler.startupDelayMeters, 0);
+    json.add("offroadMin", oiler.offroadIntervalMin);
+
+    json.beginObject("flush");
+    json.add("events", oiler.flushConfigEvents);
+    json.add("pulses", oiler.flushConfigPulses);
+    json.add("intervalS", oiler.flushConfigIntervalSec);
+    json.endObject();
+
+    json.beginObject("tank");
+    json.addBool("enabled", oiler.tankMonitorEnabled);
+    json.addFixed("capacityMl", oiler.tankCapacityMl, 0);
+    json.add("dropsPerMl", oiler.dropsPerMl);
+    json.add("dropsPerPulse", oiler.dropsPerPulse);
+    json.add("warnPct", oiler.tankWarningThresholdPercent);
+    json.endObject();
+
+    // 0-255 -> 0-100% like the LED page
+    json.beginObject("led");
+    json.add("dimPct", map(oiler.ledBrightnessDim, 2, 202, 0, 100));
+    json.add("highPct", map(oiler.ledBrightnessHigh, 2, 202, 0, 100));
+    json.beginObject("night");
+    json.addBool("enabled", oiler.nightModeEnabled);
+    json.add("startHour", oiler.nightStartHour);
+    json.add("endHour", oiler.nightEndHour);
+    json.add("dimPct", map(oiler.nightBrightness, 2, 202, 0, 100));
+    json.add("highPct", map(oiler.nightBrightnessHigh, 2, 202, 0, 100));
+    json.endObject();
+    json.endObject();
+}
+
+void fillStats(JsonWriter& json) {
+    // Usage of the last 20 oilings per range
+    double totalRecentTime = oiler.getRecentTotalTime();
+    json.beginArray("ranges");
+    for (int i = 0; i < NUM_RANGES; i++) {
+        json.beginObject();
+        json.addFixed("usagePct", totalRecentTime > 0 ? oiler.getRecentTimeSeconds(i) / totalRecentTime * 100.0 : 0.0, 1);
+        json.add("oilings", oiler.getRecentOilingCount(i));
+        json.endObject();
     }
-    
-    // Temperature Compensation Injection
-    bool sensorConnected = oiler.isTempSensorConnected();
-    
-    footer.replace("%TC_PULSE%", String((int)oiler.tempConfig.basePulse25));
-    footer.replace("%TC_PAUSE%", String((int)oiler.tempConfig.basePause25));
-    
-    footer.replace("%OIL_THIN%", (oiler.tempConfig.oilType == Oiler::OIL_THIN) ? "checked" : "");
-    footer.replace("%OIL_NORMAL%", (oiler.tempConfig.oilType == Oiler::OIL_NORMAL) ? "checked" : "");
-    footer.replace("%OIL_THICK%", (oiler.tempConfig.oilType == Oiler::OIL_THICK) ? "checked" : "");
-    
-    footer.replace("%TEMP_C%", String(oiler.getCurrentTempC(), 1));
+    json.endArray();
+    json.addFixed("odoKm", oiler.getTotalDistance(), 1);
+    json.add("pumpCycles", oiler.getPumpCycles());
+    json.addFixed("progressPct", oiler.getCurrentProgress() * 100.0, 1);
+    json.add("timedPulses", oiler.pulseStats.getPulseCount());
+    json.add("uptimeS", millis() / 1000);
+}
 
-    footer.replace("%PROGRESS%", String(oiler.getCurrentProgress() * 100.0, 1));
-    
-    // Convert 0-255 to 0-100% for Display
-    footer.replace("%LED_DIM%", String(map(oiler.ledBrightnessDim, 2, 202, 0, 100)));
-    footer.replace("%LED_HIGH%", String(map(oiler.ledBrightnessHigh, 2, 202, 0, 100)));
-    
-    footer.replace("%EMERG_CHECKED%", oiler.isEmergencyModeForced() ? "checked" : "");
-    footer.replace("%START_DLY%", String(oiler.startupDelayMeters, 0));
-    footer.replace("%OFFROAD_INT%", String(oiler.offroadIntervalMin));
-    
-    footer.replace("%FLUSH_EV%", String(oiler.flushConfigEvents));
-    footer.replace("%FLUSH_PLS%", String(oiler.flushConfigPulses));
-    footer.replace("%FLUSH_INT%", String(oiler.flushConfigIntervalSec));
-    
-    footer.replace("%TANK_CHECKED%", oiler.tankMonitorEnabled ? "checked" : "");
-    footer.replace("%TANK_CAP%", String(oiler.tankCapacityMl, 0));
-    footer.replace("%DROP_ML%", String(oiler.dropsPerMl));
-    footer.replace("%DROP_PLS%", String(oiler.dropsPerPulse));
-    footer.replace("%TANK_WARN%", String(oiler.tankWarningThresholdPercent));
-    footer.replace("%TANK_LEVEL%", String(oiler.currentTankLevelMl, 1));
-    float pct = (oiler.tankCapacityMl > 0) ? (oiler.currentTankLevelMl / oiler.tankCapacityMl) * 100.0 : 0.0;
-    footer.replace("%TANK_PCT%", String(pct, 0));
-
-    footer.replace("%TOTAL_DIST%", String(oiler.getTotalDistance(), 1));
-    footer.replace("%PUMP_COUNT%", String(oiler.getPumpCycles()));
-
-    html += footer;
-    
-    server.send(200, "text/html", html);
+// Polled while the landing page is open, so it doesn't hold the WiFi timeout off
+void handleApiStatus() {
+    sendJson(fillStatus);
+}
+
+void handleApiConfig() {
+    resetWifiTimer();
+    sendJson(fillConfig);
+}
+
+void handleApiStats() {
+    sendJson(fillStats);
+}
+
+const char* const ledKeys[] = { "LED_DIM", "LED_HIGH", "NIGHT_CHECKED", "NIGHT_START", "NIGHT_END", "NIGHT_BRI", "NIGHT_BRI_H" };
+enum { LED_DIM, LED_HIGH, LED_NIGHT_CHECKED, LED_NIGHT_START, LED_NIGHT_END, LED_NIGHT_BRI, LED_NIGHT_BRI_H, LED_KEYS };
+PageTemplate ledPage(htmlLEDSettings, ledKeys, LED_KEYS);
+
+void fillLED(Print& out, int key) {
+    switch (key) {
+        case LED_DIM: out.print(map(oiler.ledBrightnessDim, 2, 202, 0, 100)); break;
+        case LED_HIGH: out.print(map(oiler.ledBrightnessHigh, 2, 202, 0, 100)); break;
+        case LED_NIGHT_CHECKED: if (oiler.nightModeEnabled) out.print("checked"); break;
+        case LED_NIGHT_START: out.print(oiler.nightStartHour); break;
+        case LED_NIGHT_END: out.print(oiler.nightEndHour); break;
+        case LED_NIGHT_BRI: out.print(map(oiler.nightBrightness, 2, 202, 0, 100)); break;
+        case LED_NIGHT_BRI_H: out.print(map(oiler.nightBrightnessHigh, 2, 202, 0, 100)); break;
+    }
 }
 
 void handleLEDSettings() {
     resetWifiTimer();
-    String html = htmlLEDSettings;
-    
-    html.replace("%LED_DIM%", String(map(oiler.ledBrightnessDim, 2, 202, 0, 100)));
-    html.replace("%LED_HIGH%", String(map(oiler.ledBrightnessHigh, 2, 202, 0, 100)));
-    
-    html.replace("%NIGHT_CHECKED%", oiler.nightModeEnabled ? "checked" : "");
-    html.replace("%NIGHT_START%", String(oiler.nightStartHour));
-    html.replace("%NIGHT_END%", String(oiler.nightEndHour));
-    html.replace("%NIGHT_BRI%", String(map(oiler.nightBrightness, 2, 202, 0, 100)));
-    html.replace("%NIGHT_BRI_H%", String(map(oiler.nightBrightnessHigh, 2, 202, 0, 100)));
-    
-    server.send(200, "text/html", html);
+    sendPage(ledPage, fillLED);
 }
 
 void handleRoot() {
     resetWifiTimer();
-    String html = htmlLanding;
-    
-    html.replace("%TIME%", getZurichTime());
-    html.replace("%SATS%", String(gps.satellites.value()));
-    
-    String tempHeader = "--";
-    if (oiler.isTempSensorConnected()) {
-        tempHeader = String(oiler.getCurrentTempC(), 1);
-    }
-    html.replace("%TEMP%", tempHeader);
-    
-    html.replace("%TANK_LEVEL%", String(oiler.currentTankLevelMl, 0));
-    html.replace("%TANK_CAP%", String(oiler.tankCapacityMl, 0));
-    float pct = (oiler.tankCapacityMl > 0) ? (oiler.currentTankLevelMl / oiler.tankCapacityMl) * 100.0 : 0.0;
-    html.replace("%TANK_PCT%", String(pct, 0));
-    
-    String tankColor = (pct <= oiler.tankWarningThresholdPercent) ? "#d32f2f" : "#ffc107";
-    html.replace("%TANK_COLOR%", tankColor);
-    
-    html.replace("%TOTAL_DIST%", String(oiler.getTotalDistance(), 1));
-    html.replace("%PUMP_COUNT%", String(oiler.getPumpCycles()));
-    html.replace("%PROGRESS%", String(oiler.getCurrentProgress() * 100.0, 1));
-    
-    bool emerg = oiler.isEmergencyModeForced();
-    html.replace("%EMERG_CLASS%", emerg ? "btn-danger" : "btn-sec");
-    html.replace("%EMERG_STATUS%", emerg ? "ON" : "OFF");
-    
-    server.send(200, "text/html", html);
+    if (sendGzip("text/html", htmlLandingGz, sizeof(htmlLandingGz))) return;
+    server.send(200, "text/html", htmlLanding);
 }
 
 void handleSaveLED() {
@@ -415,63 +603,74 @@ void handleSaveLED() {
     server.send(303);
 }
 
+// Empty fields (page not loaded, cleared input) keep their setting
+bool hasValue(const String& name) {
+    return server.arg(name).length() > 0;
+}
+
 void handleSave() {
     resetWifiTimer();
     webConsole.log("CMD: Save Settings");
+    // dropsPerMl divides the tank consumption (Oiler::triggerOil): refuse the whole form
+    if (hasValue("drop_ml") && server.arg("drop_ml").toInt() <= 0) {
+        server.send(400, "text/plain", "Drops/ml must be at least 1");
+        return;
+    }
+
     for(int i=0; i<NUM_RANGES; i++) {
         SpeedRange* r = oiler.getRangeConfig(i);
-        if(server.hasArg("km" + String(i))) r->intervalKm = server.arg("km" + String(i)).toFloat();
-        if(server.hasArg("p" + String(i))) r->pulses = server.arg("p" + String(i)).toInt();
+        if(hasValue("km" + String(i))) r->intervalKm = server.arg("km" + String(i)).toFloat();
+        if(hasValue("p" + String(i))) r->pulses = server.arg("p" + String(i)).toInt();
     }
     
     // Save Temperature Compensation (New Simplified Model)
-    if(server.hasArg("tc_pulse")) {
+    if(hasValue("tc_pulse")) {
         float val = server.arg("tc_pulse").toFloat();
         if (val < 50.0) val = 50.0;
         oiler.tempConfig.basePulse25 = val;
     }
-    if(server.hasArg("tc_pause")) oiler.tempConfig.basePause25 = server.arg("tc_pause").toFloat();
-    if(server.hasArg("oil_type")) oiler.tempConfig.oilType = (Oiler::OilType)server.arg("oil_type").toInt();
+    if(hasValue("tc_pause")) oiler.tempConfig.basePause25 = server.arg("tc_pause").toFloat();
+    if(hasValue("oil_type")) oiler.tempConfig.oilType = (Oiler::OilType)server.arg("oil_type").toInt();
 
     oiler.setEmergencyModeForced(server.hasArg("emerg_mode"));
     
-    if(server.hasArg("start_dly")) oiler.startupDelayMeters = server.arg("start_dly").toFloat();
-    if(server.hasArg("offroad_int")) oiler.offroadIntervalMin = server.arg("offroad_int").toInt();
+    if(hasValue("start_dly")) oiler.startupDelayMeters = server.arg("start_dly").toFloat();
+    if(hasValue("offroad_int")) oiler.offroadIntervalMin = server.arg("offroad_int").toInt();
     
-    if(server.hasArg("flush_ev")) oiler.flushConfigEvents = server.arg("flush_ev").toInt();
-    if(server.hasArg("flush_pls")) oiler.flushConfigPulses = server.arg("flush_pls").toInt();
-    if(server.hasArg("flush_int")) oiler.flushConfigIntervalSec = server.arg("flush_int").toInt();
+    if(hasValue("flush_ev")) oiler.flushConfigEvents = server.arg("flush_ev").toInt();
+    if(hasValue("flush_pls")) oiler.flushConfigPulses = server.arg("flush_pls").toInt();
+    if(hasValue("flush_int")) oiler.flushConfigIntervalSec = server.arg("flush_int").toInt();
     
     oiler.tankMonitorEnabled = server.hasArg("tank_en");
-    if(server.hasArg("tank_cap")) oiler.tankCapacityMl = server.arg("tank_cap").toFloat();
-    if(server.hasArg("drop_ml")) oiler.dropsPerMl = server.arg("drop_ml").toInt();
-    if(server.hasArg("drop_pls")) oiler.dropsPerPulse = server.arg("drop_pls").toInt();
-    if(server.hasArg("tank_warn")) oiler.tankWarningThresholdPercent = server.arg("tank_warn").toInt();
+    if(hasValue("tank_cap")) oiler.tankCapacityMl = server.arg("tank_cap").toFloat();
+    if(hasValue("drop_ml")) oiler.dropsPerMl = server.arg("drop_ml").toInt();
+    if(hasValue("drop_pls")) oiler.dropsPerPulse = server.arg("drop_pls").toInt();
+    if(hasValue("tank_warn")) oiler.tankWarningThresholdPercent = server.arg("tank_warn").toInt();
 
     oiler.saveConfig();
     server.sendHeader("Location", "/settings");
     server.send(303);
 }
 
-void handleIMU() {
-    resetWifiTimer();
-    String html = htmlIMU;
-    
-    html.replace("%IMU_MODEL%", oiler.imu.getModel());
-    html.replace("%IMU_STATUS%", oiler.imu.isAvailable() ? "<span style='color:green'>OK</span>" : "<span style='color:red'>Not Found</span>");
-    html.replace("%PITCH%", String(oiler.imu.getPitch(), 1));
-    html.replace("%ROLL%", String(oiler.imu.getRoll(), 1));
-    
-    // Chain Side Config
-    if (oiler.imu.isChainOnRight()) {
-        html.replace("%CHAIN_LEFT%", "");
-        html.replace("%CHAIN_RIGHT%", "selected");
-    } else {
-        html.replace("%CHAIN_LEFT%", "selected");
-        html.replace("%CHAIN_RIGHT%", "");
+const char* const imuKeys[] = { "IMU_MODEL", "IMU_STATUS", "PITCH", "ROLL", "CHAIN_LEFT", "CHAIN_RIGHT" };
+enum { IMU_MODEL, IMU_STATUS, IMU_PITCH, IMU_ROLL, IMU_CHAIN_LEFT, IMU_CHAIN_RIGHT, IMU_KEYS };
+PageTemplate imuPage(htmlIMU, imuKeys, IMU_KEYS);
+
+void fillIMU(Print& out, int key) {
+    switch (key) {
+        case IMU_MODEL: out.print(oiler.imu.getModel()); break;
+        case IMU_STATUS: out.print(oiler.imu.isAvailable() ? "<span style='color:green'>OK</span>" : "<span style='color:red'>Not Found</span>"); break;
+        case IMU_PITCH: out.print(oiler.imu.getPitch(), 1); break;
+        case IMU_ROLL: out.print(oiler.imu.getRoll(), 1); break;
+        // Chain Side Config
+        case IMU_CHAIN_LEFT: if (!oiler.imu.isChainOnRight()) out.print("selected"); break;
+        case IMU_CHAIN_RIGHT: if (oiler.imu.isChainOnRight()) out.print("selected"); break;
     }
+}
 
-    server.send(200, "text/html", html);
+void handleIMU() {
+    resetWifiTimer();
+    sendPage(imuPage, fillIMU);
 }
 
 void handleIMUConfig() {
@@ -485,68 +684,164 @@ void handleIMUConfig() {
     server.send(303);
 }
 
-void handleAuxConfig() {
+const char* const pumpStatsKeys[] = { "PULSES", "SUMMARY_ROWS", "HIST_ROWS" };
+enum { PS_PULSES, PS_SUMMARY_ROWS, PS_HIST_ROWS, PS_KEYS };
+PageTemplate pumpStatsPage(htmlPumpStats, pumpStatsKeys, PS_KEYS);
+
+void printDevMs(Print& out, int32_t us) {
+    out.print(us / 1000.0, 2);
+}
+
+void fillPumpStats(Print& out, int key) {
+    const PulseStats& st = oiler.pulseStats;
+    if (key == PS_PULSES) {
+        out.print(st.getPulseCount());
+    } else if (key == PS_SUMMARY_ROWS) {
+        const char* rowNames[] = { "Avg", "Min", "Max", "Count" };
+        for (int r = 0; r < 4; r++) {
+            out.printf("<tr><td>%s</td>", rowNames[r]);
+            for (int m = 0; m < PulseStats::METRIC_COUNT; m++) {
+                out.print("<td class='val'>");
+                if (r == 3) out.print(st.getCount(m));
+                else if (st.getCount(m) == 0) out.print("-");
+                else if (r == 0) printDevMs(out, st.getAvgDevUs(m));
+                else if (r == 1) printDevMs(out, st.getMinDevUs(m));
+                else printDevMs(out, st.getMaxDevUs(m));
+                out.print("</td>");
+            }
+            out.print("</tr>\n");
+        }
+    } else if (key == PS_HIST_ROWS) {
+        for (int b = 0; b < PULSE_STATS_BINS; b++) {
+            out.printf("<tr><td>%s</td>", PulseStats::getBinLabel(b));
+            for (int m = 0; m < PulseStats::METRIC_COUNT; m++) {
+                out.print("<td class='val'>");
+                out.print(st.getBin(m, b));
+                out.print("</td>");
+            }
+            out.print("</tr>\n");
+        }
+    }
+}
+
+void handlePumpStats() {
     resetWifiTimer();
-    String html = htmlAuxConfig;
-    
-    AuxMode mode = auxManager.getMode();
-    html.replace("%MODE_OFF%", (mode == AUX_MODE_OFF) ? "selected" : "");
-    html.replace("%MODE_AUX%", (mode == AUX_MODE_AUX_POWER) ? "selected" : "");
-    html.replace("%MODE_GRIPS%", (mode == AUX_MODE_HEATED_GRIPS) ? "selected" : "");
-    
+    sendPage(pumpStatsPage, fillPumpStats);
+}
+
+void handlePumpStatsReset() {
+    resetWifiTimer();
+    oiler.pulseStats.reset();
+    webConsole.log("CMD: Pump timing stats reset");
+    server.sendHeader("Location", "/pump_stats");
+    server.send(303);
+}
+
+const char* const auxKeys[] = {
+    "MODE_OFF", "MODE_AUX", "MODE_GRIPS", "BASE", "SPEED_LOW", "SPEED_MED", "SPEED_HIGH",
+    "REACT_SLOW", "REACT_MED", "REACT_FAST", "TEMP_LOW", "TEMP_MED", "TEMP_HIGH", "TEMPO",
+    "CURRENT_TEMP", "TEMP_CONV", "STARTT", "RAINB", "STARTL", "STARTS", "STARTD"
+};
+enum {
+    AUX_MODE_OFF_SEL, AUX_MODE_AUX_SEL, AUX_MODE_GRIPS_SEL, AUX_BASE, AUX_SPEED_LOW, AUX_SPEED_MED, AUX_SPEED_HIGH,
+    AUX_REACT_SLOW, AUX_REACT_MED, AUX_REACT_FAST, AUX_TEMP_LOW, AUX_TEMP_MED, AUX_TEMP_HIGH, AUX_TEMPO,
+    AUX_CURRENT_TEMP, AUX_TEMP_CONV, AUX_STARTT, AUX_RAINB, AUX_STARTL, AUX_STARTS, AUX_STARTD, AUX_KEYS
+};
+PageTemplate auxPage(htmlAuxConfig, auxKeys, AUX_KEYS);
+
+// Read once per page (render() asks for every placeholder)
+struct AuxGripView {
     int base, rainB, startL, startS, startD, reaction;
     float speedF, tempF, tempO, startT;
-    auxManager.getGripSettings(base, speedF, tempF, tempO, startT, rainB, startL, startS, startD, reaction);
-    
-    html.replace("%BASE%", String(base));
-    
-    // Speed Factor Selection
-    html.replace("%SPEED_LOW%", (abs(speedF - 0.2) < 0.1) ? "selected" : "");
-    html.replace("%SPEED_MED%", (abs(speedF - 0.5) < 0.1) ? "selected" : "");
-    html.replace("%SPEED_HIGH%", (abs(speedF - 1.0) < 0.1) ? "selected" : "");
-    
-    // Reaction Speed Selection
-    html.replace("%REACT_SLOW%", (reaction == 0) ? "selected" : "");
-    html.replace("%REACT_MED%", (reaction == 1) ? "selected" : "");
-    html.replace("%REACT_FAST%", (reaction == 2) ? "selected" : "");
-    
-    // Temp Factor Selection
-    html.replace("%TEMP_LOW%", (abs(tempF - 1.0) < 0.1) ? "selected" : "");
-    html.replace("%TEMP_MED%", (abs(tempF - 2.0) < 0.1) ? "selected" : "");
-    html.replace("%TEMP_HIGH%", (abs(tempF - 3.0) < 0.1) ? "selected" : "");
+} auxView;
 
-    html.replace("%TEMPO%", String(tempO, 1));
-    
-    if (oiler.isTempSensorConnected()) {
-        html.replace("%CURRENT_TEMP%", String(oiler.getCurrentTempC(), 1));
-    } else {
-        html.replace("%CURRENT_TEMP%", "no sensor");
+void printSelected(Print& out, bool selected) {
+    if (selected) out.print("selected");
+}
+
+void fillAux(Print& out, int key) {
+    const AuxGripView& g = auxView;
+    AuxMode mode = auxManager.getMode();
+    switch (key) {
+        case AUX_MODE_OFF_SEL: printSelected(out, mode == AUX_MODE_OFF); break;
+        case AUX_MODE_AUX_SEL: printSelected(out, mode == AUX_MODE_AUX_POWER); break;
+        case AUX_MODE_GRIPS_SEL: printSelected(out, mode == AUX_MODE_HEATED_GRIPS); break;
+        case AUX_BASE: out.print(g.base); break;
+        // Speed Factor Selection
+        case AUX_SPEED_LOW: printSelected(out, abs(g.speedF - 0.2) < 0.1); break;
+        case AUX_SPEED_MED: printSelected(out, abs(g.speedF - 0.5) < 0.1); break;
+        case AUX_SPEED_HIGH: printSelected(out, abs(g.speedF - 1.0) < 0.1); break;
+        // Reaction Speed Selection
+        case AUX_REACT_SLOW: printSelected(out, g.reaction == 0); break;
+        case AUX_REACT_MED: printSelected(out, g.reaction == 1); break;
+        case AUX_REACT_FAST: printSelected(out, g.reaction == 2); break;
+        // Temp Factor Selection
+        case AUX_TEMP_LOW: printSelected(out, abs(g.tempF - 1.0) < 0.1); break;
+        case AUX_TEMP_MED: printSelected(out, abs(g.tempF - 2.0) < 0.1); break;
+        case AUX_TEMP_HIGH: printSelected(out, abs(g.tempF - 3.0) < 0.1); break;
+        case AUX_TEMPO: out.print(g.tempO, 1); break;
+        case AUX_CURRENT_TEMP:
+            if (oiler.isTempSensorConnected()) out.print(oiler.getCurrentTempC(), 1);
+            else out.print("no sensor");
+            break;
+        case AUX_TEMP_CONV:
+            if (oiler.getTempConversionMs() > 0) {
+                out.printf("%u ms (max %u ms, %d bit)", (unsigned)oiler.getTempConversionMs(),
+                    (unsigned)oiler.getTempConversionMaxMs(), TEMP_RESOLUTION_BITS);
+            } else {
+                out.print("-");
+            }
+            break;
+        case AUX_STARTT: out.print(g.startT, 0); break;
+        case AUX_RAINB: out.print(g.rainB); break;
+        case AUX_STARTL: out.print(g.startL); break;
+        case AUX_STARTS: out.print(g.startS); break;
+        case AUX_STARTD: out.print(g.startD); break;
     }
+}
 
-    html.replace("%STARTT%", String(startT, 0));
-    html.replace("%RAINB%", String(rainB));
-    html.replace("%STARTL%", String(startL));
-    html.replace("%STARTS%", String(startS));
-    html.replace("%STARTD%", String(startD));
-    
-    server.send(200, "text/html", html);
+void handleAuxConfig() {
+    resetWifiTimer();
+    AuxGripView& g = auxView;
+    auxManager.getGripSettings(g.base, g.speedF, g.tempF, g.tempO, g.startT, g.rainB, g.startL, g.startS, g.startD, g.reaction);
+    sendPage(auxPage, fillAux);
 }
 
 void handleMaintenance() {
     resetWifiTimer();
+    if (sendGzip("text/html", htmlMaintenanceGz, sizeof(htmlMaintenanceGz))) return;
     server.send(200, "text/html", htmlMaintenance);
 }
 
 void handleConsole() {
     resetWifiTimer();
+    if (sendGzip("text/html", htmlConsoleGz, sizeof(htmlConsoleGz))) return;
     server.send(200, "text/html", htmlConsole);
 }
 
+// Boot timeline line of the console page (fetched once, the page itself is static)
+void handleConsoleBoot() {
+    server.send(200, "text/plain", bootTimeline.format());
+}
+
 void handleConsoleData() {
     resetWifiTimer();
     server.send(200, "text/plain", webConsole.getLogs());
 }
 
+// Placeholder offsets of all pages, once at boot (heap: a few bytes per placeholder)
+void beginPages() {
+    PageTemplate* pages[] = { &ledPage, &helpPage, &imuPage, &pumpStatsPage, &auxPage };
+    int placeholders = 0;
+    for (size_t i = 0; i < sizeof(pages) / sizeof(pages[0]); i++) {
+        pages[i]->begin();
+        placeholders += pages[i]->getPlaceholders();
+    }
+#ifdef GPS_DEBUG
+    Serial.printf("Web pages: %d placeholders\n", placeholders);
+#endif
+}
+
 void handleConsoleClear() {
     resetWifiTimer();
     webConsole.clear();
@@ -595,7 +890,385 @@ void handleIMUSide() {
     server.send(303);
 }
 
+// --- GPS Ingest Task ---
+// UART RX event (called from the UART driver task) -> wake the GPS task
+void onGpsReceive() {
+    if (gpsTaskHandle != NULL) xTaskNotifyGive(gpsTaskHandle);
+}
+
+void onGpsReceiveError(hardwareSerial_error_t err) {
+    gpsIngest.countRxError();
+}
+
+// Decodes NMEA independent of the loop, so a slow web request or SD write
+// cannot overflow the UART buffer. Fixes go to the loop via gpsIngest's queue.
+void gpsTask(void* param) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(GPS_TASK_POLL_MS));
+        uint32_t rxMicros = micros();
+        while (gpsSerial.available() > 0) {
+            gpsIngest.encode(gpsSerial.read());
+        }
+        if (gpsIngest.publish(rxMicros) && loopTaskHandle != NULL) {
+            xTaskNotifyGive(loopTaskHandle); // Wake the loop for the new fix
+        }
+    }
+}
+
+// --- Main Loop Tasks (see Scheduler) ---
+// Each returns the time in us until it wants to run again.
+
+uint32_t taskGps() {
+    // Consume fixes from the GPS task: signal quality gate + Oiler::update()
+    // (shared with the host replay tool)
+    gpsIngest.process(oiler);
+
+    // Boot timeline is complete with the first good fix
+    static bool fixReported = false;
+    if (!fixReported && bootTimeline.getFirstUpdateMs() != 0) {
+        fixReported = true;
+        String boot = "Boot: " + bootTimeline.format();
+        webConsole.log(boot);
+#ifdef SD_LOGGING_ACTIVE
+        writeLogLine(TelemetryLog::REC_EVENT, boot);
+#endif
+    }
+    return SCHED_GPS_INTERVAL_MS * 1000UL;
+}
+
+uint32_t taskControl() {
+    uint32_t nextUs = oiler.serviceControl(); // Button, IMU, timed modes, temperature
+#ifdef SD_LOGGING_ACTIVE
+    // Crash: get the last seconds onto the card before the power is cut
+    static bool crashLogged = false;
+    if (oiler.crashTripped && !crashLogged) {
+        crashLogged = true;
+        writeLogLine(TelemetryLog::REC_EVENT, "Crash detected");
+        logWriter.flush();
+#ifdef HIGHRATE_LOG_ACTIVE
+        flushHighRateLog();
+#endif
+    }
+#endif
+    return nextUs;
+}
+
+uint32_t taskPump() {
+    return oiler.servicePump();
+}
+
+uint32_t taskLED() {
+    return oiler.serviceLED();
+}
+
+uint32_t taskAux() {
+    auxManager.loop(oiler.getSmoothedSpeed(), oiler.lastTemp, oiler.isRainMode());
+    
+    // Pass Aux Status to Oiler for LED
+    oiler.setAuxStatus(auxManager.getCurrentPwm(), (int)auxManager.getMode(), auxManager.isBoostActive());
+    return SCHED_AUX_INTERVAL_MS * 1000UL;
+}
+
+#ifdef SD_LOGGING_ACTIVE
+uint32_t taskLog() {
+    writeLogLine(TelemetryLog::REC_DATA);
+
+    // One PULSE line per pulse since the last run (requested/achieved in us, no commas)
+    static uint32_t lastLoggedPulse = 0;
+    uint32_t lastSeq = oiler.pulseStats.getLastSeq();
+    if (lastSeq < lastLoggedPulse) lastLoggedPulse = 0; // Stats were reset
+    if (lastSeq - lastLoggedPulse > PULSE_STATS_RECENT) lastLoggedPulse = lastSeq - PULSE_STATS_RECENT;
+    PulseStats::Sample s;
+    for (uint32_t seq = lastLoggedPulse + 1; seq <= lastSeq; seq++) {
+        if (!oiler.pulseStats.getRecent(seq, s)) continue;
+        String msg = "seq=" + String(seq);
+        msg += ";ru=" + String(s.requestedUs[PulseStats::RAMP_UP]) + "/" + String(s.actualUs[PulseStats::RAMP_UP]);
+        msg += ";hold=" + String(s.requestedUs[PulseStats::HOLD]) + "/" + String(s.actualUs[PulseStats::HOLD]);
+        msg += ";rd=" + String(s.requestedUs[PulseStats::RAMP_DOWN]) + "/" + String(s.actualUs[PulseStats::RAMP_DOWN]);
+        if (s.hasPause) {
+            msg += ";pause=" + String(s.requestedUs[PulseStats::PAUSE]) + "/" + String(s.actualUs[PulseStats::PAUSE]);
+        }
+        writeLogLine(TelemetryLog::REC_PULSE, msg);
+    }
+    lastLoggedPulse = lastSeq;
+
+#ifdef HIGHRATE_LOG_ACTIVE
+    // The card can't keep up with the high-rate log
+    static uint32_t reportedDrops = 0;
+    uint32_t drops = highRateLog.getDropped();
+    if (drops != reportedDrops) {
+        reportedDrops = drops;
+        writeLogLine(TelemetryLog::REC_EVENT, "HR dropped=" + String(drops) + ";samples=" + String(highRateLog.getSamples()));
+    }
+#endif
+
+    // Stopped: the ride so far goes to the card (ignition may be switched off next)
+    static bool wasMoving = false;
+    bool moving = oiler.getSmoothedSpeed() >= MIN_SPEED_KMH;
+    if (wasMoving && !moving) {
+        logWriter.flush();
+    } else {
+        logWriter.service();
+    }
+    wasMoving = moving;
+    return LOG_INTERVAL_MS * 1000UL;
+}
+#endif
+
+uint32_t taskPersist() {
+    return persistence.service();
+}
+
+// --- Parallel Init ---
+// Slow probes (bus timeouts when the hardware is missing) run in short-lived
+// tasks while the loop already runs the pump, GPS ingest and LEDs. A task sets
+// its bit in initEvents when done, taskInit() then brings the feature online
+// on the loop task (NVS and the log file are only used from there).
+struct InitJob {
+    const char* name;
+    bool (*probe)();              // Init task
+    void (*online)(bool found);   // Loop task
+    uint32_t startUs;
+    uint32_t endUs;
+    bool found;
+    bool done; // online() called
+};
+
+bool probeImu() { return oiler.imu.probe(); }
+void imuOnline(bool found) { if (found) oiler.imu.activate(); }
+
+#ifdef SD_LOGGING_ACTIVE
+void sdOnline(bool found) {
+    sdInitialized = found;
+    if (found) {
+        logWriter.begin(&logStore);
+        writeLogHeader();
+#ifdef HIGHRATE_LOG_ACTIVE
+        startHighRateLog();
+#endif
+        if (xTaskCreatePinnedToCore(logSpareTask, "logspare", LOG_SPARE_TASK_STACK, NULL,
+                                    LOG_SPARE_TASK_PRIORITY, NULL, LOG_SPARE_TASK_CORE) != pdPASS) {
+            Serial.println("SD log: no memory for the spare task (segments are created on rotation)");
+        }
+    }
+    writeLogLine(TelemetryLog::REC_EVENT, "Boot: " + bootTimeline.format());
+}
+#endif
+
+InitJob initJobs[] = {
+    { "imu", probeImu, imuOnline },
+#ifdef SD_LOGGING_ACTIVE
+    { "sd", initSD, sdOnline },
+#endif
+};
+const int INIT_JOB_COUNT = sizeof(initJobs) / sizeof(initJobs[0]);
+const EventBits_t INIT_ALL_BITS = (1 << INIT_JOB_COUNT) - 1;
+EventGroupHandle_t initEvents = NULL;
+
+void runInitJob(int i) {
+    InitJob& job = initJobs[i];
+    job.startUs = micros();
+    job.found = job.probe();
+    job.endUs = micros();
+    xEventGroupSetBits(initEvents, 1 << i);
+}
+
+void initTask(void* param) {
+    runInitJob((int)(intptr_t)param);
+    vTaskDelete(NULL);
+}
+
+void startInitTasks() {
+    initEvents = xEventGroupCreate();
+    for (int i = 0; i < INIT_JOB_COUNT; i++) {
+        if (xTaskCreatePinnedToCore(initTask, initJobs[i].name, INIT_TASK_STACK, (void*)(intptr_t)i,
+                                    INIT_TASK_PRIORITY, NULL, INIT_TASK_CORE) != pdPASS) {
+            runInitJob(i); // No memory for a task: probe inline
+        }
+    }
+}
+
+// Readiness barrier: true once all probes have finished (waits up to timeoutMs)
+bool waitForInit(uint32_t timeoutMs) {
+    EventBits_t bits = xEventGroupWaitBits(initEvents, INIT_ALL_BITS, pdFALSE, pdTRUE, pdMS_TO_TICKS(timeoutMs));
+    return (bits & INIT_ALL_BITS) == INIT_ALL_BITS;
+}
+
+uint32_t taskInit() {
+    EventBits_t bits = xEventGroupGetBits(initEvents);
+    bool pending = false;
+    for (int i = 0; i < INIT_JOB_COUNT; i++) {
+        InitJob& job = initJobs[i];
+        if (job.done) continue;
+        if (!(bits & (1 << i))) {
+            pending = true;
+            continue;
+        }
+        job.done = true;
+        bootTimeline.addBackground(job.name, job.startUs, job.endUs);
+        job.online(job.found);
+    }
+    return pending ? INIT_POLL_MS * 1000UL : 60000000UL; // All online: nothing left to do
+}
+
+uint32_t taskRestart() {
+    // Handle Delayed Restart / Reset
+    static int lastCountdown = 6;
+    if (shouldRestart || shouldFactoryReset) {
+        int remaining = 5 - ((millis() - restartTimer) / 1000);
+        
+        if (remaining < lastCountdown && remaining > 0) {
+            String msg = "... " + String(remaining);
+            webConsole.log(msg);
+            Serial.println(msg);
+            lastCountdown = remaining;
+        }
+        
+        if (millis() - restartTimer > 5000) {
+             if (shouldRestart) {
+                 webConsole.log("RESTARTING NOW");
+                 Serial.println("RESTARTING NOW");
+                 persistence.flush();
+                 waitForInit(1000); // Don't cut a probe off mid-transaction
+#ifdef SD_LOGGING_ACTIVE
+                 logWriter.flush();
+#endif
+                 delay(100);
+                 ESP.restart();
+             }
+             if (shouldFactoryReset) {
+#ifdef SD_LOGGING_ACTIVE
+                 logWriter.flush();
+#endif
+                 oiler.performFactoryReset();
+             }
+        }
+    } else {
+        lastCountdown = 6;
+    }
+    return SCHED_MAX_SLEEP_MS * 1000UL;
+}
+
+uint32_t taskNet() {
+    // --- WiFi Management & Aux Toggle ---
+    unsigned long currentMillis = millis();
+
+    // 1. Button Requests (Handled by Oiler)
+    if (oiler.checkWifiToggleRequest()) {
+        if (!wifiActive) {
+            // Activate WiFi
+            WiFi.softAP(AP_SSID);
+            IPAddress IP = WiFi.softAPIP();
+#ifdef GPS_DEBUG
+            Serial.print("WiFi activated via Button. IP: ");
+            Serial.println(IP);
+#endif
+            dnsServer.start(53, "*", IP);
+            server.begin();
+            wifiActive = true;
+            wifiStartTime = currentMillis;
+        } else {
+            // WiFi is already active.
+            // Prevent accidental deactivation via button (User Request).
+            // Instead, we extend the timer.
+            wifiStartTime = currentMillis;
+            webConsole.log("BTN: WiFi Timer Extended");
+        }
+    }
+
+    if (oiler.checkAuxToggleRequest()) {
+        auxManager.toggleManualOverride();
+#ifdef GPS_DEBUG
+        Serial.print("Aux Manual Override Toggled: ");
+        Serial.println(auxManager.isManualOverrideActive() ? "ON" : "OFF");
+#endif
+    }
+
+    // 2. Deactivation: Driving or Timeout
+    if (wifiActive) {
+        bool shouldStop = false;
+        
+        // Timeout Check
+        if (currentMillis - wifiStartTime > WIFI_TIMEOUT) {
+#ifdef GPS_DEBUG
+            Serial.println("WiFi Timeout.");
+#endif
+            shouldStop = true;
+        }
+        
+        // Speed Check (Auto-Off when driving)
+        if (gpsIngest.getSpeedKmh() > MIN_SPEED_KMH) {
+#ifdef GPS_DEBUG
+            Serial.println("Driving detected -> WiFi off.");
+#endif
+            shouldStop = true;
+        }
+
+        if (shouldStop) {
+            WiFi.softAPdisconnect(true);
+            wifiActive = false;
+        } else {
+            // Handle Network Services
+            dnsServer.processNextRequest();
+            server.handleClient();
+        }
+    }
+    
+    // Pass WiFi status to Oiler (for LED indication)
+    oiler.setWifiActive(wifiActive);
+
+    return (wifiActive ? SCHED_NET_INTERVAL_MS : SCHED_NET_IDLE_MS) * 1000UL;
+}
+
+#ifdef GPS_DEBUG
+uint32_t taskDebug() {
+    // GPS Debug Output
+    const GpsFix& fix = gpsIngest.getLastFix();
+    
+    String logMsg = String("GPS: Fix=") + (fix.locationValid ? "OK" : "NO") + 
+                    ", Sats=" + String(fix.sats) + 
+                    ", HDOP=" + String(fix.hdop, 1);
+    webConsole.log(logMsg);
+
+    Serial.printf("GPS Status: Fix=%s, Sats=%d, Speed=%.1f km/h, Lat=%.6f, Lon=%.6f, HDOP=%.1f %s\n", 
+        fix.locationValid ? "OK" : "NO", 
+        (int)fix.sats, 
+        gpsIngest.getSpeedKmh(), // Show filtered speed
+        fix.locationValid ? fix.lat : 0.0,
+        fix.locationValid ? fix.lng : 0.0,
+        fix.hdop,
+        gpsIngest.isSignalPoor() ? "[FILTERED]" : ""
+    );
+    Serial.printf("GPS Ingest: NMEA ok=%u fail=%u, fixes=%u dropped=%u, rx errors=%u, latency avg=%u us max=%u us\n",
+        fix.sentencesOk, fix.sentencesFailed,
+        gpsIngest.getPublishedCount(), gpsIngest.getDroppedCount(), gpsIngest.getRxErrorCount(),
+        gpsIngest.getLatencyAvgUs(), gpsIngest.getLatencyMaxUs()
+    );
+    Serial.printf("Scheduler: load %.2f%%, max late %u us\n", scheduler.getLoadPercent(), scheduler.getMaxLateUs());
+    Serial.printf("Temp: conversion %lu ms (max %lu ms)\n", oiler.getTempConversionMs(), oiler.getTempConversionMaxMs());
+    Serial.printf("NVS: %u keys written, %u unchanged puts skipped, %u commits, %d cached\n",
+        persistence.getWrites(), persistence.getSkipped(), persistence.getCommits(), persistence.getEntryCount());
+    Serial.printf("Journal: %s, %u checkpoints, %u sector erases\n", oiler.journal.isAvailable() ? "OK" : "missing (NVS)",
+        oiler.journal.getAppends(), oiler.journal.getSectorErases());
+#ifdef SD_LOGGING_ACTIVE
+    Serial.printf("SD log: %u lines, %u bytes in %u writes (max %u us), %u errors, %u buffered\n",
+        logWriter.getLines(), logWriter.getBytes(), logWriter.getWrites(), logWriter.getMaxWriteUs(),
+        logWriter.getErrors(), (unsigned)logWriter.getBuffered());
+    Serial.printf("Log store: %s (log %u), %u segments, %u filled, %u zero filled this boot, %u index dropped\n",
+        logStore.getSegmentPath().c_str(), logStore.getLog(), logStore.getSegmentCount(),
+        logStore.getRotations(), logStore.getCreated(), logStore.getIndexDropped());
+#endif
+#ifdef HIGHRATE_LOG_ACTIVE
+    Serial.printf("HR log: %u samples, %u dropped, %u buffers, %u bytes (max write %u us), %u errors\n",
+        highRateLog.getSamples(), highRateLog.getDropped(), highRateLog.getBuffersWritten(),
+        hrWriter.getBytes(), hrWriter.getMaxWriteUs(), hrWriter.getErrors());
+#endif
+    return 2000000UL;
+}
+#endif
+
 void setup() {
+    bootTimeline.mark("startup"); // Everything before setup()
     Serial.begin(115200);
 
     // Safety: Ensure Pump is OFF immediately
@@ -613,23 +1286,36 @@ void setup() {
     btStop();
 
     // GPS Start
+    loopTaskHandle = xTaskGetCurrentTaskHandle(); // setup() and loop() share the Arduino loop task
+    gpsSerial.setRxBufferSize(GPS_RX_BUFFER_SIZE); // Must be set before begin()
     gpsSerial.begin(GPS_BAUD, SERIAL_8N1, GPS_RX_PIN, GPS_TX_PIN);
+    gpsSerial.onReceiveError(onGpsReceiveError);
+    xTaskCreatePinnedToCore(gpsTask, "gps", GPS_TASK_STACK, NULL, GPS_TASK_PRIORITY, &gpsTaskHandle, GPS_TASK_CORE);
+    gpsSerial.onReceive(onGpsReceive);
+    bootTimeline.mark("gps");
     
-    // Oiler Start
+    // Oiler Start (marks its own phases)
     oiler.begin();
     auxManager.begin(&oiler.imu);
+    bootTimeline.mark("aux");
 
-#ifdef SD_LOGGING_ACTIVE
-    initSD();
-#endif
+    // IMU probe and SD mount continue in the background (see taskInit)
+    startInitTasks();
+    bootTimeline.mark("init");
 
     // WiFi Start Logic: Default OFF
     // Start DNS Server only when needed
 
     // Webserver Routes
+    beginPages();
+    const char* requestHeaders[] = { "Accept-Encoding", "If-None-Match" }; // For sendGzip()
+    server.collectHeaders(requestHeaders, 2);
     server.on("/style.css", handleCss);
     server.on("/", handleRoot);
     server.on("/settings", handleSettings);
+    server.on("/api/status", handleApiStatus);
+    server.on("/api/config", handleApiConfig);
+    server.on("/api/stats", handleApiStats);
     server.on("/led_settings", handleLEDSettings);
     server.on("/save", HTTP_POST, handleSave);
     server.on("/save_led", HTTP_POST, handleSaveLED);
@@ -648,7 +1334,10 @@ void setup() {
     
     // Console Routes
     server.on("/console", handleConsole);
+    server.on("/pump_stats", handlePumpStats);
+    server.on("/pump_stats_reset", handlePumpStatsReset);
     server.on("/console/data", handleConsoleData);
+    server.on("/console/boot", handleConsoleBoot);
     server.on("/console/clear", HTTP_POST, handleConsoleClear);
     
     server.on("/reset_stats", handleResetStats);
@@ -715,186 +1404,54 @@ void setup() {
         }
     });
 
+    bootTimeline.mark("routes");
     wifiStartTime = millis();
-}
-
-void loop() {
-    // Reset Watchdog
-    esp_task_wdt_reset();
-
-    // Handle Delayed Restart / Reset
-    static int lastCountdown = 6;
-    if (shouldRestart || shouldFactoryReset) {
-        int remaining = 5 - ((millis() - restartTimer) / 1000);
-        
-        if (remaining < lastCountdown && remaining > 0) {
-            String msg = "... " + String(remaining);
-            webConsole.log(msg);
-            Serial.println(msg);
-            lastCountdown = remaining;
-        }
-        
-        if (millis() - restartTimer > 5000) {
-             if (shouldRestart) {
-                 webConsole.log("RESTARTING NOW");
-                 Serial.println("RESTARTING NOW");
-                 delay(100);
-                 ESP.restart();
-             }
-             if (shouldFactoryReset) {
-                 oiler.performFactoryReset();
-             }
-        }
-    } else {
-        lastCountdown = 6;
-    }
-
-    // Read GPS Data
-    while (gpsSerial.available() > 0) {
-        char c = gpsSerial.read();
-        gps.encode(c);
-        // Optional: Uncomment to see raw data if needed
-        // Serial.write(c); 
-    }
-
-    float currentSpeed = gps.speed.isValid() ? gps.speed.kmph() : 0.0;
-
-    // GPS Filter: Ignore data if signal is poor (Multipath/Indoor protection)
-    // 1. Minimum 6 Satellites (Outdoors usually > 8)
-    // 2. HDOP must be good (< 5.0).
-    bool signalPoor = false;
-    if (gps.location.isValid()) {
-        if (gps.satellites.value() < 5 || gps.hdop.hdop() > 5.0) {
-            signalPoor = true;
-            currentSpeed = 0.0; // Force 0 speed
-        }
-    }
-
-#ifdef GPS_DEBUG
-    // GPS Debug Output
-    static unsigned long lastGpsDebug = 0;
-    if (millis() - lastGpsDebug > 2000) {
-        lastGpsDebug = millis();
-        
-        String logMsg = String("GPS: Fix=") + (gps.location.isValid() ? "OK" : "NO") + 
-                        ", Sats=" + String(gps.satellites.value()) + 
-                        ", HDOP=" + String(gps.hdop.hdop(), 1);
-        webConsole.log(logMsg);
-
-        Serial.printf("GPS Status: Fix=%s, Sats=%d, Speed=%.1f km/h, Lat=%.6f, Lon=%.6f, HDOP=%.1f %s\n", 
-            gps.location.isValid() ? "OK" : "NO", 
-            gps.satellites.value(), 
-            currentSpeed, // Show filtered speed
-            gps.location.isValid() ? gps.location.lat() : 0.0,
-            gps.location.isValid() ? gps.location.lng() : 0.0,
-            gps.hdop.hdop(),
-            signalPoor ? "[FILTERED]" : ""
-        );
-    }
-#endif
-
-    // Update Oiler Logic
-    // Pass current time to Oiler (for Night Mode)
-    if (gps.time.isValid() && gps.date.isValid()) {
-        int h = oiler.calculateLocalHour(gps.time.hour(), gps.date.day(), gps.date.month(), gps.date.year());
-        oiler.setCurrentHour(h);
-    }
-    
-    // Update Oiler with GPS data
-    // Ensure update is called at least every 1000ms to handle Emergency Mode (Forced or Auto)
-    static unsigned long lastOilerUpdate = 0;
-    bool gpsFresh = gps.location.isUpdated() || gps.speed.isUpdated();
-    
-    if (gpsFresh || (millis() - lastOilerUpdate > 1000)) {
-        // If called due to timeout (gpsFresh=false), we pass false as validity
-        // This allows the Oiler to detect signal loss and trigger Auto-Emergency Mode
-        // Also treat poor signal as invalid to ensure we don't get stuck in "0 km/h" state while driving
-        oiler.update(currentSpeed, gps.location.lat(), gps.location.lng(), gpsFresh && !signalPoor);
-        lastOilerUpdate = millis();
-    }
-    
-    // Run Oiler main loop (Button, LED, Bleeding)
-    oiler.loop();
-    
-    // Run Aux Manager Loop
-    auxManager.loop(oiler.getSmoothedSpeed(), oiler.lastTemp, oiler.isRainMode());
-    
-    // Pass Aux Status to Oiler for LED
-    oiler.setAuxStatus(auxManager.getCurrentPwm(), (int)auxManager.getMode(), auxManager.isBoostActive());
 
+    // Main Loop Tasks (run in this order when due at the same time)
+    gpsSchedTask = scheduler.add("gps", taskGps);
+    scheduler.add("control", taskControl);
+    pumpSchedTask = scheduler.add("pump", taskPump);
+    oiler.setPumpWakeCallback([]() { scheduler.wake(pumpSchedTask); });
+    oiler.pump.setFinishCallback([]() { xTaskNotifyGive(loopTaskHandle); }); // From the timer task
+    scheduler.add("aux", taskAux);
+    scheduler.add("led", taskLED);
+    scheduler.add("net", taskNet);
 #ifdef SD_LOGGING_ACTIVE
-    if (millis() - lastLogTime > LOG_INTERVAL_MS) {
-        writeLogLine("DATA");
-        lastLogTime = millis();
-    }
+    scheduler.add("log", taskLog, LOG_INTERVAL_MS * 1000UL);
 #endif
-
-    // --- WiFi Management & Aux Toggle ---
-    unsigned long currentMillis = millis();
-
-    // 1. Button Requests (Handled by Oiler)
-    if (oiler.checkWifiToggleRequest()) {
-        if (!wifiActive) {
-            // Activate WiFi
-            WiFi.softAP(AP_SSID);
-            IPAddress IP = WiFi.softAPIP();
-#ifdef GPS_DEBUG
-            Serial.print("WiFi activated via Button. IP: ");
-            Serial.println(IP);
+#ifdef HIGHRATE_LOG_ACTIVE
+    scheduler.add("hrlog", taskHighRate);
 #endif
-            dnsServer.start(53, "*", IP);
-            server.begin();
-            wifiActive = true;
-            wifiStartTime = currentMillis;
-        } else {
-            // WiFi is already active.
-            // Prevent accidental deactivation via button (User Request).
-            // Instead, we extend the timer.
-            wifiStartTime = currentMillis;
-            webConsole.log("BTN: WiFi Timer Extended");
-        }
-    }
-
-    if (oiler.checkAuxToggleRequest()) {
-        auxManager.toggleManualOverride();
+    scheduler.add("init", taskInit);
+    scheduler.add("persist", taskPersist);
+    scheduler.add("restart", taskRestart);
 #ifdef GPS_DEBUG
-        Serial.print("Aux Manual Override Toggled: ");
-        Serial.println(auxManager.isManualOverrideActive() ? "ON" : "OFF");
+    scheduler.add("debug", taskDebug, 2000000UL);
 #endif
-    }
 
-    // 2. Deactivation: Driving or Timeout
-    if (wifiActive) {
-        bool shouldStop = false;
-        
-        // Timeout Check
-        if (currentMillis - wifiStartTime > WIFI_TIMEOUT) {
-#ifdef GPS_DEBUG
-            Serial.println("WiFi Timeout.");
-#endif
-            shouldStop = true;
-        }
-        
-        // Speed Check (Auto-Off when driving)
-        if (currentSpeed > MIN_SPEED_KMH) {
-#ifdef GPS_DEBUG
-            Serial.println("Driving detected -> WiFi off.");
-#endif
-            shouldStop = true;
-        }
+    bootTimeline.setupDone();
+    String boot = "Boot: " + bootTimeline.format();
+    Serial.println(boot);
+    webConsole.log(boot); // SD: written once the card is mounted (sdOnline)
+}
 
-        if (shouldStop) {
-            WiFi.softAPdisconnect(true);
-            wifiActive = false;
-        } else {
-            // Handle Network Services
-            dnsServer.processNextRequest();
-            server.handleClient();
+void loop() {
+    // Reset Watchdog
+    esp_task_wdt_reset();
+
+    uint32_t sleepUs = scheduler.runDue(SCHED_MAX_SLEEP_MS * 1000UL);
+    if (sleepUs == 0) return;
+
+    // Sleep until the earliest deadline. Whole ticks are blocked (CPU idle),
+    // a rest below one tick (pump ramp steps) is busy-waited.
+    const uint32_t tickUs = portTICK_PERIOD_MS * 1000UL;
+    if (sleepUs >= tickUs) {
+        // The GPS task (fix queued) and the pump driver (pulse done) wake us early
+        if (ulTaskNotifyTake(pdTRUE, sleepUs / tickUs) > 0) {
+            scheduler.wake(gpsSchedTask);
+            scheduler.wake(pumpSchedTask);
         }
+    } else {
+        delayMicroseconds(sleepUs);
     }
-    
-    // Pass WiFi status to Oiler (for LED indication)
-    oiler.setWifiActive(wifiActive);
-
-    delay(10);
 }
@@ -0,0 +1,70 @@
+# Pre-build step (platformio.ini extra_scripts): gzips the static pages of
+# include/html_pages.h into include/html_pages_gz.h, served with
+# Content-Encoding: gzip and an ETag (hash of all pages) by main.cpp.
+# Also runs standalone: python tools/compress_pages.py
+import gzip
+import hashlib
+import os
+import re
+
+# Variable in html_pages.h -> array name in html_pages_gz.h
+PAGES = [
+    ("htmlCss", "htmlCssGz"),
+    ("htmlLanding", "htmlLandingGz"),
+    ("htmlSettings", "htmlSettingsGz"),
+    ("htmlHelp", "htmlHelpGz"),
+    ("htmlUpdate", "htmlUpdateGz"),
+    ("htmlMaintenance", "htmlMaintenanceGz"),
+    ("htmlConsole", "htmlConsoleGz"),
+]
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO)
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(ROOT, "include", "html_pages.h")
+CONFIG = os.path.join(ROOT, "include", "config.h")
+TARGET = os.path.join(ROOT, "include", "html_pages_gz.h")
+
+
+def read(path):
+    with open(path, encoding="utf-8", newline="") as f:
+        return f.read()
+
+
+def main():
+    html = read(SOURCE)
+    literals = dict(re.findall(r'const char\* (\w+) = R"rawliteral\((.*?)\)rawliteral";', html, re.S))
+    version = re.search(r'#define FIRMWARE_VERSION "([^"]*)"', read(CONFIG)).group(1)
+
+    blobs = []
+    for name, array in PAGES:
+        page = literals[name].replace("%VERSION%", version)  # The only placeholder left in these pages
+        data = gzip.compress(page.encode("utf-8"), compresslevel=9, mtime=0)  # mtime 0: same input, same bytes
+        blobs.append((name, array, len(page.encode("utf-8")), data))
+    etag = hashlib.sha1(b"".join(b[3] for b in blobs)).hexdigest()[:10]
+
+    out = ["// Generated by tools/compress_pages.py from html_pages.h - do not edit.",
+           "#ifndef HTML_PAGES_GZ_H", "#define HTML_PAGES_GZ_H", "",
+           "#include <stdint.h>", "",
+           '#define PAGES_ETAG "\\"%s\\""' % etag, ""]
+    for name, array, plain, data in blobs:
+        out.append("// %s: %d -> %d bytes" % (name, plain, len(data)))
+        out.append("const uint8_t %s[] = {" % array)
+        for i in range(0, len(data), 16):
+            out.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+        out.append("};")
+        out.append("")
+    out.append("#endif")
+    text = "\n".join(out) + "\n"
+
+    # Only rewrite on change, so an unchanged page doesn't rebuild main.cpp
+    if not os.path.exists(TARGET) or read(TARGET) != text:
+        with open(TARGET, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+        print("compress_pages: %s (ETag %s)" % (os.path.relpath(TARGET, ROOT), etag))
+
+
+main()